@@ -121,9 +121,10 @@ MM_EnvironmentDelegate::releaseExclusiveVMAccess()
 	if (1 == _env->getOmrVMThread()->exclusiveCount) {
 		OMR_VM_Example *exampleVM = (OMR_VM_Example *)_env->getOmrVM()->_language_vm;
 		omrthread_monitor_exit(_env->getOmrVM()->_vmThreadListMutex);
-		omrthread_rwmutex_exit_write(exampleVM->_vmAccessMutex);
+		/* withdraw the request before unlocking, so that threads woken by the unlock do not see it as still waiting */
 		Assert_MM_true(0 < exampleVM->_vmExclusiveAccessCount);
 		MM_AtomicOperations::subtract(&exampleVM->_vmExclusiveAccessCount, 1);
+		omrthread_rwmutex_exit_write(exampleVM->_vmAccessMutex);
 		_env->getOmrVMThread()->exclusiveCount -= 1;
 	} else if (1 < _env->getOmrVMThread()->exclusiveCount) {
 		_env->getOmrVMThread()->exclusiveCount -= 1;
@@ -39,6 +39,7 @@ private:
 protected:
 
 public:
+	uintptr_t allocationSite; /**< site of the allocation the thread is making, set by the allocating code (0 if unknown) */
 
 	/* Function members */
 private:
@@ -46,7 +47,9 @@ private:
 protected:
 
 public:
-	GC_Environment() {}
+	GC_Environment()
+		: allocationSite(0)
+	{}
 };
 
 /***
@@ -163,6 +166,19 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return true; }
 
+	/**
+	 * Identify the site of the allocation this thread is making, for the allocation site sampler
+	 * (-Xgc:allocationSiteSampleInterval). This is called from the allocation path before the object
+	 * is initialized, so the site has to be derived from the state of the thread (eg. the allocating
+	 * method and bytecode offset).
+	 *
+	 * The example takes the site from the thread's GC_Environment, where the allocating code leaves it
+	 * (the test harness identifies a site by the name prefix of the objects allocated there).
+	 *
+	 * @return a non-zero identifier for the allocation site, or 0 if the site is unknown
+	 */
+	uintptr_t getAllocationSite() { return _gcEnv.allocationSite; }
+
 	/**
 	 * Acquire shared VM access. Threads must acquire VM access before accessing any OMR internal
 	 * structures such as the heap. Requests for VM access will be blocked if any other thread is
@@ -37,27 +37,61 @@
 	if (0 != (rt)) {\
 		goto done;\
 	}
+#define MAX_ITERATE_THREADS 64
+#define MAX_ALLOCATION_SITES 16
 #define STRINGFY(str) DO_STRINGFY(str)
 #define DO_STRINGFY(str) #str
 
 const char *gcTests[] = {"fvtest/gctest/configuration/sample_GC_config.xml"
                         , "fvtest/gctest/configuration/test_system_gc.xml"
                         , "fvtest/gctest/configuration/global_GC_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_packets_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_prefetch_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_freelistbins_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_freelistfrag_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_fixedtlh_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_adaptivetlh_config.xml"
+#if defined(OMR_GC_MODRON_COMPACTION)
+                        , "fvtest/gctest/configuration/global_GC_compactplan_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_compactpin_config.xml"
+#endif
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/optavgpause_GC_config.xml"
+                        , "fvtest/gctest/configuration/optavgpause_GC_cardsummary_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER)
                         , "fvtest/gctest/configuration/scavenger_GC_config.xml"
                         , "fvtest/gctest/configuration/scavenger_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_workstealing_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_hotfield_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_allocsites_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_rsbatching_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_rsoverflow_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_numa_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_pausetarget_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_thp_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_copytiers_config.xml"
+                        , "fvtest/gctest/configuration/scavenger_GC_threadparking_config.xml"
 #endif
 #if defined(OMR_GC_MODRON_SCAVENGER) && defined(OMR_GC_MODRON_CONCURRENT_MARK)
                         , "fvtest/gctest/configuration/gencon_GC_config.xml"
                         , "fvtest/gctest/configuration/gencon_GC_backout_config.xml"
+                        , "fvtest/gctest/configuration/gencon_GC_iterate_config.xml"
+#endif
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+                        , "fvtest/gctest/configuration/concurrentsweep_GC_config.xml"
+#endif
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+                        , "fvtest/gctest/configuration/global_GC_idlerelease_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_loarelease_config.xml"
+                        , "fvtest/gctest/configuration/global_GC_thprelease_config.xml"
 #endif
                         };
 
 const char *perfTests[] = {"perftest/gctest/configuration/21645_core.20150126.202455.11862202.0001.xml",
-								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml"};
+								"perftest/gctest/configuration/24404_core.20140723.091737.5812.0002.xml",
+								"perftest/gctest/configuration/markPrefetch_off.xml",
+								"perftest/gctest/configuration/markPrefetch_on.xml"};
 void
 GCConfigTest::SetUp()
 {
@@ -296,6 +330,20 @@ GCConfigTest::parseObjectType(pugi::xml_node node)
 	return objType;
 }
 
+/**
+ * The allocation site of an object is identified by the prefix of its name, up to the first '_'.
+ */
+static uintptr_t
+allocationSiteForName(const char *name)
+{
+	/* FNV-1a; sites must be non-zero */
+	uintptr_t site = (uintptr_t)2166136261U;
+	for (const char *cursor = name; ('\0' != *cursor) && ('_' != *cursor); cursor++) {
+		site = (site ^ (uint8_t)*cursor) * (uintptr_t)16777619U;
+	}
+	return (0 == site) ? 1 : site;
+}
+
 ObjectEntry *
 GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 {
@@ -306,6 +354,9 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 	objEntry.name = objName;
 	objEntry.objPtr = NULL;
 
+	/* the allocation site sampler reads the site through MM_EnvironmentDelegate::getAllocationSite() */
+	env->getGCEnvironment()->allocationSite = allocationSiteForName(objName);
+
 	uint8_t objectAllocationModelSpace[sizeof(MM_ObjectAllocationModel)];
 	MM_ObjectAllocationModel *noGc = new(objectAllocationModelSpace)
 			MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, true));
@@ -317,6 +368,7 @@ GCConfigTest::allocateHelper(const char *objName, uintptr_t size)
 				MM_ObjectAllocationModel(env, size, MM_ObjectAllocationModel::selectObjectAllocationFlags(false, false, false, false));
 		objEntry.objPtr = OMR_GC_AllocateObject(exampleVM->_omrVMThread, withGc);
 	}
+	env->getGCEnvironment()->allocationSite = 0;
 
 	ObjectEntry *newEntry = NULL;
 	if (NULL != objEntry.objPtr) {
@@ -953,6 +1005,131 @@ done:
 	return rt;
 }
 
+static void
+countIteratedObject(OMR_VMThread *omrVMThread, omrobjectptr_t object, uintptr_t threadIndex, void *threadContext)
+{
+	*(uintptr_t *)threadContext += 1;
+}
+
+int32_t
+GCConfigTest::parallelIterateObjects(uintptr_t threadCount, uintptr_t *objectCounts, uintptr_t *threadsUsed)
+{
+	void *threadContexts[MAX_ITERATE_THREADS];
+	for (uintptr_t i = 0; i < threadCount; i++) {
+		objectCounts[i] = 0;
+		threadContexts[i] = (void *)&objectCounts[i];
+	}
+	return (int32_t)OMR_GC_ParallelIterateObjects(exampleVM->_omrVMThread, countIteratedObject, threadContexts, threadCount, threadsUsed);
+}
+
+int32_t
+GCConfigTest::verifyParallelIterateObjects(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	uintptr_t threadCount = (uintptr_t)atoi(node.attribute("threads").value());
+	uintptr_t firstCounts[MAX_ITERATE_THREADS];
+	uintptr_t secondCounts[MAX_ITERATE_THREADS];
+	uintptr_t firstThreadsUsed = 0;
+	uintptr_t secondThreadsUsed = 0;
+	uintptr_t singleCount = 0;
+	uintptr_t singleThreadsUsed = 0;
+	uintptr_t totalCount = 0;
+
+	if ((0 == threadCount) || (MAX_ITERATE_THREADS < threadCount)) {
+		threadCount = 4;
+	}
+	gcTestEnv->log("Iterating objects with %zu threads...\n", threadCount);
+
+	/* Two walks of an unchanged heap give every thread the same objects */
+	rt = parallelIterateObjects(threadCount, firstCounts, &firstThreadsUsed);
+	OMRGCTEST_CHECK_RT(rt);
+	rt = parallelIterateObjects(threadCount, secondCounts, &secondThreadsUsed);
+	OMRGCTEST_CHECK_RT(rt);
+	if ((0 == firstThreadsUsed) || (threadCount < firstThreadsUsed) || (firstThreadsUsed != secondThreadsUsed)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Unexpected number of iterating threads %zu and %zu.\n", __FILE__, __LINE__, firstThreadsUsed, secondThreadsUsed);
+		goto done;
+	}
+	for (uintptr_t i = 0; i < firstThreadsUsed; i++) {
+		if (firstCounts[i] != secondCounts[i]) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Thread %zu iterated %zu then %zu objects.\n", __FILE__, __LINE__, i, firstCounts[i], secondCounts[i]);
+			goto done;
+		}
+		totalCount += firstCounts[i];
+	}
+
+	/* The threads iterate every object once */
+	rt = parallelIterateObjects(1, &singleCount, &singleThreadsUsed);
+	OMRGCTEST_CHECK_RT(rt);
+	if ((0 == totalCount) || (singleCount != totalCount)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Iterated %zu objects with %zu threads and %zu with a single thread.\n", __FILE__, __LINE__, totalCount, firstThreadsUsed, singleCount);
+		goto done;
+	}
+	gcTestEnv->log("Iterated %zu objects with %zu threads.\n", totalCount, firstThreadsUsed);
+
+done:
+	return rt;
+}
+
+int32_t
+GCConfigTest::verifyAllocationSites(pugi::xml_node node)
+{
+	int32_t rt = 0;
+	const char *topName = node.attribute("top").value();
+	OMR_GC_AllocationSite sites[MAX_ALLOCATION_SITES];
+	uintptr_t written = 0;
+	uintptr_t survivorBytes = 0;
+
+	gcTestEnv->log("Getting the top allocation sites by bytes...\n");
+	rt = (int32_t)OMR_GC_GetAllocationSites(exampleVM->_omrVMThread, OMR_GC_ALLOCATION_SITES_BY_BYTES, sites, MAX_ALLOCATION_SITES, &written);
+	if (OMR_ERROR_NONE != rt) {
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d Failed to perform OMR_GC_GetAllocationSites with error code %d.\n", __FILE__, __LINE__, rt);
+		goto done;
+	}
+	if (0 == written) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No allocation site was sampled.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	/* The sites come highest first, and the bytes estimated for a site follow from its samples */
+	for (uintptr_t i = 0; i < written; i++) {
+		gcTestEnv->log(LEVEL_VERBOSE, "Site 0x%zx: %zu samples of %zu bytes, %zu surviving with %zu bytes.\n",
+				sites[i].site, sites[i].sampleCount, sites[i].sampledBytes, sites[i].survivorCount, sites[i].survivorBytes);
+		if ((0 < i) && (sites[i - 1].estimatedBytes < sites[i].estimatedBytes)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Site %zu is estimated at %llu bytes, more than the %llu bytes of the site before it.\n",
+					__FILE__, __LINE__, i, sites[i].estimatedBytes, sites[i - 1].estimatedBytes);
+			goto done;
+		}
+		if ((sites[i].survivorCount > sites[i].sampleCount) || (sites[i].survivorBytes > sites[i].sampledBytes)) {
+			rt = 1;
+			gcTestEnv->log(LEVEL_ERROR, "%s:%d Site %zu has more survivors than samples.\n", __FILE__, __LINE__, i);
+			goto done;
+		}
+		survivorBytes += sites[i].survivorBytes;
+	}
+
+	/* The objects allocated for the test are reachable, so some samples survive their first collection */
+	if (0 == survivorBytes) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d No sampled allocation survived.\n", __FILE__, __LINE__);
+		goto done;
+	}
+
+	if ((0 != strcmp(topName, "")) && (allocationSiteForName(topName) != sites[0].site)) {
+		rt = 1;
+		gcTestEnv->log(LEVEL_ERROR, "%s:%d The top allocation site 0x%zx is not the one of %s.\n", __FILE__, __LINE__, sites[0].site, topName);
+		goto done;
+	}
+	gcTestEnv->log("Sampled %zu allocation sites, %zu bytes survived.\n", written, survivorBytes);
+
+done:
+	return rt;
+}
+
 int32_t
 GCConfigTest::triggerOperation(pugi::xml_node node)
 {
@@ -973,6 +1150,18 @@ GCConfigTest::triggerOperation(pugi::xml_node node)
 			}
 			OMRGCTEST_CHECK_RT(rt);
 			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "idle")) {
+			/* leave the heap alone so that background GC threads can act on an idle heap */
+			uintptr_t milliseconds = (uintptr_t)atoi(node.attribute("milliseconds").value());
+			gcTestEnv->log("Idling for %zu milliseconds...\n", milliseconds);
+			omrthread_sleep(milliseconds);
+			verboseManager->getWriterChain()->endOfCycle(env);
+		} else if (0 == strcmp(node.name(), "parallelIterateObjects")) {
+			rt = verifyParallelIterateObjects(node);
+			OMRGCTEST_CHECK_RT(rt);
+		} else if (0 == strcmp(node.name(), "allocationSites")) {
+			rt = verifyAllocationSites(node);
+			OMRGCTEST_CHECK_RT(rt);
 		}
 	}
 done:
@@ -110,6 +110,9 @@ protected:
 	int32_t verifyVerboseGC(pugi::xpath_node_set verboseGCs);
 	int32_t parseGarbagePolicy(pugi::xml_node node);
 	int32_t triggerOperation(pugi::xml_node node);
+	int32_t parallelIterateObjects(uintptr_t threadCount, uintptr_t *objectCounts, uintptr_t *threadsUsed);
+	int32_t verifyParallelIterateObjects(pugi::xml_node node);
+	int32_t verifyAllocationSites(pugi::xml_node node);
 	int32_t iniXMLStr(const char *configStyle);
 
 	/* This implementation assumes that existing entries hashed into the rootTable and objectTable can
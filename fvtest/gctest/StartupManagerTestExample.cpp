@@ -83,7 +83,8 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 				} else if (0 == strcmp(attr.name(), "maxSizeDefaultMemorySpace")) {
 					extensions->maxSizeDefaultMemorySpace = atoi(attr.value()) * unitSize;
 				} else if (0 == strcmp(attr.name(), "gcthreadCount")) {
-					/* TODO: support multi-thread GC*/
+					extensions->gcThreadCount = atoi(attr.value());
+					extensions->gcThreadCountForced = true;
 				} else if (0 == strcmp(attr.name(), "GCPolicy")) {
 					if (0 == j9_cmdla_stricmp(attr.value(), "gencon")) {
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -101,12 +102,122 @@ MM_StartupManagerTestExample::parseLanguageOptions(MM_GCExtensionsBase *extensio
 #else
 					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentMark=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentCardSummary")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentCardSummary = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentCardSummary=true ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentSlack")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->concurrentSlack = atoi(attr.value()) * unitSize;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSlack ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "optimizeConcurrentWB")) {
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					extensions->optimizeConcurrentWB = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: optimizeConcurrentWB ignored, requires OMR_GC_MODRON_CONCURRENT_MARK (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK)*/
+				} else if (0 == strcmp(attr.name(), "concurrentSweep")) {
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+					extensions->concurrentSweep = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentSweep=true ignored, requires OMR_GC_CONCURRENT_SWEEP (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+				} else if (0 == strcmp(attr.name(), "compactOnGlobalGC")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					if (0 == j9_cmdla_stricmp(attr.value(), "true")) {
+						extensions->noCompactOnGlobalGC = 0;
+						extensions->compactOnGlobalGC = 1;
+						extensions->nocompactOnSystemGC = 0;
+					}
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactOnGlobalGC=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "compactUsingMovePlan")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->compactUsingMovePlan = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: compactUsingMovePlan=true ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "largeObjectPinnedSize")) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+					extensions->largeObjectPinnedSize = atoi(attr.value()) * unitSize;
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: largeObjectPinnedSize ignored, requires OMR_GC_MODRON_COMPACTION (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_MODRON_COMPACTION) */
+				} else if (0 == strcmp(attr.name(), "largeObjectArea")) {
+					extensions->largeObjectArea = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "transparentHugePageLayout")) {
+					extensions->transparentHugePageLayout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workpacketCount")) {
+					extensions->workpacketCount = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "packetListLockFree")) {
+					extensions->packetListLockFree = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workPacketMagazineSize")) {
+					extensions->workPacketMagazineSize = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "adaptiveWorkPacketSize")) {
+					extensions->adaptiveWorkPacketSize = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "workPacketSpillMaximum")) {
+					extensions->workPacketSpillMaximum = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "markingPrefetchDepth")) {
+					extensions->markingPrefetchDepth = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "freeListBins")) {
+					extensions->freeListBins = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "verifyFreeListBins")) {
+					extensions->fvtest_verifyFreeListBins = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "allocationSiteSampleInterval")) {
+					extensions->allocationSiteSampleInterval = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "tlhAdaptiveSizing")) {
+					extensions->tlhAdaptiveSizing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "tlhAllocationRate")) {
+					extensions->fvtest_tlhAllocationRate = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "gcThreadParking")) {
+					extensions->gcThreadParking = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 #if defined(OMR_GC_MODRON_SCAVENGER)
 				} else if (0 == strcmp(attr.name(), "forceBackOut")) {
 					extensions->fvtest_forceScavengerBackout = (0 == j9_cmdla_stricmp(attr.value(), "true"));
 				} else if (0 == strcmp(attr.name(), "forcePoisonEvacuate")) {
 					extensions->fvtest_forcePoisonEvacuate = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerWorkStealing")) {
+					extensions->scavengerWorkStealing = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldProfiling")) {
+					extensions->scavengerHotFieldProfiling = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerHotFieldSampleRate")) {
+					extensions->scavengerHotFieldSampleRate = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetBatching")) {
+					extensions->scavengerRememberedSetBatching = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "scavengerRememberedSetCardOverflow")) {
+					extensions->scavengerRememberedSetCardOverflow = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "rememberedSetMaxEntries")) {
+					extensions->fvtest_rememberedSetMaxSize = atoi(attr.value()) * sizeof(omrobjectptr_t);
+				} else if (0 == strcmp(attr.name(), "numaAwareNursery")) {
+					extensions->numaAwareNursery = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+				} else if (0 == strcmp(attr.name(), "numaSimulatedNodeCount")) {
+					extensions->_numaManager.setSimulatedNodeCountForFVTest(atoi(attr.value()));
+				} else if (0 == strcmp(attr.name(), "scavengerPauseTarget")) {
+					extensions->scavengerPauseTarget = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerThroughputGoal")) {
+					extensions->scavengerThroughputGoal = atof(attr.value());
+				} else if (0 == strcmp(attr.name(), "scavengerNonTemporalCopyThreshold")) {
+					extensions->scavengerNonTemporalCopyThreshold = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "scavengerWorkPerThread")) {
+					extensions->scavengerWorkPerThread = atoi(attr.value()) * unitSize;
+				} else if (0 == strcmp(attr.name(), "concurrentScavengerAdaptive")) {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+					extensions->concurrentScavengerAdaptive = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#else
+					gcTestEnv->log(LEVEL_ERROR, "WARNING: concurrentScavengerAdaptive=true ignored, requires OMR_GC_CONCURRENT_SCAVENGER (see configure_common.mk)\n");
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+				} else if (0 == strcmp(attr.name(), "idleHeapReleaseInterval")) {
+					extensions->idleHeapReleaseInterval = atoi(attr.value());
+				} else if (0 == strcmp(attr.name(), "largeObjectAreaReleaseFreePages")) {
+					extensions->largeObjectAreaReleaseFreePages = (0 == j9_cmdla_stricmp(attr.value(), "true"));
+#endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 				} else if ((0 == strcmp(attr.name(), "verboseLog")) || (0 == strcmp(attr.name(), "numOfFiles")) || (0 == strcmp(attr.name(), "numOfCycles")) || (0 == strcmp(attr.name(), "sizeUnit"))) {
 				} else {
 					gcTestEnv->log(LEVEL_ERROR, "Failed: Unrecognized option: %s\n", attr.name());
@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at http://eclipse.org/legal/epl-2.0
+ * or the Apache License, Version 2.0 which accompanies this distribution
+ * and is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following Secondary
+ * Licenses when the conditions for such availability set forth in the
+ * Eclipse Public License, v. 2.0 are satisfied: GNU General Public License,
+ * version 2 with the GNU Classpath Exception [1] and GNU General Public
+ * License, version 2 with the OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "SizeClasses.hpp"
+#include "gcTestHelpers.hpp"
+
+#include <Forge.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace OMR::GC;
+
+#define TEST_SIZECLASSES_FILE "omrgctest_sizeclasses.txt"
+
+static const uintptr_t staticCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1] = SMALL_SIZECLASSES;
+
+/* A few popular sizes over a sparse tail of every size, the way object sizes of a program are distributed */
+static void
+fillHistogram(uintptr_t *histogram)
+{
+	uint32_t seed = 12345;
+	for (uintptr_t i = 0; i < OMR_SIZECLASSES_HISTOGRAM_SIZE; i++) {
+		seed = (seed * 1103515245) + 12345;
+		histogram[i] = (0 == ((seed >> 16) % 4)) ? ((seed >> 16) % 50) : 0;
+	}
+	histogram[0] = 0;
+	histogram[MM_SizeClasses::getHistogramIndex(24)] += 40000;
+	histogram[MM_SizeClasses::getHistogramIndex(40)] += 25000;
+	histogram[MM_SizeClasses::getHistogramIndex(72)] += 9000;
+	histogram[MM_SizeClasses::getHistogramIndex(200)] += 3000;
+	histogram[MM_SizeClasses::getHistogramIndex(1000)] += 500;
+}
+
+static uintptr_t
+countSizeClasses(const uintptr_t *cellSizes)
+{
+	uintptr_t count = 0;
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
+		if (cellSizes[szClass] != cellSizes[szClass - 1]) {
+			count += 1;
+		}
+	}
+	return count;
+}
+
+static void
+writeFile(const char *text)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	intptr_t fd = omrfile_open(TEST_SIZECLASSES_FILE, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	ASSERT_NE(-1, fd);
+	omrfile_printf(fd, "%s", text);
+	omrfile_close(fd);
+}
+
+TEST(TestSizeClasses, TunedTableHonoursTargetCount)
+{
+	Forge forge;
+	ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+	uintptr_t histogram[OMR_SIZECLASSES_HISTOGRAM_SIZE];
+	fillHistogram(histogram);
+
+	for (uintptr_t classCount = 1; classCount <= OMR_SIZECLASSES_NUM_SMALL; classCount++) {
+		uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+		ASSERT_TRUE(MM_SizeClasses::computeTunedCellSizes(&forge, histogram, classCount, cellSizes));
+		EXPECT_TRUE(MM_SizeClasses::isValidCellSizes(cellSizes)) << "classCount " << classCount;
+		EXPECT_LE(countSizeClasses(cellSizes), classCount) << "classCount " << classCount;
+	}
+
+	forge.tearDown();
+}
+
+TEST(TestSizeClasses, TunedTableFragmentsNoMoreThanStaticTable)
+{
+	Forge forge;
+	ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+	uintptr_t histogram[OMR_SIZECLASSES_HISTOGRAM_SIZE];
+	fillHistogram(histogram);
+
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	ASSERT_TRUE(MM_SizeClasses::computeTunedCellSizes(&forge, histogram, OMR_SIZECLASSES_NUM_SMALL, cellSizes));
+	ASSERT_TRUE(MM_SizeClasses::isValidCellSizes(staticCellSizes));
+	EXPECT_LE(MM_SizeClasses::getInternalFragmentation(histogram, cellSizes), MM_SizeClasses::getInternalFragmentation(histogram, staticCellSizes));
+
+	forge.tearDown();
+}
+
+TEST(TestSizeClasses, LoadReadsStoredTable)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	Forge forge;
+	ASSERT_TRUE(forge.initialize(gcTestEnv->getPortLibrary()));
+
+	uintptr_t histogram[OMR_SIZECLASSES_HISTOGRAM_SIZE];
+	fillHistogram(histogram);
+
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	ASSERT_TRUE(MM_SizeClasses::computeTunedCellSizes(&forge, histogram, 12, cellSizes));
+	ASSERT_TRUE(MM_SizeClasses::storeCellSizes(gcTestEnv->getPortLibrary(), TEST_SIZECLASSES_FILE, cellSizes));
+
+	uintptr_t loadedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	ASSERT_TRUE(MM_SizeClasses::loadCellSizes(gcTestEnv->getPortLibrary(), TEST_SIZECLASSES_FILE, loadedCellSizes));
+	for (uintptr_t szClass = 0; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
+		EXPECT_EQ(cellSizes[szClass], loadedCellSizes[szClass]) << "size class " << szClass;
+	}
+
+	omrfile_unlink(TEST_SIZECLASSES_FILE);
+	forge.tearDown();
+}
+
+TEST(TestSizeClasses, LoadRejectsMalformedTable)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(gcTestEnv->getPortLibrary());
+	const char *malformed[] = {
+		"",
+		"not a table",
+		/* one entry short */
+		"{ 0, 16, 32, 64, 96, 160, 240, 352, 456, 592, 760, 968, 1200, 1520, 2048 }",
+		/* one entry too many */
+		"{ 0, 16, 32, 64, 96, 160, 240, 352, 456, 592, 760, 968, 1200, 1520, 1760, 2048, 2048 }",
+		/* decreasing */
+		"{ 0, 16, 32, 64, 96, 160, 240, 352, 456, 592, 760, 968, 1520, 1200, 1760, 2048 }",
+		/* not a multiple of the granule */
+		"{ 0, 16, 32, 64, 96, 160, 240, 352, 456, 592, 760, 968, 1200, 1520, 1761, 2048 }",
+		/* largest cell is not the largest small size */
+		"{ 0, 16, 32, 64, 96, 160, 240, 352, 456, 592, 760, 968, 1200, 1520, 1760, 2040 }",
+	};
+
+	for (uintptr_t i = 0; i < sizeof(malformed) / sizeof(malformed[0]); i++) {
+		writeFile(malformed[i]);
+		uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+		memcpy(cellSizes, staticCellSizes, sizeof(cellSizes));
+		EXPECT_FALSE(MM_SizeClasses::loadCellSizes(gcTestEnv->getPortLibrary(), TEST_SIZECLASSES_FILE, cellSizes)) << "\"" << malformed[i] << "\"";
+		EXPECT_EQ(0, memcmp(cellSizes, staticCellSizes, sizeof(cellSizes))) << "\"" << malformed[i] << "\"";
+	}
+	omrfile_unlink(TEST_SIZECLASSES_FILE);
+
+	/* no file at all */
+	uintptr_t cellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	EXPECT_FALSE(MM_SizeClasses::loadCellSizes(gcTestEnv->getPortLibrary(), TEST_SIZECLASSES_FILE, cellSizes));
+}
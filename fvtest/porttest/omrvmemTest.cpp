@@ -30,6 +30,7 @@
  * @note port library virtual memory management operations are not optional in the port library table.
  *
  */
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <errno.h>
@@ -2327,6 +2328,108 @@ TEST(PortVmemTest, vmem_test_commitOutsideOfReservedRange)
 }
 #endif /* !defined(J9ZOS390) */
 
+#if defined(LINUX)
+/**
+ * Check whether the mapping containing address carries the given VmFlags mnemonic in /proc/self/smaps.
+ */
+static BOOLEAN
+mappingHasVmFlag(void *address, const char *flag)
+{
+	BOOLEAN inMapping = FALSE;
+	BOOLEAN found = FALSE;
+	char line[512];
+	FILE *smaps = fopen("/proc/self/smaps", "r");
+
+	if (NULL != smaps) {
+		while (NULL != fgets(line, sizeof(line), smaps)) {
+			unsigned long start = 0;
+			unsigned long end = 0;
+			if (2 == sscanf(line, "%lx-%lx ", &start, &end)) {
+				inMapping = ((uintptr_t)address >= start) && ((uintptr_t)address < end);
+			} else if (inMapping && (0 == strncmp(line, "VmFlags:", 8))) {
+				char pattern[8];
+				snprintf(pattern, sizeof(pattern), " %s", flag);
+				found = (NULL != strstr(line + 8, pattern));
+				break;
+			}
+		}
+		fclose(smaps);
+	}
+	return found;
+}
+
+/**
+ * Reserve default page size memory with OMRPORT_VMEM_NO_HUGEPAGE and check it was advised against
+ * Transparent HugePages only when the port library is allowed to madvise.
+ */
+static void
+reserveNoHugepage(OMRPortLibrary *portLibrary, BOOLEAN expectAdvised, const char *testName)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	struct J9PortVmemIdentifier vmemID;
+	J9PortVmemParams params;
+	char *memPtr = NULL;
+
+	omrvmem_vmem_params_init(&params);
+	params.byteAmount = 4 * omrvmem_supported_page_sizes()[0];
+	params.mode |= OMRPORT_VMEM_MEMORY_MODE_READ | OMRPORT_VMEM_MEMORY_MODE_WRITE;
+	params.options |= OMRPORT_VMEM_NO_HUGEPAGE;
+
+	memPtr = (char *)omrvmem_reserve_memory_ex(&vmemID, &params);
+	if (NULL == memPtr) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_reserve_memory_ex failed to reserve 0x%zx bytes\n", params.byteAmount);
+	} else {
+		BOOLEAN advised = mappingHasVmFlag(memPtr, "nh");
+		if (expectAdvised != advised) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "memory reserved with OMRPORT_VMEM_NO_HUGEPAGE is %s MADV_NOHUGEPAGE, expected %s\n",
+					advised ? "advised" : "not advised", expectAdvised ? "advised" : "not advised");
+		}
+		if (0 != omrvmem_free_memory(memPtr, params.byteAmount, &vmemID)) {
+			outputErrorMessage(PORTTEST_ERROR_ARGS, "omrvmem_free_memory failed to free 0x%zx bytes\n", params.byteAmount);
+		}
+	}
+}
+
+/**
+ * Verify OMRPORT_VMEM_NO_HUGEPAGE honours the madvise setting the same way Transparent HugePage advice does:
+ * the range is only advised while THP is in madvise mode and OMRPORT_CTLDATA_VMEM_ADVISE_HUGEPAGE has not turned it off.
+ */
+TEST(PortVmemTest, vmem_test_noHugepage)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portTestEnv->getPortLibrary());
+	const char *testName = "omrvmem_test_noHugepage";
+	OMRPortLibrary privatePortLibrary;
+	BOOLEAN madviseMode = FALSE;
+	char thpMode[64];
+	intptr_t fd = -1;
+
+	reportTestEntry(OMRPORTLIB, testName);
+
+	fd = omrfile_open("/sys/kernel/mm/transparent_hugepage/enabled", EsOpenRead, 0);
+	if (fd >= 0) {
+		intptr_t bytesRead = omrfile_read(fd, thpMode, sizeof(thpMode) - 1);
+		if (bytesRead > 0) {
+			thpMode[bytesRead] = '\0';
+			madviseMode = (0 == strncmp(thpMode, "always [madvise] never", 22));
+		}
+		omrfile_close(fd);
+	}
+
+	reserveNoHugepage(OMRPORTLIB, madviseMode, testName);
+
+	/* turning madvise off is one way, so do it on a private port library */
+	if (0 != omrport_init_library(&privatePortLibrary, sizeof(OMRPortLibrary))) {
+		outputErrorMessage(PORTTEST_ERROR_ARGS, "omrport_init_library failed\n");
+	} else {
+		privatePortLibrary.port_control(&privatePortLibrary, OMRPORT_CTLDATA_VMEM_ADVISE_HUGEPAGE, 0);
+		reserveNoHugepage(&privatePortLibrary, FALSE, testName);
+		privatePortLibrary.port_shutdown_library(&privatePortLibrary);
+	}
+
+	reportTestExit(OMRPORTLIB, testName);
+}
+#endif /* defined(LINUX) */
+
 #if defined(ENABLE_RESERVE_MEMORY_EX_TESTS)
 /**
  * Verify port library memory management.
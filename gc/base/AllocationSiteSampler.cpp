@@ -0,0 +1,236 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "ModronAssertions.h"
+
+#include "AllocationSiteSampler.hpp"
+
+#include "HeapMap.hpp"
+#if defined(OMR_GC_MODRON_SCAVENGER)
+#include "ForwardedHeader.hpp"
+#include "Scavenger.hpp"
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+MM_AllocationSiteSampler *
+MM_AllocationSiteSampler::newInstance(MM_EnvironmentBase *env)
+{
+	MM_AllocationSiteSampler *sampler = (MM_AllocationSiteSampler *)env->getForge()->allocate(sizeof(MM_AllocationSiteSampler), OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL != sampler) {
+		new(sampler) MM_AllocationSiteSampler(env);
+		if (!sampler->initialize(env)) {
+			sampler->kill(env);
+			sampler = NULL;
+		}
+	}
+	return sampler;
+}
+
+void
+MM_AllocationSiteSampler::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_AllocationSiteSampler::initialize(MM_EnvironmentBase *env)
+{
+	uintptr_t tableBytes = sizeof(Site) * SITE_TABLE_SIZE;
+	_sites = (Site *)env->getForge()->allocate(tableBytes, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == _sites) {
+		return false;
+	}
+	memset((void *)_sites, 0, tableBytes);
+	return true;
+}
+
+void
+MM_AllocationSiteSampler::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _pendingSamples) {
+		env->getForge()->free(_pendingSamples);
+		_pendingSamples = NULL;
+	}
+	if (NULL != _sites) {
+		env->getForge()->free((void *)_sites);
+		_sites = NULL;
+	}
+}
+
+bool
+MM_AllocationSiteSampler::enableSurvivalTracking(MM_EnvironmentBase *env)
+{
+	Assert_MM_true(NULL == _pendingSamples);
+	_pendingSamples = (PendingSample *)env->getForge()->allocate(sizeof(PendingSample) * PENDING_SAMPLE_COUNT, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	_pendingSampleTop = 0;
+	return (NULL != _pendingSamples);
+}
+
+uintptr_t
+MM_AllocationSiteSampler::nextSampleInterval(uint64_t *seed)
+{
+	/* xorshift64 */
+	uint64_t random = *seed;
+	random ^= random << 13;
+	random ^= random >> 7;
+	random ^= random << 17;
+	*seed = random;
+
+	uint64_t range = 2 * (uint64_t)_extensions->allocationSiteSampleInterval;
+	return (uintptr_t)(1 + (random % range));
+}
+
+MM_AllocationSiteSampler::Site *
+MM_AllocationSiteSampler::findSite(uintptr_t site)
+{
+	/* multiplicative hashing, the top bits of the product select the first entry to probe */
+	uintptr_t index = (uintptr_t)(((uint64_t)site * J9CONST_U64(0x9E3779B97F4A7C15)) >> (64 - SITE_TABLE_SHIFT));
+
+	for (uintptr_t probes = 0; probes < SITE_TABLE_SIZE; probes++) {
+		Site *entry = &_sites[index];
+		uintptr_t entrySite = entry->site;
+		if (0 == entrySite) {
+			/* claim the entry, unless another thread claimed it first */
+			entrySite = MM_AtomicOperations::lockCompareExchange(&entry->site, 0, site);
+			if (0 == entrySite) {
+				return entry;
+			}
+		}
+		if (site == entrySite) {
+			return entry;
+		}
+		index = (index + 1) & (SITE_TABLE_SIZE - 1);
+	}
+
+	return NULL;
+}
+
+void
+MM_AllocationSiteSampler::recordSample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t size)
+{
+	uintptr_t site = env->getAllocationSite();
+	Site *entry = (0 == site) ? NULL : findSite(site);
+
+	if (NULL == entry) {
+		MM_AtomicOperations::add(&_unattributedSampleCount, 1);
+	} else {
+		MM_AtomicOperations::add(&entry->sampleCount, 1);
+		MM_AtomicOperations::add(&entry->sampledBytes, size);
+
+		if (NULL != _pendingSamples) {
+			/* samples taken once the pending samples are full are not checked for survival */
+			uintptr_t slot = MM_AtomicOperations::add(&_pendingSampleTop, 1) - 1;
+			if (slot < PENDING_SAMPLE_COUNT) {
+				_pendingSamples[slot].object = object;
+				_pendingSamples[slot].site = entry;
+				_pendingSamples[slot].size = size;
+			}
+		}
+	}
+}
+
+void
+MM_AllocationSiteSampler::globalMarkComplete(MM_EnvironmentBase *env, MM_HeapMap *markMap)
+{
+	if (NULL != _pendingSamples) {
+		uintptr_t pendingCount = OMR_MIN(_pendingSampleTop, (uintptr_t)PENDING_SAMPLE_COUNT);
+		for (uintptr_t i = 0; i < pendingCount; i++) {
+			if (markMap->isBitSet(_pendingSamples[i].object)) {
+				recordSurvivor(&_pendingSamples[i]);
+			}
+		}
+		_pendingSampleTop = 0;
+	}
+}
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+void
+MM_AllocationSiteSampler::scavengeComplete(MM_EnvironmentBase *env, MM_Scavenger *scavenger)
+{
+	if (NULL != _pendingSamples) {
+		uintptr_t pendingCount = OMR_MIN(_pendingSampleTop, (uintptr_t)PENDING_SAMPLE_COUNT);
+		uintptr_t keptCount = 0;
+		for (uintptr_t i = 0; i < pendingCount; i++) {
+			PendingSample *sample = &_pendingSamples[i];
+			if (scavenger->isObjectInEvacuateMemory(sample->object)) {
+				MM_ForwardedHeader forwardedHeader(sample->object);
+				if (forwardedHeader.isForwardedPointer()) {
+					recordSurvivor(sample);
+				}
+			} else {
+				/* allocated outside of the nursery, wait for a global collection */
+				_pendingSamples[keptCount] = *sample;
+				keptCount += 1;
+			}
+		}
+		_pendingSampleTop = keptCount;
+	}
+}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+uintptr_t
+MM_AllocationSiteSampler::getSites(uint32_t order, OMR_GC_AllocationSite *sites, uintptr_t count)
+{
+	uintptr_t written = 0;
+
+	/* insertion into the (short) sorted buffer of the top sites seen so far */
+	for (uintptr_t index = 0; index < SITE_TABLE_SIZE; index++) {
+		Site *entry = &_sites[index];
+		OMR_GC_AllocationSite candidate;
+		candidate.site = entry->site;
+		if (0 == candidate.site) {
+			continue;
+		}
+		candidate.sampleCount = entry->sampleCount;
+		candidate.sampledBytes = entry->sampledBytes;
+		candidate.survivorCount = entry->survivorCount;
+		candidate.survivorBytes = entry->survivorBytes;
+		candidate.estimatedBytes = (uint64_t)candidate.sampleCount * _extensions->allocationSiteSampleInterval;
+		candidate.estimatedSurvivorBytes = (uint64_t)candidate.survivorCount * _extensions->allocationSiteSampleInterval;
+
+		uintptr_t rank = getRank(&candidate, order);
+		uintptr_t position = written;
+		while ((0 < position) && (getRank(&sites[position - 1], order) < rank)) {
+			position -= 1;
+		}
+		if (position < count) {
+			uintptr_t last = OMR_MIN(written, count - 1);
+			for (uintptr_t i = last; i > position; i--) {
+				sites[i] = sites[i - 1];
+			}
+			sites[position] = candidate;
+			if (written < count) {
+				written += 1;
+			}
+		}
+	}
+
+	return written;
+}
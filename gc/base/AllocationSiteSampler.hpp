@@ -0,0 +1,200 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(ALLOCATIONSITESAMPLER_HPP_)
+#define ALLOCATIONSITESAMPLER_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "omrgc.h"
+#include "modronbase.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+class MM_HeapMap;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+class MM_Scavenger;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+/**
+ * Allocation site profiler (-Xgc:allocationSiteSampleInterval).
+ * Threads take a sample each time they have allocated a random number of bytes, uniformly distributed around the
+ * sample interval, so that the number of samples taken at a site is proportional to the bytes allocated there.
+ * The site of a sampled allocation is provided by the language (MM_EnvironmentDelegate::getAllocationSite()) and
+ * the samples are aggregated per site in a fixed size open addressing table, updated with atomic operations only.
+ * With the standard collectors each sampled object is also checked at the first collection that follows its
+ * allocation: a scavenge for objects allocated in the nursery, a global collection otherwise.  The objects which
+ * survive it are accounted to their site, so that sites can be ranked by bytes allocated or by bytes surviving.
+ * @ingroup GC_Base
+ */
+class MM_AllocationSiteSampler : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+public:
+	/**
+	 * Samples aggregated for an allocation site.
+	 */
+	struct Site {
+		volatile uintptr_t site; /**< identifier of the site returned by the language, 0 if the entry is unused */
+		volatile uintptr_t sampleCount; /**< number of allocations sampled at the site */
+		volatile uintptr_t sampledBytes; /**< total size of the allocations sampled at the site */
+		volatile uintptr_t survivorCount; /**< number of sampled allocations which survived their first collection */
+		volatile uintptr_t survivorBytes; /**< total size of the sampled allocations which survived their first collection */
+	};
+
+private:
+	/**
+	 * A sampled object, waiting for the first collection that follows its allocation.
+	 */
+	struct PendingSample {
+		omrobjectptr_t object;
+		Site *site;
+		uintptr_t size;
+	};
+
+	enum {
+		SITE_TABLE_SHIFT = 12, /**< log2 of the number of entries in the site table */
+		SITE_TABLE_SIZE = ((uintptr_t)1 << SITE_TABLE_SHIFT),
+		PENDING_SAMPLE_COUNT = 4096 /**< maximum number of sampled objects waiting for a collection */
+	};
+
+	MM_GCExtensionsBase *_extensions;
+	Site *_sites; /**< open addressing table of the sampled sites */
+	volatile uintptr_t _unattributedSampleCount; /**< samples which could not be recorded against a site (unknown site, or the table is full) */
+	PendingSample *_pendingSamples; /**< sampled objects waiting for a collection, NULL if survival is not tracked */
+	volatile uintptr_t _pendingSampleTop; /**< number of pending sample slots claimed (may exceed PENDING_SAMPLE_COUNT) */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Find the entry of a site, adding it to the table if it is not there yet.
+	 * @return the entry of the site, or NULL if the table is full
+	 */
+	Site *findSite(uintptr_t site);
+
+	/**
+	 * Account a sampled object which survived its first collection to its site.
+	 */
+	MMINLINE void
+	recordSurvivor(PendingSample *sample)
+	{
+		MM_AtomicOperations::add(&sample->site->survivorCount, 1);
+		MM_AtomicOperations::add(&sample->site->survivorBytes, sample->size);
+	}
+
+	/**
+	 * @return the value used to rank a site in the given order (one of OMR_GC_ALLOCATION_SITES_BY_*)
+	 */
+	MMINLINE uintptr_t
+	getRank(OMR_GC_AllocationSite *site, uint32_t order)
+	{
+		return (OMR_GC_ALLOCATION_SITES_BY_SURVIVAL == order) ? site->survivorCount : site->sampleCount;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_AllocationSiteSampler *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Check whether sampled objects survive their first collection.  Only for collectors which call
+	 * globalMarkComplete() and scavengeComplete(), the pending samples are never updated for moved objects otherwise.
+	 * @return true on success, false if the pending samples could not be allocated
+	 */
+	bool enableSurvivalTracking(MM_EnvironmentBase *env);
+
+	/**
+	 * Pick the number of bytes a thread allocates before its next sample.
+	 * @param[in/out] seed the random state of the thread
+	 * @return a number of bytes uniformly distributed in [1, 2 x sample interval]
+	 */
+	uintptr_t nextSampleInterval(uint64_t *seed);
+
+	/**
+	 * Record a sampled allocation.  May be called concurrently by any number of threads.
+	 * @param object the sampled object, which may not be initialized yet
+	 * @param size size of the sampled object in bytes
+	 */
+	void recordSample(MM_EnvironmentBase *env, omrobjectptr_t object, uintptr_t size);
+
+	/**
+	 * Account the pending samples that are marked as survivors, after the mark phase of a global collection and
+	 * before objects can be moved.  All pending samples have had their first collection afterwards.
+	 * @note Called by the master GC thread with exclusive access.
+	 */
+	void globalMarkComplete(MM_EnvironmentBase *env, MM_HeapMap *markMap);
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Account the pending samples in the evacuate space that were copied by a successful scavenge, while their
+	 * forwarding headers are still in place.  Samples outside the evacuate space are kept for a global collection.
+	 * @note Called by the master GC thread with exclusive access.
+	 */
+	void scavengeComplete(MM_EnvironmentBase *env, MM_Scavenger *scavenger);
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+	/**
+	 * Copy the top sites in the given order into a buffer, highest first.  Estimates of the allocated and
+	 * surviving bytes are derived from the sample counts and the sample interval.
+	 * @param order one of OMR_GC_ALLOCATION_SITES_BY_BYTES or OMR_GC_ALLOCATION_SITES_BY_SURVIVAL
+	 * @param sites buffer receiving the sites
+	 * @param count number of entries in sites
+	 * @return the number of sites written
+	 */
+	uintptr_t getSites(uint32_t order, OMR_GC_AllocationSite *sites, uintptr_t count);
+
+	/**
+	 * @return the number of samples that could not be recorded against a site
+	 */
+	MMINLINE uintptr_t getUnattributedSampleCount() { return _unattributedSampleCount; }
+
+	MM_AllocationSiteSampler(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _sites(NULL)
+		, _unattributedSampleCount(0)
+		, _pendingSamples(NULL)
+		, _pendingSampleTop(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* ALLOCATIONSITESAMPLER_HPP_ */
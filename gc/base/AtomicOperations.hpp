@@ -288,6 +288,34 @@ public:
 		return VM_AtomicSupport::subtractU64(address, value);
 	}
 
+	/**
+	 * ANDs mask into the value at a specific memory location as an atomic operation.
+	 *
+	 * @param address The memory location to be updated
+	 * @param mask The bits to be kept
+	 *
+	 * @return The value at memory location <b>address</b> BEFORE the operation
+	 */
+	MMINLINE_DEBUG static uintptr_t
+	bitAnd(volatile uintptr_t *address, uintptr_t mask)
+	{
+		return VM_AtomicSupport::bitAnd(address, mask);
+	}
+
+	/**
+	 * ORs mask into the value at a specific memory location as an atomic operation.
+	 *
+	 * @param address The memory location to be updated
+	 * @param mask The bits to be set
+	 *
+	 * @return The value at memory location <b>address</b> BEFORE the operation
+	 */
+	MMINLINE_DEBUG static uintptr_t
+	bitOr(volatile uintptr_t *address, uintptr_t mask)
+	{
+		return VM_AtomicSupport::bitOr(address, mask);
+	}
+
 	/**
 	 * Store value at memory location.
 	 * Stores <b>value</b> at memory location pointed to be <b>address</b>.
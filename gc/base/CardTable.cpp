@@ -25,6 +25,7 @@
 #include "CardTable.hpp"
 
 #include "AtomicOperations.hpp"
+#include "Bits.hpp"
 #include "CardCleaner.hpp"
 #include "GCExtensionsBase.hpp"
 #include "EnvironmentBase.hpp"
@@ -33,6 +34,7 @@
 #include "MemoryManager.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "Dispatcher.hpp"
+#include "Math.hpp"
 #include "Task.hpp"
 
 #include "ModronAssertions.h"
@@ -71,6 +73,105 @@ MM_CardTable::tearDown(MM_EnvironmentBase *env)
 	MM_MemoryManager *memoryManager = extensions->memoryManager;
 	/* Get rid of the virtual memory allocated for card table */
 	memoryManager->destroyVirtualMemory(env, &_cardTableMemoryHandle);
+
+	if (NULL != _summaryBits) {
+		env->getForge()->free(_summaryBits);
+		_summaryBits = NULL;
+	}
+}
+
+bool
+MM_CardTable::initializeSummary(MM_EnvironmentBase *env, MM_Heap *heap)
+{
+	uintptr_t cardCount = calculateCardTableSize(env, heap->getMaximumPhysicalRange()) / sizeof(Card);
+	uintptr_t groupCount = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, cardCount) / CARD_SUMMARY_CARDS_PER_BIT;
+	uintptr_t slotCount = MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, groupCount) / J9BITS_BITS_IN_SLOT;
+
+	_summaryBits = (uintptr_t *)env->getForge()->allocate(slotCount * sizeof(uintptr_t), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _summaryBits) {
+		return false;
+	}
+	memset(_summaryBits, 0, slotCount * sizeof(uintptr_t));
+	_summarySlots = slotCount;
+	return true;
+}
+
+void
+MM_CardTable::clearSummary(Card *lowCard, Card *highCard)
+{
+	if (NULL != _summaryBits) {
+		/* only groups wholly within the range are cleared - a group partly outside it may hold unclean cards */
+		uintptr_t group = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, (uintptr_t)(lowCard - _cardTableStart)) / CARD_SUMMARY_CARDS_PER_BIT;
+		uintptr_t topGroup = (uintptr_t)(highCard - _cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+		while (group < topGroup) {
+			uintptr_t slot = group / J9BITS_BITS_IN_SLOT;
+			uintptr_t bitIndex = group % J9BITS_BITS_IN_SLOT;
+			uintptr_t bitCount = OMR_MIN(J9BITS_BITS_IN_SLOT - bitIndex, topGroup - group);
+			uintptr_t mask = (J9BITS_BITS_IN_SLOT == bitCount) ? ~(uintptr_t)0 : ((((uintptr_t)1 << bitCount) - 1) << bitIndex);
+			/* neighbouring ranges may be cleared by other threads, so the slots are updated atomically */
+			MM_AtomicOperations::bitAnd(&_summaryBits[slot], ~mask);
+			group += bitCount;
+		}
+	}
+}
+
+Card *
+MM_CardTable::skipCleanCardGroups(Card *card, Card *topCard)
+{
+	uintptr_t group = (uintptr_t)(card - _cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+	uintptr_t topGroup = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, (uintptr_t)(topCard - _cardTableStart)) / CARD_SUMMARY_CARDS_PER_BIT;
+	uintptr_t slotIndex = group / J9BITS_BITS_IN_SLOT;
+	uintptr_t bits = _summaryBits[slotIndex] & (~(uintptr_t)0 << (group % J9BITS_BITS_IN_SLOT));
+
+	if (0 == bits) {
+		/* skip the empty slots of the summary, each covering J9BITS_BITS_IN_SLOT groups of cards */
+		uintptr_t topSlotIndex = MM_Math::roundToCeiling(J9BITS_BITS_IN_SLOT, topGroup) / J9BITS_BITS_IN_SLOT;
+		do {
+			slotIndex += 1;
+			if (slotIndex >= topSlotIndex) {
+				return topCard;
+			}
+			bits = _summaryBits[slotIndex];
+		} while (0 == bits);
+	}
+
+	uintptr_t summarizedGroup = (slotIndex * J9BITS_BITS_IN_SLOT) + MM_Bits::leadingZeroes(bits);
+	if (summarizedGroup == group) {
+		return card;
+	}
+	Card *summarizedCard = _cardTableStart + (summarizedGroup * CARD_SUMMARY_CARDS_PER_BIT);
+	return OMR_MIN(summarizedCard, topCard);
+}
+
+uintptr_t
+MM_CardTable::rebuildSummary(MM_EnvironmentBase *env, Card *lowCard, Card *highCard)
+{
+	uintptr_t summarizedGroups = 0;
+	uintptr_t group = MM_Math::roundToCeiling(CARD_SUMMARY_CARDS_PER_BIT, (uintptr_t)(lowCard - _cardTableStart)) / CARD_SUMMARY_CARDS_PER_BIT;
+	uintptr_t topGroup = (uintptr_t)(highCard - _cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+
+	for (; group < topGroup; group++) {
+		volatile uintptr_t *summarySlot = &_summaryBits[group / J9BITS_BITS_IN_SLOT];
+		uintptr_t mask = (uintptr_t)1 << (group % J9BITS_BITS_IN_SLOT);
+		if (0 == (*summarySlot & mask)) {
+			/* no card in the group has been dirtied since the bit was last cleared */
+			continue;
+		}
+
+		/* The bit is cleared before the cards are read: a card dirtied after it is read is summarized
+		 * again by the thread which dirtied it, as summarizeCard() follows the write to the card.
+		 */
+		MM_AtomicOperations::bitAnd(summarySlot, ~mask);
+
+		uintptr_t *cardSlot = (uintptr_t *)(_cardTableStart + (group * CARD_SUMMARY_CARDS_PER_BIT));
+		uintptr_t *cardSlotTop = cardSlot + (CARD_SUMMARY_CARDS_PER_BIT / sizeof(uintptr_t));
+		if (cardSlotTop != env->getExtensions()->heapMapScan.skipEmptySlots(cardSlot, cardSlotTop)) {
+			MM_AtomicOperations::bitOr(summarySlot, mask);
+			summarizedGroups += 1;
+		}
+	}
+
+	return summarizedGroups;
 }
 
 uintptr_t
@@ -256,6 +357,7 @@ MM_CardTable::dirtyCardWithValue(MM_EnvironmentBase *env, omrobjectptr_t objectR
 		if (newValue != oldValue) {
 			Assert_MM_true((CARD_DIRTY == newValue) || (CARD_CLEAN == oldValue));
 			*card = newValue;
+			summarizeCard(card);
 		}
 	}
 }
@@ -270,6 +372,7 @@ MM_CardTable::dirtyCardRange(MM_EnvironmentBase *env, void *heapAddrFrom, void *
 		/* If card not already dirty then dirty it */
 		if ((Card)CARD_DIRTY != *card) {
 			*card = (Card)CARD_DIRTY;
+			summarizeCard(card);
 		}
 	}
 }
@@ -378,6 +481,8 @@ MM_CardTable::clearCardsInRange(MM_EnvironmentBase *env, void* heapBase, void* h
 	Card *lastCard = heapAddrToCardAddr(env,heapTop);
 	uintptr_t sizeToClear = (uint8_t *)lastCard - (uint8_t *)firstCard;
 
+	clearSummary(firstCard, lastCard);
+
 	/* We can't use OMRZeroMemory() here as that requires the  area to
 	 * be cleared to be uintptr_t aligned
 	 */
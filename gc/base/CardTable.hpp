@@ -33,9 +33,13 @@
 #include "omrmodroncore.h"
 #include "modronbase.h"
 
+#include "AtomicOperations.hpp"
 #include "BaseVirtual.hpp"
 #include "MemoryManager.hpp"
 
+/* Number of cards covered by one bit of the card summary */
+#define CARD_SUMMARY_CARDS_PER_BIT 64
+
 class MM_EnvironmentBase;
 class MM_CardCleaner;
 class MM_Heap;
@@ -62,6 +66,8 @@ private:
 	Card *_cardTableStart;
 	Card *_cardTableVirtualStart;
 	void *_heapBase; 
+	uintptr_t *_summaryBits; /**< one bit per CARD_SUMMARY_CARDS_PER_BIT cards, set whenever one of the cards may not be clean (NULL if no summary is kept) */
+	uintptr_t _summarySlots; /**< number of slots in _summaryBits */
 
 
 public:
@@ -84,6 +90,40 @@ public:
 	 */
 	void *getHeapBase() { return _heapBase; };
 
+	/**
+	 * @return true if the card table keeps a summary of the unclean cards
+	 */
+	MMINLINE bool isSummaryEnabled() { return NULL != _summaryBits; }
+
+	/**
+	 * Record in the card summary that the given card may not be clean.  Must be called after the card is written.
+	 * The update is atomic (and unconditional) so that it can not be lost to a concurrent rebuild of the summary.
+	 * @param[in] card The card which has been dirtied
+	 */
+	MMINLINE void
+	summarizeCard(Card *card)
+	{
+		if (NULL != _summaryBits) {
+			uintptr_t group = (uintptr_t)(card - _cardTableStart) / CARD_SUMMARY_CARDS_PER_BIT;
+			MM_AtomicOperations::bitOr(&_summaryBits[group / J9BITS_BITS_IN_SLOT], (uintptr_t)1 << (group % J9BITS_BITS_IN_SLOT));
+		}
+	}
+
+	/**
+	 * Find the first card at or after card whose summary bit is set.
+	 * @param[in] card The card to start from
+	 * @param[in] topCard The card to stop at (exclusive)
+	 * @return card if its summary bit is set, else the first card of the next summarized group of cards, or topCard if there is none before it
+	 */
+	Card *skipCleanCardGroups(Card *card, Card *topCard);
+
+	/**
+	 * Rebuild the card summary for the groups of cards wholly within [lowCard, highCard), clearing the bit for
+	 * each group which no longer holds an unclean card.  Safe against concurrent dirtying of the cards.
+	 * @return the number of groups found to hold unclean cards
+	 */
+	uintptr_t rebuildSummary(MM_EnvironmentBase *env, Card *lowCard, Card *highCard);
+
 	/**
 	 * Checks if card is dirty or has a specific value
  	 * @param[in] env A GC thread
@@ -245,6 +285,19 @@ protected:
 	 */
 	bool initialize(MM_EnvironmentBase *env, MM_Heap *heap);
 	virtual void tearDown(MM_EnvironmentBase *env);
+
+	/**
+	 * Allocate the card summary, with one bit for every CARD_SUMMARY_CARDS_PER_BIT cards of the maximum heap.
+	 * The summary is only correct if every write of an unclean value to a card is followed by summarizeCard().
+	 * @return false if the summary could not be allocated
+	 */
+	bool initializeSummary(MM_EnvironmentBase *env, MM_Heap *heap);
+
+	/**
+	 * Clear the summary bits for the groups of cards wholly within [lowCard, highCard).
+	 * @note The cards must be cleared after the summary, so that a card dirtied in between is summarized again.
+	 */
+	void clearSummary(Card *lowCard, Card *highCard);
 	
 	/**
 	 * Commits the card table range between lowCard and highCard:  [lowCard, highCard)
@@ -268,6 +321,8 @@ protected:
 		, _cardTableStart(NULL)
 		, _cardTableVirtualStart(NULL)
 		, _heapBase(NULL)
+		, _summaryBits(NULL)
+		, _summarySlots(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -30,6 +30,7 @@
 
 #include "Configuration.hpp"
 
+#include "AllocationSiteSampler.hpp"
 #include "Debug.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -72,8 +73,13 @@ MM_Configuration::initialize(MM_EnvironmentBase* env)
 			if (initializeNUMAManager(env)) {
 				initializeGCThreadCount(env);
 				initializeGCParameters(env);
+				extensions->heapMapScan.initialize(extensions->vectorHeapMapScan);
 				extensions->_lightweightNonReentrantLockPool = pool_new(sizeof(J9ThreadMonitorTracing), 0, 0, 0, OMR_GET_CALLSITE(), OMRMEM_CATEGORY_MM, POOL_FOR_PORT(env->getPortLibrary()));
 				result = (NULL != extensions->_lightweightNonReentrantLockPool);
+				if (result && (0 != extensions->allocationSiteSampleInterval)) {
+					extensions->allocationSiteSampler = MM_AllocationSiteSampler::newInstance(env);
+					result = (NULL != extensions->allocationSiteSampler);
+				}
 			}
 		}
 	}
@@ -136,6 +142,11 @@ MM_Configuration::tearDown(MM_EnvironmentBase* env)
 		extensions->heapRegionManager = NULL;
 	}
 
+	if (NULL != extensions->allocationSiteSampler) {
+		extensions->allocationSiteSampler->kill(env);
+		extensions->allocationSiteSampler = NULL;
+	}
+
 	if (NULL != extensions->_lightweightNonReentrantLockPool) {
 		pool_kill(extensions->_lightweightNonReentrantLockPool);
 		extensions->_lightweightNonReentrantLockPool = NULL;
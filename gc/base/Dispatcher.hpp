@@ -74,6 +74,10 @@ public:
 	MMINLINE virtual uintptr_t threadCountMaximum() { return 1; }
 	MMINLINE virtual uintptr_t activeThreadCount() { return 1; }
 	MMINLINE virtual void setThreadCount(uintptr_t threadCount) {}
+	/**
+	 * @return time (in microseconds) the slave threads took to pick up the last task dispatched to them
+	 */
+	MMINLINE virtual uint64_t getTaskSpinUpTime() { return 0; }
 
 	void run(MM_EnvironmentBase *env, MM_Task *task, uintptr_t threadCount = UDATA_MAX);
 	virtual void reinitAfterFork(MM_EnvironmentBase *env, uintptr_t newThreadCount) {}
@@ -113,6 +113,11 @@ MM_EnvironmentBase::initialize(MM_GCExtensionsBase *extensions)
 		if (NULL == _regionLocalFull) {
 			return false;
 		}
+		_segregatedRememberedSet.count = 0;
+		_segregatedRememberedSet.fragmentCurrent = NULL;
+		_segregatedRememberedSet.fragmentTop = NULL;
+		_segregatedRememberedSet.fragmentSize = (uintptr_t)OMR_SCV_REMSET_FRAGMENT_SIZE;
+		_segregatedRememberedSet.parentList = &extensions->rememberedSet;
 	}
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
@@ -557,3 +562,44 @@ MM_EnvironmentBase::restoreObjects(omrobjectptr_t *objectPtrIndirect)
 		Assert_MM_unreachable();
 	}
 }
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+uintptr_t
+MM_EnvironmentBase::assignNumaNurseryNode()
+{
+	MM_GCExtensionsBase *extensions = getExtensions();
+	MM_NUMAManager *numaManager = &extensions->_numaManager;
+	uintptr_t leaderCount = 0;
+	J9MemoryNodeDetail const *leaders = numaManager->getAffinityLeaders(&leaderCount);
+	uintptr_t node = 0;
+
+	if (0 == leaderCount) {
+		return 1;
+	}
+
+	if (numaManager->isPhysicalNUMASupported()) {
+		/* keep the node the thread has already been bound to */
+		uintptr_t j9NodeNumber = getNumaAffinity();
+		for (uintptr_t i = 0; (0 != j9NodeNumber) && (i < leaderCount); i++) {
+			if (leaders[i].j9NodeNumber == j9NodeNumber) {
+				node = i + 1;
+				break;
+			}
+		}
+	}
+
+	if (0 == node) {
+		if (MUTATOR_THREAD == _threadType) {
+			node = ((MM_AtomicOperations::add(&extensions->numaAwareNurseryNextNode, 1) - 1) % leaderCount) + 1;
+		} else {
+			node = (_slaveID % leaderCount) + 1;
+		}
+		if (numaManager->isPhysicalNUMASupported() && numaManager->shouldSetCPUAffinity()) {
+			uintptr_t j9NodeNumber = leaders[node - 1].j9NodeNumber;
+			setNumaAffinity(&j9NodeNumber, 1);
+		}
+	}
+
+	return node;
+}
+#endif /* OMR_GC_MODRON_SCAVENGER */
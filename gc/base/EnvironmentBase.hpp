@@ -27,6 +27,7 @@
 #include "modronbase.h"
 #include "omr.h"
 #include "thread_api.h"
+#include "j9nongenerated.h"
 
 #include "BaseVirtual.hpp"
 #include "CardCleaningStats.hpp"
@@ -105,6 +106,9 @@ private:
 	bool _exclusiveAccessBeatenByOtherThread; /**< true if last exclusive access request had to wait for another GC thread */
 	uintptr_t _exclusiveCount; /**< count of number of times this thread has acquired but not yet released exclusive access */
 	OMR_VMThread* _cachedGCExclusiveAccessThreadId; /** only to be used when a thread requests a GC operation while already holding exclusive VM access */
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	uintptr_t _numaNurseryNode; /**< affinity leader (starting from 1) whose nursery slice this thread allocates from, 0 if not yet assigned */
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 protected:
 	bool _allocationFailureReported;	/**< verbose: used to report af-start/af-end once per allocation failure even more then one GC cycle need to resolve AF */
@@ -160,6 +164,7 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SegregatedAllocationTracker* _allocationTracker; /**< tracks bytes allocated per thread and periodically flushes allocation data to MM_MemoryPoolSegregated */
+	J9VMGC_SublistFragment _segregatedRememberedSet; /**< Thread local fragment of the remembered set of the generational segregated heap (the snapshot set in incremental mode) */
 #endif /* OMR_GC_SEGREGATED_HEAP */
 
 	volatile uint32_t _allocationColor; /**< Flag field to indicate whether premarking is enabled on the thread */
@@ -321,6 +326,32 @@ public:
 	 * @return true on success, false on failure 
 	 */
 	MMINLINE bool setNumaAffinity(uintptr_t *numaNodes, uintptr_t arrayLength) { return 0 == omrthread_numa_set_node_affinity(_omrVMThread->_os_thread, numaNodes, arrayLength, 0); }
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	/**
+	 * Determine the affinity leader whose nursery slice this thread allocates TLHs and copy caches from (used
+	 * when numaAwareNursery is enabled).  The node is assigned on first use and does not change afterwards.
+	 *
+	 * @return the index of the affinity leader, where 1 is the first leader
+	 */
+	MMINLINE uintptr_t
+	getNumaNurseryNode()
+	{
+		if (0 == _numaNurseryNode) {
+			_numaNurseryNode = assignNumaNurseryNode();
+		}
+		return _numaNurseryNode;
+	}
+
+	/**
+	 * Pick the affinity leader for getNumaNurseryNode(): the node the thread is already bound to if any, otherwise
+	 * GC threads are spread across the nodes by slave ID and mutator threads round robin.  If physical NUMA is
+	 * supported, the thread is bound to the processors of the node it was given.
+	 *
+	 * @return the index of the affinity leader, where 1 is the first leader
+	 */
+	uintptr_t assignNumaNurseryNode();
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		
 	/**
 	 * Get the threads slave id.
@@ -400,6 +431,12 @@ public:
 	 */
 	bool objectAllocationNotify(omrobjectptr_t omrObject) { return _delegate.objectAllocationNotify(omrObject); }
 
+	/**
+	 * Identify the site of the allocation being sampled by the allocation site sampler.
+	 * @return an identifier for the allocation site, or 0 if the site is unknown
+	 */
+	uintptr_t getAllocationSite() { return _delegate.getAllocationSite(); }
+
 	/**
 	 *	Verbose: allocation Failure Start Report if required
 	 *	set flag allocation Failure Start Report required
@@ -630,6 +667,9 @@ public:
 		,_exclusiveAccessBeatenByOtherThread(false)
 		,_exclusiveCount(0)
 		,_cachedGCExclusiveAccessThreadId(NULL)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_numaNurseryNode(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_allocationFailureReported(false)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_regionWorkList(NULL)
@@ -682,6 +722,9 @@ public:
 		,_exclusiveAccessBeatenByOtherThread(false)
 		,_exclusiveCount(0)
 		,_cachedGCExclusiveAccessThreadId(NULL)
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		,_numaNurseryNode(0)
+#endif /* OMR_GC_MODRON_SCAVENGER */
 		,_allocationFailureReported(false)
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		,_regionWorkList(NULL)
@@ -93,12 +93,12 @@ MM_GCExtensionsBase::initialize(MM_EnvironmentBase* env)
 #endif /* OMR_GC_MODRON_STANDARD */
 
 
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_SEGREGATED_HEAP)
 	if (!rememberedSet.initialize(env, OMR::GC::AllocationCategory::REMEMBERED_SET)) {
 		goto failed;
 	}
 	rememberedSet.setGrowSize(OMR_SCV_REMSET_SIZE);
-#endif /* OMR_GC_MODRON_SCAVENGER */
+#endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_SEGREGATED_HEAP */
 
 #if defined(J9MODRON_USE_CUSTOM_SPINLOCKS)
 	lnrlOptions.spinCount1 = 256;
@@ -221,9 +221,17 @@ MM_GCExtensionsBase::validateDefaultPageParameters(uintptr_t pageSize, uintptr_t
 void
 MM_GCExtensionsBase::tearDown(MM_EnvironmentBase* env)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_SEGREGATED_HEAP)
 	rememberedSet.tearDown(env);
-#endif /* OMR_GC_MODRON_SCAVENGER */
+#endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_SEGREGATED_HEAP */
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (NULL != sizeClassesFile) {
+		OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+		omrmem_free_memory(sizeClassesFile);
+		sizeClassesFile = NULL;
+	}
+#endif /* OMR_GC_SEGREGATED_HEAP */
 
 #if defined(OMR_GC_REALTIME)
 	if (_omrVM->_gcCycleOnMonitor) {
@@ -37,6 +37,7 @@
 #include "Forge.hpp"
 #include "GlobalGCStats.hpp"
 #include "GlobalVLHGCStats.hpp"
+#include "HeapMapScan.hpp"
 #include "LargeObjectAllocateStats.hpp"
 #include "MemoryHandle.hpp"
 #include "MixedObjectModel.hpp"
@@ -47,6 +48,7 @@
 #include "ScavengerStats.hpp"
 #include "SublistPool.hpp"
 
+class MM_AllocationSiteSampler;
 class MM_CardTable;
 class MM_ClassLoaderRememberedSet;
 class MM_CollectorLanguageInterface;
@@ -198,6 +200,7 @@ private:
 	void* _guaranteedNurseryEnd; /**< highest address guaranteed to be in the nursery */
 
 	bool _isRememberedSetInOverflow;
+	bool _isRememberedSetInCardOverflow; /**< set if remembered objects have been recorded by card (see scavengerRememberedSetCardOverflow) */
 
 	volatile BackOutState _backOutState; /**< set if a thread is unable to copy an object due to lack of free space in both Survivor and Tenure */
 	volatile bool _concurrentGlobalGCInProgress; /**< set to true if concurrent Global GC is in progress */
@@ -252,6 +255,8 @@ public:
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	/* Temporary move from the leaf implementation */
 	bool concurrentSweep;
+	uintptr_t concurrentSweepBackgroundThreads; /**< number of GC threads sweeping in the background after a global collection */
+	bool concurrentSweepBackgroundThreadsForced; /**< true if concurrentSweepBackgroundThreads set via command line option */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 	bool largePageWarnOnError;
@@ -261,9 +266,13 @@ public:
 	uintptr_t requestedPageFlags;
 	uintptr_t gcmetadataPageSize;
 	uintptr_t gcmetadataPageFlags;
+	bool transparentHugePageLayout; /**< Reserve and commit the heap and its dense metadata (mark map) in whole transparent huge pages, and keep sparse metadata off them, default is false */
+	uintptr_t transparentHugePageSize; /**< Size of a transparent huge page, used by transparentHugePageLayout */
 
-#if defined(OMR_GC_MODRON_SCAVENGER)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SublistPool rememberedSet;
+#endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_MODRON_SCAVENGER)
 	uintptr_t oldHeapSizeOnLastGlobalGC;
 	uintptr_t freeOldHeapSizeOnLastGlobalGC;
 	float concurrentKickoffTenuringHeadroom; /**< percentage of free memory remaining in tenure heap. Used in conjunction with free memory to determine concurrent mark kickoff */
@@ -292,6 +301,8 @@ public:
 	uintptr_t frequentObjectAllocationSamplingRate; /**< # bytes to sample / # bytes allocated */
 	MM_FrequentObjectsStats* frequentObjectsStats;
 	uint32_t frequentObjectAllocationSamplingDepth; /**< # of frequent objects we'd like to report */
+	uintptr_t allocationSiteSampleInterval; /**< average # of bytes a thread allocates between allocation site samples, 0 to disable allocation site sampling */
+	MM_AllocationSiteSampler *allocationSiteSampler; /**< aggregates the allocation site samples, NULL if allocation site sampling is disabled */
 
 	uint32_t estimateFragmentation; /**< Enable estimate fragmentation, NO_ESTIMATE_FRAGMENTATION, LOCALGC_ESTIMATE_FRAGMENTATION, GLOBALGC_ESTIMATE_FRAGMENTATION(default) */
 	bool processLargeAllocateStats; /**< Enable process LargeObjectAllocateStats */
@@ -322,6 +333,8 @@ public:
 	uintptr_t tlhIncrementSize;
 	uintptr_t tlhSurvivorDiscardThreshold; /**< below this size GC (Scavenger) will discard survivor copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
 	uintptr_t tlhTenureDiscardThreshold; /**< below this size GC (Scavenger) will discard tenure copy cache TLH, if alloc not succeeded (otherwise we reuse memory for next TLH) */
+	bool tlhAdaptiveSizing; /**< if true, each thread sizes its TLHs from its own allocation rate and the expected time to the next GC (-Xgc:tlhAdaptiveSizing) */
+	volatile uintptr_t tlhAllocationRate; /**< sum of the TLH allocation rates (bytes per millisecond) of the threads which refreshed a TLH since their caches were last flushed, with tlhAdaptiveSizing */
 
 	MM_AllocationStats allocationStats; /**< Statistics for allocations. */
 	uintptr_t bytesAllocatedMost;
@@ -331,6 +344,7 @@ public:
 	uintptr_t splitFreeListSplitAmount;
 	uintptr_t splitFreeListNumberChunksPrepared; /**< Used in MPSAOL postProcess. Shared for all MPSAOLs. Do not overwrite during postProcess for any MPSAOL. */
 	bool enableHybridMemoryPool;
+	bool freeListBins; /**< if true, address ordered free lists index their entries by size to speed up allocate searches (-Xgc:freeListBins) */
 
 	bool largeObjectArea;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
@@ -377,9 +391,14 @@ public:
 	uintptr_t workpacketCount; /**< this value is ONLY set if -Xgcworkpackets is specified - otherwise the workpacket count is determined heuristically */
 	uintptr_t packetListSplit; /**< the number of ways to split packet lists, set by -XXgc:packetListLockSplit=, or determined heuristically based on the number of GC threads */
 	uintptr_t cacheListSplit; /**< the number of ways to split scanCache lists, set by -XXgc:cacheListLockSplit=, or determined heuristically based on the number of GC threads */
+	bool packetListLockFree; /**< push and pop work packets with a compare and swap on the packet list heads rather than under the packet list locks */
+	uintptr_t workPacketMagazineSize; /**< number of empty, and of full, work packets each thread keeps to itself during a parallel mark (0 disables the magazines) */
+	bool adaptiveWorkPacketSize; /**< limit the capacity of new output packets while threads are waiting for work, so that work is handed over sooner */
+	uintptr_t workPacketSpillMaximum; /**< bytes of marking work which may be copied out of full packets when no packet can be allocated, before work packet overflow (0 disables spilling) */
 	
 	uintptr_t markingArraySplitMaximumAmount; /**< maximum number of elements to split array scanning work in marking scheme */
 	uintptr_t markingArraySplitMinimumAmount; /**< minimum number of elements to split array scanning work in marking scheme */
+	uintptr_t markingPrefetchDepth; /**< number of objects popped from the work stack and prefetched ahead of being scanned by the marking scheme (0 disables the lookahead) */
 
 	bool rootScannerStatsEnabled; /**< Enable/disable recording of performance statistics for the root scanner.  Defaults to false. */
 	bool rootScannerStatsUsed; /**< Flag that indicates if rootScannerStats are used for in the last increment (by any thread, for any of its roots) */
@@ -395,6 +414,7 @@ public:
 	bool fvtest_forcePoisonEvacuate; /**< if true poison Evacuate space with pattern at the end of scavenge */
 	bool fvtest_forceNurseryResize;
 	uintptr_t fvtest_nurseryResizeCounter;
+	uintptr_t fvtest_rememberedSetMaxSize; /**< if non-zero, the remembered set can not grow beyond this many bytes, so that it overflows */
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 	bool fvtest_alwaysApplyOverflowRounding; /**< always round down the allocated heap as if overflow rounding were required */
@@ -405,6 +425,8 @@ public:
 	bool fvtest_tarokVerifyMarkMapClosure; /**< True if the collector should verify that the new mark map defines a consistent and closed object graph after a GMP finishes creating it */
 #endif /* defined(OMR_GC_VLHGC) */
 	bool fvtest_disableInlineAllocation; /**< True if inline allocation should be disabled (i.e. force out-of-line paths) */
+	bool fvtest_verifyFreeListBins; /**< True if address ordered free lists should check their bins against the free list whenever they use or update them (see freeListBins) */
+	uintptr_t fvtest_tlhAllocationRate; /**< if non-zero, tlhAdaptiveSizing samples this allocation rate (bytes per millisecond) instead of timing the thread, so that refresh sizes are reproducible */
 
 	uintptr_t fvtest_forceSweepChunkArrayCommitFailure; /**< Force failure at Sweep Chunk Array commit operation */
 	uintptr_t fvtest_forceSweepChunkArrayCommitFailureCounter; /**< Force failure at Sweep Chunk Array commit operation counter */
@@ -434,6 +456,7 @@ public:
 	uintptr_t gcThreadCount; /**< Initial number of GC threads - chosen default or specified in java options*/
 	bool gcThreadCountForced; /**< true if number of GC threads is specified in java options. Currently we have a few ways to do this:
 										-Xgcthreads		-Xthreads= (RT only)	-XthreadCount= */
+	bool gcThreadParking; /**< idle GC slave threads park individually and only the threads a task is dispatched to are woken */
 
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 	enum ScavengerScanOrdering {
@@ -462,6 +485,9 @@ public:
 	bool concurrentScavengerBackgroundThreadsForced; /**< true if concurrentScavengerBackgroundThreads set via command line option */
 	uintptr_t concurrentScavengerSlack; /**< amount of bytes added on top of avearge allocated bytes during concurrent cycle, in calcualtion for survivor size */
 	float concurrentScavengerAllocDeviationBoost; /**< boost factor for allocate rate and its deviation, used for tilt calcuation in Concurrent Scavenger */
+	bool concurrentScavengerAdaptive; /**< if true, each scavenge cycle runs either concurrently or stop-the-world, whichever the Concurrent Scavenger cost model predicts to be cheaper */
+	uintptr_t concurrentScavengerAdaptiveProbeInterval; /**< number of consecutive stop-the-world cycles after which the adaptive mode runs a concurrent cycle to measure the read barrier cost again */
+	bool concurrentScavengerStopTheWorldCycle; /**< true while a cycle picked by the adaptive mode runs stop-the-world, although Concurrent Scavenger is enabled */
 #endif	/* OMR_GC_CONCURRENT_SCAVENGER */
 	uintptr_t scavengerFailedTenureThreshold;
 	uintptr_t maxScavengeBeforeGlobal;
@@ -491,6 +517,19 @@ public:
 	double dnssMinimumContraction;
 	bool enableSplitHeap; /**< true if we are using gencon with -Xgc:splitheap (we will fail to boostrap if we can't allocate both ranges) */
 	double aliasInhibitingThresholdPercentage; /**< percentage of threads that can be blocked before copy cache aliasing is inhibited (set through aliasInhibitingThresholdPercentage=) */
+	bool scavengerWorkStealing; /**< if true, each GC thread keeps its scan caches in a private deque that idle threads steal from, instead of using the shared scan cache list and monitor */
+	uintptr_t scavengerWorkStealingDequeSize; /**< number of entries in each GC thread's scan cache deque (power of two); caches that do not fit go to the shared scan cache list */
+	bool scavengerHotFieldProfiling; /**< if true, the Scavenger samples parent to child references per object type and copies the hot children of each copied object right after it */
+	uintptr_t scavengerHotFieldSampleRate; /**< the hot field profiler samples one of every scavengerHotFieldSampleRate copied references */
+	bool scavengerRememberedSetBatching; /**< if true, the remembered set puddles are split into batches of scavengerRememberedSetBatchSize entries which GC threads claim atomically */
+	uintptr_t scavengerRememberedSetBatchSize; /**< number of remembered set entries in a batch */
+	bool scavengerRememberedSetCardOverflow; /**< if true, remembered objects which do not fit into the remembered set are recorded by card instead of overflowing the whole remembered set */
+	bool numaAwareNursery; /**< if true, each semispace is split into one slice per NUMA affinity leader, and TLHs and survivor copy caches are allocated from the slice of the thread's node */
+	volatile uintptr_t numaAwareNurseryNextNode; /**< round robin counter used to assign a NUMA node to mutator threads which have no node affinity */
+	uintptr_t scavengerPauseTarget; /**< target for the 99th percentile scavenge pause in milliseconds, zero (default) sizes the nursery with the dnss ratios and tilt instead */
+	double scavengerThroughputGoal; /**< minimum fraction of time left to the mutator, the nursery is expanded when scavenges take more (scavengerPauseTarget only) */
+	uintptr_t scavengerNonTemporalCopyThreshold; /**< objects of at least this many bytes are copied to tenure space with non-temporal stores, zero (default) copies them through the cache */
+	uintptr_t scavengerWorkPerThread; /**< bytes of expected copy and scan work per GC thread used to size each scavenge, zero (default) runs every scavenge on all GC threads */
 
 	enum HeapInitializationSplitHeapSection {
 		HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN = 0,
@@ -525,6 +564,8 @@ public:
 	uintptr_t compactOnSystemGC;
 	uintptr_t nocompactOnSystemGC;
 	bool compactToSatisfyAllocate;
+	bool compactUsingMovePlan; /**< if true, parallel compaction slides each segment to its base following destinations planned from the mark map, instead of evacuating sub areas into free space found below them */
+	uintptr_t largeObjectPinnedSize; /**< objects of at least this size are never moved by compaction, 0 (default) moves all objects */
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	bool payAllocationTax;
@@ -541,6 +582,7 @@ public:
 	uintptr_t concurrentSlack; /**< number of bytes to add to the concurrent kickoff threshold buffer */
 	uintptr_t cardCleanPass2Boost;
 	uintptr_t cardCleaningPasses;
+	bool concurrentCardSummary; /**< if true, the card table keeps a summary bit per group of cards so that card cleaning skips clean groups.  Every write to a card must then be made through the card table (no inline card marking) */
 
 	UDATA fvtest_concurrentCardTablePreparationDelay; /**< Delay for concurrent card table preparation in milliseconds */
 
@@ -619,6 +661,15 @@ public:
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 	MM_SizeClasses* defaultSizeClasses;
+	bool segregatedGenerational; /**< Keep mark bits set across collections (sticky mark bits) and only collect objects allocated since the last collection, default is false */
+	uintptr_t segregatedFullCollectionOccupancy; /**< Heap occupancy (percentage) after a young collection at which the next collection is a full collection */
+	bool sizeClassProfiling; /**< Record a histogram of small allocation sizes and report a size class table tuned to it at shutdown, default is false */
+	uintptr_t sizeClassProfilingTargetCount; /**< Number of distinct size classes of the tuned table (0 for all of the size classes) */
+	char* sizeClassesFile; /**< File the tuned size class table is written to at shutdown when profiling, and read from at startup (NULL for none) */
+	uintptr_t regionGrantBatchSize; /**< Number of free regions granted to an allocation context at a time (0 or 1 to take them one at a time) */
+	bool segregatedIncremental; /**< Mark in increments bounded by segregatedQuantumBudget, paced by allocation, default is false (not supported in generational mode) */
+	uintptr_t segregatedQuantumBudget; /**< Time budget of an incremental mark increment (quantum), in microseconds */
+	uintptr_t segregatedIncrementalKickoff; /**< Free heap (percentage) at which an incremental mark cycle is started */
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
@@ -688,6 +739,8 @@ public:
 	uintptr_t regionSize; /**< The size, in bytes, of a fixed-size table-backed region of the heap (does not apply to AUX regions) */
 	MM_NUMAManager _numaManager; /**< The object which abstracts the details of our NUMA support so that the GCExtensions and the callers don't need to duplicate the support to interpret our intention */
 	bool numaForced; /**< if true, specifies if numa is disabled or enabled (actual value stored in NUMA Manager) by command line option */
+	MM_HeapMapScan heapMapScan; /**< Bulk heap map scanning, with the kernel selected for the processor at startup */
+	bool vectorHeapMapScan; /**< if false, heap map scanning uses the scalar kernel even if the processor supports a vector kernel */
 
 	bool padToPageSize;
 	
@@ -795,6 +848,8 @@ public:
 	bool gcOnIdle; /**< Enables releasing free heap pages if true while systemGarbageCollect invoked with IDLE GC code, default is false */
 	bool compactOnIdle; /**< Forces compaction if global GC executed while VM Runtime State set to IDLE, default is false */
 	float gcOnIdleCompactThreshold; /**< Enables compaction when fragmented memory and dark matter exceed this limit. The larger this number, the more memory can be fragmented before compact is triggered **/
+	uintptr_t idleHeapReleaseInterval; /**< milliseconds between checks of the background thread which releases the free heap pages once the heap goes idle, 0 (default) disables the thread */
+	bool largeObjectAreaReleaseFreePages; /**< if true, the free pages of the LOA are released after every global collection, default is false */
 #endif
 
 #if defined(OMR_VALGRIND_MEMCHECK)
@@ -895,6 +950,20 @@ public:
 		return false;
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 	}
+
+	/**
+	 * @return true if the current (or next) scavenge cycle runs concurrently: Concurrent Scavenger is enabled and
+	 * concurrentScavengerAdaptive has not picked a stop-the-world cycle.  For the cycle decisions of the scavenger only.
+	 */
+	MMINLINE bool
+	isConcurrentScavengeCycle()
+	{
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+		return concurrentScavenger && !concurrentScavengerStopTheWorldCycle;
+#else
+		return false;
+#endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
+	}
 	
 	MMINLINE bool
 	isConcurrentScavengerHWSupported()
@@ -1060,9 +1129,21 @@ public:
 		*end = _guaranteedNurseryEnd;
 	}
 	
-	MMINLINE bool isRememberedSetInOverflowState() { return _isRememberedSetInOverflow; }
+	/**
+	 * @return true if the remembered set list does not hold all remembered objects, either because it is in
+	 * (full) overflow or because some remembered objects have been recorded by card only
+	 */
+	MMINLINE bool isRememberedSetInOverflowState() { return _isRememberedSetInOverflow || _isRememberedSetInCardOverflow; }
+	MMINLINE bool isRememberedSetInFullOverflowState() { return _isRememberedSetInOverflow; }
+	MMINLINE bool isRememberedSetInCardOverflowState() { return _isRememberedSetInCardOverflow; }
 	MMINLINE void setRememberedSetOverflowState() { _isRememberedSetInOverflow = true; }
-	MMINLINE void clearRememberedSetOverflowState() { _isRememberedSetInOverflow = false; }
+	MMINLINE void setRememberedSetCardOverflowState() { _isRememberedSetInCardOverflow = true; }
+	MMINLINE void clearRememberedSetCardOverflowState() { _isRememberedSetInCardOverflow = false; }
+	MMINLINE void clearRememberedSetOverflowState()
+	{
+		_isRememberedSetInOverflow = false;
+		_isRememberedSetInCardOverflow = false;
+	}
 	
 	MMINLINE void setScavengerBackOutState(BackOutState backOutState) { _backOutState = backOutState; }
 	MMINLINE BackOutState getScavengerBackOutState() { return _backOutState; }
@@ -1311,6 +1392,7 @@ public:
 		, _guaranteedNurseryStart(NULL)
 		, _guaranteedNurseryEnd(NULL)
 		, _isRememberedSetInOverflow(false)
+		, _isRememberedSetInCardOverflow(false)
 		, _backOutState(backOutFlagCleared)
 		, _concurrentGlobalGCInProgress(false)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
@@ -1350,6 +1432,8 @@ public:
 #endif /* OMR_GC_VLHGC */
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		, concurrentSweep(false)
+		, concurrentSweepBackgroundThreads(1)
+		, concurrentSweepBackgroundThreadsForced(false)
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 		, largePageWarnOnError(false)
 		, largePageFailOnError(false)
@@ -1358,8 +1442,12 @@ public:
 		, requestedPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
 		, gcmetadataPageSize(0)
 		, gcmetadataPageFlags(OMRPORT_VMEM_PAGE_FLAG_NOT_USED)
-#if defined(OMR_GC_MODRON_SCAVENGER)
+		, transparentHugePageLayout(false)
+		, transparentHugePageSize(2 * 1024 * 1024)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_SEGREGATED_HEAP)
 		, rememberedSet()
+#endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_SEGREGATED_HEAP */
+#if defined(OMR_GC_MODRON_SCAVENGER)
 		, oldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, freeOldHeapSizeOnLastGlobalGC(UDATA_MAX)
 		, concurrentKickoffTenuringHeadroom((float)0.02)
@@ -1381,6 +1469,8 @@ public:
 		, frequentObjectAllocationSamplingRate(100)
 		, frequentObjectsStats(NULL)
 		, frequentObjectAllocationSamplingDepth(0)
+		, allocationSiteSampleInterval(0)
+		, allocationSiteSampler(NULL)
 		, estimateFragmentation(GLOBALGC_ESTIMATE_FRAGMENTATION)
 		, processLargeAllocateStats(true) /* turn on processLargeAllocateStats by default */
 		, largeObjectAllocationProfilingThreshold(512)
@@ -1404,6 +1494,8 @@ public:
 		, tlhIncrementSize(4096)
 		, tlhSurvivorDiscardThreshold(tlhMinimumSize)
 		, tlhTenureDiscardThreshold(tlhMinimumSize)
+		, tlhAdaptiveSizing(false)
+		, tlhAllocationRate(0)
 		, allocationStats()
 		, bytesAllocatedMost(0)
 		, vmThreadAllocatedMost(NULL)
@@ -1411,6 +1503,7 @@ public:
 		, splitFreeListSplitAmount(0)
 		, splitFreeListNumberChunksPrepared(0)
 		, enableHybridMemoryPool(false)
+		, freeListBins(false)
 		, largeObjectArea(false)
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 		, largeObjectMinimumSize(64 * 1024)
@@ -1445,8 +1538,13 @@ public:
 		, workpacketCount(0) /* only set if -Xgcworkpackets specified */
 		, packetListSplit(0)
 		, cacheListSplit(0)
+		, packetListLockFree(false)
+		, workPacketMagazineSize(0)
+		, adaptiveWorkPacketSize(false)
+		, workPacketSpillMaximum(0)
 		, markingArraySplitMaximumAmount(DEFAULT_ARRAY_SPLIT_MAXIMUM_SIZE)
 		, markingArraySplitMinimumAmount(DEFAULT_ARRAY_SPLIT_MINIMUM_SIZE)
+		, markingPrefetchDepth(0)
 		, rootScannerStatsEnabled(false)
 		, rootScannerStatsUsed(false)
 		, fvtest_forceOldResize(0)
@@ -1459,6 +1557,7 @@ public:
 		, fvtest_forcePoisonEvacuate(0)
 		, fvtest_forceNurseryResize(0)
 		, fvtest_nurseryResizeCounter(0)
+		, fvtest_rememberedSetMaxSize(0)
 #endif /* OMR_GC_MODRON_SCAVENGER */
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
 		, fvtest_alwaysApplyOverflowRounding(0)
@@ -1469,6 +1568,8 @@ public:
 		, fvtest_tarokVerifyMarkMapClosure(0)
 #endif /* defined(OMR_GC_VLHGC) */
 		, fvtest_disableInlineAllocation(0)
+		, fvtest_verifyFreeListBins(false)
+		, fvtest_tlhAllocationRate(0)
 		, fvtest_forceSweepChunkArrayCommitFailure(0)
 		, fvtest_forceSweepChunkArrayCommitFailureCounter(0)
 #if defined(OMR_ENV_DATA64) && defined(OMR_GC_FULL_POINTERS)
@@ -1491,6 +1592,7 @@ public:
 #endif /* OMR_GC_BATCH_CLEAR_TLH */
 		, gcThreadCount(0)
 		, gcThreadCountForced(false)
+		, gcThreadParking(false)
 #if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_VLHGC)
 		, scavengerScanOrdering(OMR_GC_SCAVENGER_SCANORDERING_HIERARCHICAL)
 #endif /* OMR_GC_MODRON_SCAVENGER || OMR_GC_VLHGC */
@@ -1515,6 +1617,9 @@ public:
 		, concurrentScavengerBackgroundThreadsForced(false)
 		, concurrentScavengerSlack(0)
 		, concurrentScavengerAllocDeviationBoost(2.0)
+		, concurrentScavengerAdaptive(false)
+		, concurrentScavengerAdaptiveProbeInterval(16)
+		, concurrentScavengerStopTheWorldCycle(false)
 #endif /* defined(OMR_GC_CONCURRENT_SCAVENGER) */
 		, scavengerFailedTenureThreshold(0)
 		, maxScavengeBeforeGlobal(0)
@@ -1544,6 +1649,19 @@ public:
 		, dnssMinimumContraction(0.0)
 		, enableSplitHeap(false)
 		, aliasInhibitingThresholdPercentage(0.20)
+		, scavengerWorkStealing(false)
+		, scavengerWorkStealingDequeSize(512)
+		, scavengerHotFieldProfiling(false)
+		, scavengerHotFieldSampleRate(32)
+		, scavengerRememberedSetBatching(false)
+		, scavengerRememberedSetBatchSize(256)
+		, scavengerRememberedSetCardOverflow(false)
+		, numaAwareNursery(false)
+		, numaAwareNurseryNextNode(0)
+		, scavengerPauseTarget(0)
+		, scavengerThroughputGoal(0.95)
+		, scavengerNonTemporalCopyThreshold(0)
+		, scavengerWorkPerThread(0)
 		, splitHeapSection(HEAP_INITIALIZATION_SPLIT_HEAP_UNKNOWN)
 #endif /* OMR_GC_MODRON_SCAVENGER */
 		, globalMaximumContraction(0.05) /* by default, contract must be at most 5% of the committed heap */
@@ -1566,6 +1684,8 @@ public:
 		, compactOnSystemGC(0)
 		, nocompactOnSystemGC(0)
 		, compactToSatisfyAllocate(false)
+		, compactUsingMovePlan(false)
+		, largeObjectPinnedSize(0)
 #endif /* OMR_GC_MODRON_COMPACTION */
 		, payAllocationTax(false)
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
@@ -1580,6 +1700,7 @@ public:
 		, concurrentSlack(0)
 		, cardCleanPass2Boost(2)
 		, cardCleaningPasses(2)
+		, concurrentCardSummary(false)
 		, fvtest_concurrentCardTablePreparationDelay(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailure(0)
 		, fvtest_forceConcurrentTLHMarkMapCommitFailureCounter(0)
@@ -1637,6 +1758,15 @@ public:
 #endif /* defined(OMR_GC_REALTIME) || defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_SEGREGATED_HEAP)
 		, defaultSizeClasses(NULL)
+		, segregatedGenerational(false)
+		, segregatedFullCollectionOccupancy(70)
+		, sizeClassProfiling(false)
+		, sizeClassProfilingTargetCount(0)
+		, sizeClassesFile(NULL)
+		, regionGrantBatchSize(8)
+		, segregatedIncremental(false)
+		, segregatedQuantumBudget(500)
+		, segregatedIncrementalKickoff(30)
 #endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 #if defined(OMR_GC_VLHGC_CONCURRENT_COPY_FORWARD)
 		, heapRegionStateTable(NULL)
@@ -1682,6 +1812,8 @@ public:
 		, regionSize(0)
 		, _numaManager()
 		, numaForced(false)
+		, heapMapScan()
+		, vectorHeapMapScan(true)
 		, padToPageSize(false)
 		, fvtest_disableExplictMasterThread(false)
 #if defined(OMR_GC_VLHGC)
@@ -1765,6 +1897,8 @@ public:
 		, gcOnIdle(false)
 		, compactOnIdle(false)
 		, gcOnIdleCompactThreshold((float)0.25)
+		, idleHeapReleaseInterval(0)
+		, largeObjectAreaReleaseFreePages(false)
 #endif /* defined(OMR_GC_IDLE_HEAP_MANAGER) */
 #if defined(OMR_VALGRIND_MEMCHECK)
 		, valgrindMempoolAddr(0)
@@ -477,10 +477,12 @@ MM_Heap::initializeCommonGCStartData(MM_EnvironmentBase* env, MM_CommonGCStartDa
 	data->tlhAllocCount = extensions->allocationStats._tlhRefreshCountFresh;
 	data->tlhAllocBytes = extensions->allocationStats._tlhAllocatedFresh;
 	data->tlhRequestedBytes = extensions->allocationStats._tlhRequestedBytes;
+	data->tlhAbandonedBytes = extensions->allocationStats._tlhAbandonedBytes;
 #else
 	data->tlhAllocCount = 0;
 	data->tlhAllocBytes = 0;
 	data->tlhRequestedBytes = 0;
+	data->tlhAbandonedBytes = 0;
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */
 
 	data->nonTlhAllocCount = extensions->allocationStats._allocationCount;
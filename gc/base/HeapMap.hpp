@@ -161,6 +161,15 @@ public:
 		return slotIndex;
 	}
 
+	/**
+	 * Prefetch the heap map slot holding the bit for the given object, ahead of setting the bit.
+	 */
+	MMINLINE void
+	prefetchSlot(omrobjectptr_t objectPtr)
+	{
+		OMR_PREFETCH_WRITE(&_heapMapBits[getSlotIndex(objectPtr)]);
+	}
+
 	MMINLINE bool 
 	isBitSet(omrobjectptr_t objectPtr)
 	{
@@ -130,7 +130,14 @@ MM_HeapMapIterator::nextObject()
 		_heapMapSlotCurrent += 1;
 		_bitIndexHead = 0;
 		if(_heapSlotCurrent < _heapChunkTop) {
-			_heapMapSlotValue = *_heapMapSlotCurrent;
+			/* Skip any run of empty map slots in bulk, up to the slot covering the end of the range */
+			uintptr_t slotsLeft = MM_Math::roundToCeiling(J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT, (uintptr_t)(_heapChunkTop - _heapSlotCurrent)) / J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+			uintptr_t *heapMapSlotNext = _extensions->heapMapScan.skipEmptySlots(_heapMapSlotCurrent, _heapMapSlotCurrent + slotsLeft);
+			_heapSlotCurrent += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (uintptr_t)(heapMapSlotNext - _heapMapSlotCurrent);
+			_heapMapSlotCurrent = heapMapSlotNext;
+			if(_heapSlotCurrent < _heapChunkTop) {
+				_heapMapSlotValue = *_heapMapSlotCurrent;
+			}
 		}
 	}
 
@@ -0,0 +1,231 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "HeapMapScan.hpp"
+
+#include "Bits.hpp"
+#include "HeapMap.hpp"
+
+#if defined(OMR_GC_HEAPMAP_SCAN_X86)
+#include <immintrin.h>
+#elif defined(OMR_GC_HEAPMAP_SCAN_NEON)
+#include <arm_neon.h>
+#endif
+
+void
+MM_HeapMapScan::initialize(bool allowVector)
+{
+	selectKernel(kernel_scalar);
+	if (allowVector) {
+		/* prefer the widest kernel the processor (and OS) supports */
+		if (!selectKernel(kernel_avx512) && !selectKernel(kernel_avx2)) {
+			selectKernel(kernel_neon);
+		}
+	}
+}
+
+bool
+MM_HeapMapScan::selectKernel(Kernel kernel)
+{
+	bool selected = false;
+	if (isKernelSupported(kernel)) {
+		_kernel = kernel;
+		_skipEmptySlots = getKernelFunction(kernel);
+		selected = true;
+	}
+	return selected;
+}
+
+bool
+MM_HeapMapScan::isKernelSupported(Kernel kernel)
+{
+	bool supported = false;
+	switch (kernel) {
+	case kernel_scalar:
+		supported = true;
+		break;
+#if defined(OMR_GC_HEAPMAP_SCAN_X86)
+	case kernel_avx2:
+		/* also checks that the OS saves the AVX state */
+		supported = (0 != __builtin_cpu_supports("avx2"));
+		break;
+	case kernel_avx512:
+		supported = (0 != __builtin_cpu_supports("avx512f"));
+		break;
+#endif /* OMR_GC_HEAPMAP_SCAN_X86 */
+#if defined(OMR_GC_HEAPMAP_SCAN_NEON)
+	case kernel_neon:
+		/* Advanced SIMD is mandatory on AArch64 */
+		supported = true;
+		break;
+#endif /* OMR_GC_HEAPMAP_SCAN_NEON */
+	default:
+		break;
+	}
+	return supported;
+}
+
+MM_HeapMapScan::SkipEmptySlotsFunction
+MM_HeapMapScan::getKernelFunction(Kernel kernel)
+{
+	SkipEmptySlotsFunction function = NULL;
+	switch (kernel) {
+	case kernel_scalar:
+		function = skipEmptySlotsScalar;
+		break;
+#if defined(OMR_GC_HEAPMAP_SCAN_X86)
+	case kernel_avx2:
+		function = skipEmptySlotsAVX2;
+		break;
+	case kernel_avx512:
+		function = skipEmptySlotsAVX512;
+		break;
+#endif /* OMR_GC_HEAPMAP_SCAN_X86 */
+#if defined(OMR_GC_HEAPMAP_SCAN_NEON)
+	case kernel_neon:
+		function = skipEmptySlotsNEON;
+		break;
+#endif /* OMR_GC_HEAPMAP_SCAN_NEON */
+	default:
+		break;
+	}
+	return function;
+}
+
+const char *
+MM_HeapMapScan::getKernelName(Kernel kernel)
+{
+	switch (kernel) {
+	case kernel_scalar:
+		return "scalar";
+	case kernel_avx2:
+		return "avx2";
+	case kernel_avx512:
+		return "avx512";
+	case kernel_neon:
+		return "neon";
+	default:
+		return "unknown";
+	}
+}
+
+uintptr_t
+MM_HeapMapScan::extractMarkedObjects(uintptr_t * &slot, uintptr_t *slotTop, uintptr_t * &heapSlot, omrobjectptr_t *buffer, uintptr_t bufferCount)
+{
+	uintptr_t count = 0;
+	while (slot < slotTop) {
+		uintptr_t *nonEmpty = skipEmptySlots(slot, slotTop);
+		heapSlot += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT * (uintptr_t)(nonEmpty - slot);
+		slot = nonEmpty;
+		if ((slot == slotTop) || ((bufferCount - count) < (uintptr_t)MM_Bits::populationCount(*slot))) {
+			break;
+		}
+		uintptr_t bits = *slot;
+		while (0 != bits) {
+			buffer[count] = (omrobjectptr_t)(heapSlot + (J9MODRON_HEAP_SLOTS_PER_HEAPMAP_BIT * MM_Bits::leadingZeroes(bits)));
+			count += 1;
+			/* clear the lowest set bit */
+			bits &= bits - 1;
+		}
+		slot += 1;
+		heapSlot += J9MODRON_HEAP_SLOTS_PER_HEAPMAP_SLOT;
+	}
+	return count;
+}
+
+uintptr_t *
+MM_HeapMapScan::skipEmptySlotsScalar(uintptr_t *slot, uintptr_t *slotTop)
+{
+	while ((slot < slotTop) && (0 == *slot)) {
+		slot += 1;
+	}
+	return slot;
+}
+
+#if defined(OMR_GC_HEAPMAP_SCAN_X86)
+/* The vector kernels test a block of slots at a time for any set bit and leave it to the scalar
+ * loop to find the non-empty slot within the first block that has one (and to handle the tail).
+ * On dense heaps the next slot is usually not empty, so it is checked before entering the vector loop.
+ */
+__attribute__((target("avx2"))) uintptr_t *
+MM_HeapMapScan::skipEmptySlotsAVX2(uintptr_t *slot, uintptr_t *slotTop)
+{
+	if ((slot < slotTop) && (0 != *slot)) {
+		return slot;
+	}
+	const uintptr_t slotsPerBlock = (2 * sizeof(__m256i)) / sizeof(uintptr_t);
+	while ((uintptr_t)(slotTop - slot) >= slotsPerBlock) {
+		__m256i low = _mm256_loadu_si256((const __m256i *)slot);
+		__m256i high = _mm256_loadu_si256((const __m256i *)slot + 1);
+		__m256i any = _mm256_or_si256(low, high);
+		if (!_mm256_testz_si256(any, any)) {
+			break;
+		}
+		slot += slotsPerBlock;
+	}
+	return skipEmptySlotsScalar(slot, slotTop);
+}
+
+__attribute__((target("avx512f"))) uintptr_t *
+MM_HeapMapScan::skipEmptySlotsAVX512(uintptr_t *slot, uintptr_t *slotTop)
+{
+	if ((slot < slotTop) && (0 != *slot)) {
+		return slot;
+	}
+	const uintptr_t slotsPerBlock = (2 * sizeof(__m512i)) / sizeof(uintptr_t);
+	while ((uintptr_t)(slotTop - slot) >= slotsPerBlock) {
+		__m512i low = _mm512_loadu_si512((const void *)slot);
+		__m512i high = _mm512_loadu_si512((const void *)((const __m512i *)slot + 1));
+		__m512i any = _mm512_or_si512(low, high);
+		if (0 != _mm512_test_epi64_mask(any, any)) {
+			break;
+		}
+		slot += slotsPerBlock;
+	}
+	return skipEmptySlotsScalar(slot, slotTop);
+}
+#endif /* OMR_GC_HEAPMAP_SCAN_X86 */
+
+#if defined(OMR_GC_HEAPMAP_SCAN_NEON)
+uintptr_t *
+MM_HeapMapScan::skipEmptySlotsNEON(uintptr_t *slot, uintptr_t *slotTop)
+{
+	if ((slot < slotTop) && (0 != *slot)) {
+		return slot;
+	}
+	const uintptr_t slotsPerBlock = (4 * sizeof(uint64x2_t)) / sizeof(uintptr_t);
+	while ((uintptr_t)(slotTop - slot) >= slotsPerBlock) {
+		const uint64_t *block = (const uint64_t *)slot;
+		uint64x2_t any = vorrq_u64(vorrq_u64(vld1q_u64(block), vld1q_u64(block + 2)), vorrq_u64(vld1q_u64(block + 4), vld1q_u64(block + 6)));
+		if (0 != vmaxvq_u32(vreinterpretq_u32_u64(any))) {
+			break;
+		}
+		slot += slotsPerBlock;
+	}
+	return skipEmptySlotsScalar(slot, slotTop);
+}
+#endif /* OMR_GC_HEAPMAP_SCAN_NEON */
@@ -0,0 +1,143 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(HEAPMAPSCAN_HPP_)
+#define HEAPMAPSCAN_HPP_
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+#include "objectdescription.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OMR_GC_HEAPMAP_SCAN_X86
+#elif defined(__GNUC__) && defined(__aarch64__)
+#define OMR_GC_HEAPMAP_SCAN_NEON
+#endif
+
+/**
+ * Bulk scanning of heap map (mark map) slots.
+ * Sparse heaps leave long runs of empty heap map slots between live objects.  The scan skips those
+ * runs several slots at a time with a vector kernel picked once at startup from the features of the
+ * processor, and falls back to the scalar loop where no vector kernel is available.
+ * @ingroup GC_Base
+ */
+class MM_HeapMapScan
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef uintptr_t *(*SkipEmptySlotsFunction)(uintptr_t *slot, uintptr_t *slotTop);
+
+	enum Kernel {
+		kernel_scalar = 0,
+		kernel_avx2,
+		kernel_avx512,
+		kernel_neon
+	};
+
+private:
+	SkipEmptySlotsFunction _skipEmptySlots; /**< Kernel used to skip runs of empty heap map slots */
+	Kernel _kernel; /**< Identifies the selected kernel */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Select the fastest kernel supported by the processor.
+	 * @param allowVector false to force the scalar kernel
+	 */
+	void initialize(bool allowVector);
+
+	/**
+	 * Use the given kernel, if the processor supports it.
+	 * @return true if the kernel was selected, false if it is not supported (the selection is unchanged)
+	 */
+	bool selectKernel(Kernel kernel);
+
+	/**
+	 * @return true if the processor supports the given kernel
+	 */
+	static bool isKernelSupported(Kernel kernel);
+
+	/**
+	 * @return the function implementing the given kernel, or NULL if it is not built for this platform
+	 */
+	static SkipEmptySlotsFunction getKernelFunction(Kernel kernel);
+
+	/**
+	 * @return a printable name for the given kernel
+	 */
+	static const char *getKernelName(Kernel kernel);
+
+	MMINLINE Kernel getKernel() { return _kernel; }
+
+	/**
+	 * Find the first non-empty heap map slot in [slot, slotTop).
+	 * @return the first non-empty slot, or slotTop if all slots in the range are empty
+	 */
+	MMINLINE uintptr_t *
+	skipEmptySlots(uintptr_t *slot, uintptr_t *slotTop)
+	{
+		return _skipEmptySlots(slot, slotTop);
+	}
+
+	/**
+	 * Extract the heap addresses which correspond to the bits set in a range of heap map slots.
+	 * Only whole slots are consumed: extraction stops before a slot whose bits would not all fit in the buffer.
+	 * @param[in/out] slot the first heap map slot to extract, updated to the first slot not consumed
+	 * @param[in] slotTop the heap map slot to stop at (exclusive)
+	 * @param[in/out] heapSlot the heap address covered by the first bit of slot, updated along with slot
+	 * @param[out] buffer receives the heap addresses, in address order
+	 * @param[in] bufferCount number of entries available in buffer, at least J9BITS_BITS_IN_SLOT
+	 * @return the number of addresses stored in buffer
+	 */
+	uintptr_t extractMarkedObjects(uintptr_t * &slot, uintptr_t *slotTop, uintptr_t * &heapSlot, omrobjectptr_t *buffer, uintptr_t bufferCount);
+
+	static uintptr_t *skipEmptySlotsScalar(uintptr_t *slot, uintptr_t *slotTop);
+#if defined(OMR_GC_HEAPMAP_SCAN_X86)
+	static uintptr_t *skipEmptySlotsAVX2(uintptr_t *slot, uintptr_t *slotTop);
+	static uintptr_t *skipEmptySlotsAVX512(uintptr_t *slot, uintptr_t *slotTop);
+#endif /* OMR_GC_HEAPMAP_SCAN_X86 */
+#if defined(OMR_GC_HEAPMAP_SCAN_NEON)
+	static uintptr_t *skipEmptySlotsNEON(uintptr_t *slot, uintptr_t *slotTop);
+#endif /* OMR_GC_HEAPMAP_SCAN_NEON */
+
+	MM_HeapMapScan()
+		: _skipEmptySlots(skipEmptySlotsScalar)
+		, _kernel(kernel_scalar)
+	{}
+};
+
+#endif /* HEAPMAPSCAN_HPP_ */
@@ -0,0 +1,259 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "omrcfg.h"
+#include "omrport.h"
+#include "omrutil.h"
+#include "ModronAssertions.h"
+
+#include "IdleHeapReleaser.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+#include "Collector.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "Heap.hpp"
+#include "MemorySpace.hpp"
+#include "MemorySubSpace.hpp"
+#include "ParallelDispatcher.hpp"
+
+MM_IdleHeapReleaser::MM_IdleHeapReleaser(MM_EnvironmentBase *env)
+	: MM_BaseVirtual()
+	, _extensions(env->getExtensions())
+	, _collector(NULL)
+	, _monitor(NULL)
+	, _state(STATE_ERROR)
+	, _lastGCCount(0)
+	, _lastFreeMemorySize(0)
+	, _releasedSinceGC(true)
+	, _decommittedBytes(0)
+{
+	_typeId = __FUNCTION__;
+}
+
+MM_IdleHeapReleaser *
+MM_IdleHeapReleaser::newInstance(MM_EnvironmentBase *env, MM_Collector *collector)
+{
+	MM_IdleHeapReleaser *releaser = (MM_IdleHeapReleaser *)env->getForge()->allocate(sizeof(MM_IdleHeapReleaser), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != releaser) {
+		new(releaser) MM_IdleHeapReleaser(env);
+		if (!releaser->initialize(env, collector)) {
+			releaser->kill(env);
+			releaser = NULL;
+		}
+	}
+	return releaser;
+}
+
+void
+MM_IdleHeapReleaser::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_IdleHeapReleaser::initialize(MM_EnvironmentBase *env, MM_Collector *collector)
+{
+	_collector = collector;
+	return (0 == omrthread_monitor_init_with_name(&_monitor, 0, "MM_IdleHeapReleaser::_monitor"));
+}
+
+void
+MM_IdleHeapReleaser::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _monitor) {
+		omrthread_monitor_destroy(_monitor);
+		_monitor = NULL;
+	}
+}
+
+bool
+MM_IdleHeapReleaser::startup()
+{
+	bool success = false;
+
+	/* hold the monitor over start-up of the thread so that it cannot notify us of its state before we wait */
+	omrthread_monitor_enter(_monitor);
+	_state = STATE_STARTING;
+	intptr_t forkResult = createThreadWithCategory(
+		NULL,
+		OMR_OS_STACK_SIZE,
+		J9THREAD_PRIORITY_MIN,
+		0,
+		releaser_thread_proc,
+		this,
+		J9THREAD_CATEGORY_SYSTEM_GC_THREAD);
+	if (0 == forkResult) {
+		while (STATE_STARTING == _state) {
+			omrthread_monitor_wait(_monitor);
+		}
+		success = (STATE_ERROR != _state);
+	} else {
+		_state = STATE_ERROR;
+	}
+	omrthread_monitor_exit(_monitor);
+
+	return success;
+}
+
+void
+MM_IdleHeapReleaser::shutdown()
+{
+	omrthread_monitor_enter(_monitor);
+	if (STATE_ERROR != _state) {
+		while (STATE_TERMINATED != _state) {
+			_state = STATE_TERMINATION_REQUESTED;
+			omrthread_monitor_notify(_monitor);
+			omrthread_monitor_wait(_monitor);
+		}
+	}
+	omrthread_monitor_exit(_monitor);
+}
+
+int J9THREAD_PROC
+MM_IdleHeapReleaser::releaser_thread_proc(void *info)
+{
+	MM_IdleHeapReleaser *releaser = (MM_IdleHeapReleaser *)info;
+	OMR_VM *omrVM = releaser->_extensions->getOmrVM();
+	OMRPORT_ACCESS_FROM_OMRVM(omrVM);
+	uintptr_t rc = 0;
+	omrsig_protect(releaser_thread_proc2, info,
+			((MM_ParallelDispatcher *)releaser->_extensions->dispatcher)->getSignalHandler(), omrVM,
+			OMRPORT_SIG_FLAG_SIGALLSYNC | OMRPORT_SIG_FLAG_MAY_CONTINUE_EXECUTION,
+			&rc);
+	return 0;
+}
+
+uintptr_t
+MM_IdleHeapReleaser::releaser_thread_proc2(OMRPortLibrary *portLib, void *info)
+{
+	MM_IdleHeapReleaser *releaser = (MM_IdleHeapReleaser *)info;
+	/* this method will NOT return */
+	releaser->releaserThreadEntryPoint();
+	Assert_MM_unreachable();
+	return 0;
+}
+
+void
+MM_IdleHeapReleaser::releaserThreadEntryPoint()
+{
+	OMR_VMThread *omrVMThread = MM_EnvironmentBase::attachVMThread(_extensions->getOmrVM(), "GC Idle Heap Releaser", MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+	if (NULL == omrVMThread) {
+		/* notify the creating thread that we failed to start up */
+		omrthread_monitor_enter(_monitor);
+		_state = STATE_ERROR;
+		omrthread_monitor_notify(_monitor);
+		omrthread_exit(_monitor);
+	} else {
+		MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+		env->initializeGCThread();
+
+		omrthread_monitor_enter(_monitor);
+		_state = STATE_WAITING;
+		omrthread_monitor_notify(_monitor);
+		while (STATE_TERMINATION_REQUESTED != _state) {
+			omrthread_monitor_wait_timed(_monitor, (int64_t)_extensions->idleHeapReleaseInterval, 0);
+			if (STATE_TERMINATION_REQUESTED != _state) {
+				omrthread_monitor_exit(_monitor);
+				checkIdleHeap(env);
+				omrthread_monitor_enter(_monitor);
+			}
+		}
+		_state = STATE_TERMINATED;
+		omrthread_monitor_notify(_monitor);
+		MM_EnvironmentBase::detachVMThread(_extensions->getOmrVM(), omrVMThread, MM_EnvironmentBase::ATTACH_GC_HELPER_THREAD);
+		omrthread_exit(_monitor);
+	}
+}
+
+uintptr_t
+MM_IdleHeapReleaser::getGCCount()
+{
+	uintptr_t gcCount = _extensions->globalGCStats.gcCount;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	gcCount += _extensions->scavengerStats._gcCount;
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	return gcCount;
+}
+
+void
+MM_IdleHeapReleaser::checkIdleHeap(MM_EnvironmentBase *env)
+{
+	uintptr_t gcCount = getGCCount();
+	uintptr_t freeMemorySize = _extensions->heap->getApproximateActiveFreeMemorySize();
+
+	if (gcCount != _lastGCCount) {
+		/* the collection refilled the free lists, wait for a quiet interval before releasing them */
+		_lastGCCount = gcCount;
+		_releasedSinceGC = false;
+	} else if (!_releasedSinceGC) {
+		uintptr_t allocatedBytes = (_lastFreeMemorySize > freeMemorySize) ? (_lastFreeMemorySize - freeMemorySize) : 0;
+		if (allocatedBytes < (_extensions->heap->getActiveMemorySize() / 100)) {
+			releaseFreePages(env);
+		}
+	}
+	_lastFreeMemorySize = freeMemorySize;
+}
+
+void
+MM_IdleHeapReleaser::releaseFreePages(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+
+	/* VM access keeps collections, which rebuild the free lists, out while the pages are released */
+	env->acquireVMAccess();
+	/* a collection may have run while we waited for VM access, and the background sweep may still be building the free lists */
+	if ((getGCCount() == _lastGCCount) && !_collector->isConcurrentWorkAvailable(env)) {
+		MM_MemorySpace *memorySpace = _extensions->heap->getDefaultMemorySpace();
+		uint64_t startTime = omrtime_hires_clock();
+		uintptr_t decommittedBytes = memorySpace->releaseFreeMemoryPages(env);
+		uint64_t endTime = omrtime_hires_clock();
+		_decommittedBytes += decommittedBytes;
+		_releasedSinceGC = true;
+
+		MM_MemorySubSpace *tenureSubSpace = memorySpace->getTenureMemorySubSpace();
+		TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+			_extensions->privateHookInterface,
+			env->getOmrVMThread(),
+			endTime,
+			J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+			HEAP_RELEASE_FREE_PAGES,
+			tenureSubSpace->getTypeFlags(),
+			/* GC Time Ratio not applicable for "release free heap pages" */
+			0,
+			decommittedBytes,
+			tenureSubSpace->getActiveMemorySize(),
+			omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+			/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
+			1);
+	}
+	env->releaseVMAccess();
+}
+
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
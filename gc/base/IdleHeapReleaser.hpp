@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(IDLEHEAPRELEASER_HPP_)
+#define IDLEHEAPRELEASER_HPP_
+
+#include "omrcfg.h"
+#include "omrthread.h"
+#include "modronbase.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+
+class MM_Collector;
+class MM_EnvironmentBase;
+class MM_GCExtensionsBase;
+
+/**
+ * Background thread which returns the free memory of an idle heap to the operating system.
+ * The thread runs at minimum priority and wakes up every idleHeapReleaseInterval milliseconds.  The heap is
+ * considered idle when no collection has run and less than 1% of the heap has been allocated since the last
+ * wake up.  The first time the heap is found idle after a collection, the whole pages inside the free entries
+ * of the memory pools are decommitted (see MM_MemoryPool::releaseFreeMemoryPages()), and the amount decommitted
+ * is reported as a "release free pages" heap resize.  It counts the pages whether they were resident or not, so it
+ * is an upper bound on the drop in resident memory.  Free entries only grow at collection time, so the pages
+ * are released at most once per collection.
+ * @ingroup GC_Base
+ */
+class MM_IdleHeapReleaser : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	typedef enum ReleaserState {
+		STATE_ERROR = 0,
+		STATE_STARTING,
+		STATE_WAITING,
+		STATE_TERMINATION_REQUESTED,
+		STATE_TERMINATED
+	} ReleaserState;
+
+	MM_GCExtensionsBase *_extensions; /**< The GC extensions */
+	MM_Collector *_collector; /**< The global collector, asked whether background sweep work is pending */
+	omrthread_monitor_t _monitor; /**< Protects _state and paces the thread */
+	volatile ReleaserState _state; /**< The state (protected by _monitor) of the releaser thread */
+	uintptr_t _lastGCCount; /**< Number of collections seen at the last wake up */
+	uintptr_t _lastFreeMemorySize; /**< Approximate free heap memory at the last wake up */
+	bool _releasedSinceGC; /**< true if the free pages have been released since the last collection */
+	uintptr_t _decommittedBytes; /**< Total bytes of free heap pages decommitted, whether they were resident or not */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	static int J9THREAD_PROC releaser_thread_proc(void *info);
+	static uintptr_t releaser_thread_proc2(OMRPortLibrary *portLib, void *info);
+	void releaserThreadEntryPoint();
+
+	/**
+	 * @return the number of collections (global and local) run so far
+	 */
+	uintptr_t getGCCount();
+
+	/**
+	 * Check whether the heap has been idle since the last wake up, and release its free pages if so.
+	 * @note Called without VM access, and without holding _monitor.
+	 */
+	void checkIdleHeap(MM_EnvironmentBase *env);
+
+	/**
+	 * Decommit the free pages of the heap and report the amount released.
+	 */
+	void releaseFreePages(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, MM_Collector *collector);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_IdleHeapReleaser *newInstance(MM_EnvironmentBase *env, MM_Collector *collector);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Start the releaser thread.
+	 * @return true if the thread started
+	 */
+	bool startup();
+
+	/**
+	 * Stop the releaser thread, and wait for it to exit.
+	 */
+	void shutdown();
+
+	/**
+	 * @return the total bytes of free heap pages decommitted so far, an upper bound on the resident memory given back
+	 */
+	MMINLINE uintptr_t getDecommittedBytes() { return _decommittedBytes; }
+
+	MM_IdleHeapReleaser(MM_EnvironmentBase *env);
+};
+
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+
+#endif /* IDLEHEAPRELEASER_HPP_ */
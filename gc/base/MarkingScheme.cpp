@@ -96,6 +96,8 @@ MM_MarkingScheme::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+	_prefetchDepth = OMR_MIN(_extensions->markingPrefetchDepth, MARKING_PREFETCH_DEPTH_MAXIMUM);
+
 	return _delegate.initialize(env, this);
 
 error_no_memory:
@@ -313,6 +315,86 @@ MM_MarkingScheme::scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
 }
 
 
+/**
+ * Private internal. Called exclusively from completeScanWithPrefetch();
+ */
+uintptr_t
+MM_MarkingScheme::scanObjectWithPrefetch(MM_EnvironmentBase *env, omrobjectptr_t objectPtr)
+{
+	uintptr_t sizeToDo = UDATA_MAX;
+	GC_ObjectScannerState objectScannerState;
+	GC_ObjectScanner *objectScanner = _delegate.getObjectScanner(env, objectPtr, &objectScannerState, SCAN_REASON_PACKET, &sizeToDo);
+	if (NULL != objectScanner) {
+		omrobjectptr_t children[MARKING_PREFETCH_CHILD_BATCH];
+		bool leafChildren[MARKING_PREFETCH_CHILD_BATCH];
+		bool isLeafSlot = false;
+		GC_SlotObject *slotObject = NULL;
+		do {
+			uintptr_t childCount = 0;
+#if defined(OMR_GC_LEAF_BITS)
+			while ((childCount < MARKING_PREFETCH_CHILD_BATCH) && (NULL != (slotObject = objectScanner->getNextSlot(&isLeafSlot)))) {
+#else /* OMR_GC_LEAF_BITS */
+			while ((childCount < MARKING_PREFETCH_CHILD_BATCH) && (NULL != (slotObject = objectScanner->getNextSlot()))) {
+#endif /* OMR_GC_LEAF_BITS */
+				fixupForwardedSlot(slotObject);
+
+				omrobjectptr_t child = slotObject->readReferenceFromSlot();
+				_markMap->prefetchSlot(child);
+				children[childCount] = child;
+				leafChildren[childCount] = isLeafSlot;
+				childCount += 1;
+			}
+			for (uintptr_t i = 0; i < childCount; i++) {
+				inlineMarkObjectNoCheck(env, children[i], leafChildren[i]);
+			}
+		} while (NULL != slotObject);
+	}
+	return sizeToDo;
+}
+
+/**
+ * Private internal. Called exclusively from completeScan();
+ */
+void
+MM_MarkingScheme::completeScanWithPrefetch(MM_EnvironmentBase *env)
+{
+	omrobjectptr_t queue[MARKING_PREFETCH_DEPTH_MAXIMUM];
+	uintptr_t head = 0;
+	uintptr_t count = 0;
+
+	while (true) {
+		/* Objects held in the queue are work no other thread can see, so the thread must not wait
+		 * on the work packets for other threads to finish (and declare marking complete) while it holds any.
+		 */
+		omrobjectptr_t objectPtr = (omrobjectptr_t)((0 == count) ? env->_workStack.pop(env) : env->_workStack.popNoWait(env));
+		if (NULL != objectPtr) {
+			OMR_PREFETCH_READ(objectPtr);
+			uintptr_t tail = head + count;
+			if (tail >= _prefetchDepth) {
+				tail -= _prefetchDepth;
+			}
+			queue[tail] = objectPtr;
+			count += 1;
+			if (count < _prefetchDepth) {
+				continue;
+			}
+			env->_markStats._prefetchQueueScans += 1;
+		} else if (0 == count) {
+			break;
+		}
+
+		/* the queue is full, or the work stack is empty - scan the oldest object */
+		objectPtr = queue[head];
+		head += 1;
+		if (head == _prefetchDepth) {
+			head = 0;
+		}
+		count -= 1;
+		env->_markStats._bytesScanned += scanObjectWithPrefetch(env, objectPtr);
+		env->_markStats._objectsScanned += 1;
+	}
+}
+
 /**
  * Scan until there are no more work packets to be processed.
  * @note This is a joining scan: a thread will not exit this method until
@@ -322,10 +404,14 @@ void
 MM_MarkingScheme::completeScan(MM_EnvironmentBase *env)
 {
 	do {
-		omrobjectptr_t objectPtr = NULL;
-		while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
-			env->_markStats._bytesScanned += scanObject(env, objectPtr);
-			env->_markStats._objectsScanned += 1;
+		if (0 != _prefetchDepth) {
+			completeScanWithPrefetch(env);
+		} else {
+			omrobjectptr_t objectPtr = NULL;
+			while (NULL != (objectPtr = (omrobjectptr_t )env->_workStack.pop(env))) {
+				env->_markStats._bytesScanned += scanObject(env, objectPtr);
+				env->_markStats._objectsScanned += 1;
+			}
 		}
 	} while (_workPackets->handleWorkPacketOverflow(env));
 }
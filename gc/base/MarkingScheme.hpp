@@ -38,6 +38,11 @@
 #include "ObjectScannerState.hpp"
 #include "WorkStack.hpp"
 
+/* Largest number of objects the mark loop may hold in its prefetch queue */
+#define MARKING_PREFETCH_DEPTH_MAXIMUM 32
+/* Number of child references read from an object, and their mark map slots prefetched, before they are marked */
+#define MARKING_PREFETCH_CHILD_BATCH 8
+
 /**
  * @todo Provide class documentation
  */
@@ -56,6 +61,7 @@ protected:
 	MM_WorkPackets *_workPackets;
 	void *_heapBase;
 	void *_heapTop;
+	uintptr_t _prefetchDepth; /**< number of objects held in the prefetch queue of the mark loop (0 if the loop does not prefetch) */
 
 public:
 
@@ -76,6 +82,21 @@ private:
 	 */
 	MMINLINE uintptr_t scanObject(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
 
+	/**
+	 * Scan an object, reading its references a batch at a time and prefetching the mark map slots of
+	 * the whole batch before any of them is marked.
+	 * Private internal. Called exclusively from completeScanWithPrefetch();
+	 */
+	MMINLINE uintptr_t scanObjectWithPrefetch(MM_EnvironmentBase *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Burn down the work stack through a bounded FIFO of popped objects.  Each object is prefetched as
+	 * it enters the queue and scanned once _prefetchDepth more objects have been popped behind it, so
+	 * the cache misses on the object headers overlap with the scanning of the objects ahead of them.
+	 * Private internal. Called exclusively from completeScan();
+	 */
+	void completeScanWithPrefetch(MM_EnvironmentBase *env);
+
 	MM_WorkPackets *createWorkPackets(MM_EnvironmentBase *env);
 
 protected:
@@ -106,7 +127,7 @@ public:
 	 *  Create Root Scanner and Mark all roots including classes and classloaders if dynamic class unloading is enabled
 	 *  @param[in] env - passed Environment 
 	 */
-	void markLiveObjectsRoots(MM_EnvironmentBase *env);
+	virtual void markLiveObjectsRoots(MM_EnvironmentBase *env);
 
 	/**
 	 *  Scan (complete)
@@ -308,6 +329,7 @@ public:
 		, _workPackets(NULL)
 		, _heapBase(NULL)
 		, _heapTop(NULL)
+		, _prefetchDepth(0)
 	{
 		_typeId = __FUNCTION__;
 	}
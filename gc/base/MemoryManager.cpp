@@ -73,6 +73,12 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 	uintptr_t pageFlags = extensions->requestedPageFlags;
 	Assert_MM_true(0 != pageSize);
 
+	bool transparentHugePages = extensions->transparentHugePageLayout && !isLargePage(env, pageSize);
+	if (transparentHugePages) {
+		/* start the heap on a huge page, so that the (huge page sized) regions map onto whole huge pages */
+		heapAlignment = OMR_MAX(heapAlignment, extensions->transparentHugePageSize);
+	}
+
 	uintptr_t allocateSize = size;
 
 	uintptr_t concurrentScavengerPageSize = 0;
@@ -317,6 +323,11 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 		handle->setMemoryBase(instance->getHeapBase());
 		handle->setMemoryTop(instance->getHeapTop());
 
+		if (transparentHugePages) {
+			instance->setTransparentHugePageSize(extensions->transparentHugePageSize);
+			_transparentHugePageAlignedBytes += (uintptr_t)handle->getMemoryTop() - (uintptr_t)handle->getMemoryBase();
+		}
+
 		/*
 		 * Aligning Nursery location to Concurrent Scavenger Page and calculate Concurrent Scavenger Page start address
 		 * There are two possible cases here:
@@ -393,7 +404,7 @@ MM_MemoryManager::createVirtualMemoryForHeap(MM_EnvironmentBase* env, MM_MemoryH
 }
 
 bool
-MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size)
+MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t alignment, uintptr_t size, bool isDense)
 {
 	Assert_MM_true(NULL != handle);
 	Assert_MM_true(NULL == handle->getVirtualMemory());
@@ -435,6 +446,7 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 		uint32_t memoryCategory = OMRMEM_CATEGORY_MM;
 		MM_VirtualMemory* instance = NULL;
 		bool isOverAllocationRequested = false;
+		bool transparentHugePages = false;
 
 		/* memory consumer might expect memory to be aligned so allocate a little bit more */
 		uintptr_t allocateSize = size + ((2 * alignment) - 1);
@@ -450,6 +462,18 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			uintptr_t pageFlags = extensions->gcmetadataPageFlags;
 			Assert_MM_true(0 != pageSize);
 
+			if (extensions->transparentHugePageLayout && !isLargePage(env, pageSize)) {
+				if (isDense) {
+					/* reserve whole huge pages, starting on a huge page */
+					transparentHugePages = true;
+					alignment = OMR_MAX(alignment, extensions->transparentHugePageSize);
+					allocateSize = MM_Math::roundToCeiling(extensions->transparentHugePageSize, size) + ((2 * alignment) - 1);
+				} else {
+					/* a huge page would commit far more of sparsely touched metadata than is used */
+					options |= OMRPORT_VMEM_NO_HUGEPAGE;
+				}
+			}
+
 			/*
 			 * Preallocation is enabled for all platforms where metadata can be allocated in virtual memory
 			 * Segmentation is enabled for AIX-64 only, so physical page size is used as a segment size for other platforms
@@ -493,6 +517,13 @@ MM_MemoryManager::createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_Mem
 			handle->setMemoryBase(instance->getHeapBase());
 			handle->setMemoryTop((void*)((uintptr_t)instance->getHeapBase() + size));
 
+			if (transparentHugePages) {
+				instance->setTransparentHugePageSize(extensions->transparentHugePageSize);
+				_transparentHugePageAlignedBytes += MM_Math::roundToCeiling(extensions->transparentHugePageSize, size);
+			} else if (extensions->transparentHugePageLayout) {
+				_smallPageBytes += size;
+			}
+
 			/*
 			 * Setup preallocated memory if over-allocation has been requested
 			 */
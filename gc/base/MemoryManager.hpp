@@ -38,6 +38,8 @@ class MM_MemoryManager : public MM_BaseNonVirtual {
 	 */
 private:
 	MM_MemoryHandle _preAllocated; /**< stored preallocated memory parameters in case of over-allocation */
+	uintptr_t _transparentHugePageAlignedBytes; /**< bytes of heap and dense metadata reserved in whole transparent huge pages (transparentHugePageLayout only) */
+	uintptr_t _smallPageBytes; /**< bytes of heap and metadata reserved outside of transparent huge pages (transparentHugePageLayout only) */
 
 protected:
 public:
@@ -114,6 +116,8 @@ protected:
 
 	MM_MemoryManager(MM_EnvironmentBase* env)
 		: _preAllocated()
+		, _transparentHugePageAlignedBytes(0)
+		, _smallPageBytes(0)
 	{
 		_typeId = __FUNCTION__;
 	};
@@ -156,9 +160,29 @@ public:
 	 * @param[in/out] handle pointer to memory handle
 	 * @param heapAlignment required heap alignment
 	 * @param size required memory size
+	 * @param isDense true if all of the metadata is touched in every cycle (like the mark map), so that it is worth
+	 * backing with transparent huge pages when transparentHugePageLayout is set; sparse metadata is kept off them
 	 * @return true if pointer to virtual memory is not NULL
 	 */
-	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size);
+	bool createVirtualMemoryForMetadata(MM_EnvironmentBase* env, MM_MemoryHandle* handle, uintptr_t heapAlignment, uintptr_t size, bool isDense = false);
+
+	/**
+	 * Return the bytes of heap and metadata reserved in whole transparent huge pages, when transparentHugePageLayout is set
+	 */
+	MMINLINE uintptr_t getTransparentHugePageAlignedBytes()
+	{
+		return _transparentHugePageAlignedBytes;
+	}
+
+	/**
+	 * Return the percentage of the heap and metadata reserved in whole transparent huge pages, when transparentHugePageLayout is set.
+	 * This is the part the kernel is able to back with huge pages, not the part it does (AnonHugePages) which is not measured.
+	 */
+	MMINLINE uintptr_t getTransparentHugePageAlignedPercent()
+	{
+		uintptr_t totalBytes = _transparentHugePageAlignedBytes + _smallPageBytes;
+		return (0 == totalBytes) ? 0 : (uintptr_t)(((uint64_t)_transparentHugePageAlignedBytes * 100) / totalBytes);
+	}
 
 	/**
 	 * Destroy virtual memory instance
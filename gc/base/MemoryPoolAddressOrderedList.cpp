@@ -139,6 +139,9 @@ MM_MemoryPoolAddressOrderedList::initialize(MM_EnvironmentBase *env)
 	}
 	_hintInactive = previousInactiveHint;
 
+	_freeListBinsEnabled = ext->freeListBins;
+	resetFreeListBins();
+
 	return true;
 }
 
@@ -408,6 +411,185 @@ MM_MemoryPoolAddressOrderedList::updateHintsBeyondEntry(MM_HeapLinkedFreeHeader
 		/* Move to the next hint */
 		hint = hint->next;
 	}
+
+	/* the entries to be connected may fall in any bin */
+	resetFreeListBins();
+}
+
+/****************************************
+ * Free list bins
+ ****************************************
+ */
+
+/**
+ * Forget what the bins have learned: any bin may hold free entries, and searches start at the head of the list.
+ * Used whenever entries are added to the list, or when it is changed other than by an allocate.
+ */
+void
+MM_MemoryPoolAddressOrderedList::resetFreeListBins()
+{
+	if (_freeListBinsEnabled) {
+		_freeListBinMap = UDATA_MAX;
+		memset(_freeListBinPrevious, 0, sizeof(_freeListBinPrevious));
+	}
+}
+
+/**
+ * An allocate replaced a free entry in the list, either with its remainder or with the entry before it (if
+ * the free entry is consumed).  The bins which started their searches after the free entry start after its
+ * replacement.
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::replaceFreeListBinPrevious(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry)
+{
+	for (uintptr_t bin = 0; bin < J9BITS_BITS_IN_SLOT; bin++) {
+		if (oldFreeEntry == _freeListBinPrevious[bin]) {
+			_freeListBinPrevious[bin] = newFreeEntry;
+		}
+	}
+}
+
+/**
+ * Learn from an allocate search which started after the previous entry of searchBin and skipped the entries up to
+ * lastSkippedEntry, none of them larger than largestSkippedSize.  The bins above all the skipped entries can start
+ * their searches after lastSkippedEntry if the search found an entry, or are empty if it reached the end of the list.
+ */
+MMINLINE void
+MM_MemoryPoolAddressOrderedList::updateFreeListBins(uintptr_t searchBin, uintptr_t largestSkippedSize, MM_HeapLinkedFreeHeader *lastSkippedEntry, bool found)
+{
+	uintptr_t lowestBin = searchBin;
+	if (0 != largestSkippedSize) {
+		lowestBin = OMR_MAX(lowestBin, getFreeListBin(largestSkippedSize) + 1);
+	}
+
+	if (lowestBin < J9BITS_BITS_IN_SLOT) {
+		uintptr_t binMask = UDATA_MAX << lowestBin;
+		if (found) {
+			uintptr_t binMap = _freeListBinMap & binMask;
+			while (0 != binMap) {
+				uintptr_t bin = MM_Bits::leadingZeroes(binMap);
+				MM_HeapLinkedFreeHeader *binPrevious = _freeListBinPrevious[bin];
+				if ((NULL == binPrevious) || (binPrevious < lastSkippedEntry)) {
+					_freeListBinPrevious[bin] = lastSkippedEntry;
+				}
+				/* clear the lowest set bit */
+				binMap &= binMap - 1;
+			}
+		} else {
+			_freeListBinMap &= ~binMask;
+		}
+	}
+}
+
+/**
+ * Walk the free list to find the first entry of each bin, or that the bin is empty.
+ * @param[out] binMap the bins which hold free entries
+ * @param[out] binPrevious for each bin, the entry before the first entry of the bin or of a larger one
+ */
+void
+MM_MemoryPoolAddressOrderedList::indexFreeListBins(uintptr_t *binMap, MM_HeapLinkedFreeHeader **binPrevious)
+{
+	*binMap = 0;
+	uintptr_t binMask = UDATA_MAX;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	while (NULL != currentFreeEntry) {
+		uintptr_t bin = getFreeListBin(currentFreeEntry->getSize());
+		*binMap |= (uintptr_t)1 << bin;
+		/* the bins up to this one, which have not seen a larger entry yet, start after the previous entry */
+		uintptr_t firstBins = binMask & (UDATA_MAX >> ((J9BITS_BITS_IN_SLOT - 1) - bin));
+		while (0 != firstBins) {
+			uintptr_t firstBin = MM_Bits::leadingZeroes(firstBins);
+			binPrevious[firstBin] = previousFreeEntry;
+			firstBins &= firstBins - 1;
+		}
+		binMask &= ~(UDATA_MAX >> ((J9BITS_BITS_IN_SLOT - 1) - bin));
+		previousFreeEntry = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext();
+	}
+	/* the bins above the largest entry are empty, any search for them would start after the last entry */
+	while (0 != binMask) {
+		uintptr_t emptyBin = MM_Bits::leadingZeroes(binMask);
+		binPrevious[emptyBin] = previousFreeEntry;
+		binMask &= binMask - 1;
+	}
+}
+
+/**
+ * Index the free list once it is rebuilt.
+ */
+void
+MM_MemoryPoolAddressOrderedList::rebuildFreeListBins()
+{
+	if (_freeListBinsEnabled) {
+		indexFreeListBins(&_freeListBinMap, _freeListBinPrevious);
+	}
+}
+
+/**
+ * Check the bins against an index rebuilt from the free list (see GCExtensionsBase::fvtest_verifyFreeListBins).
+ * The bins may be behind the rebuilt index, never ahead of it: a bin that holds entries must be in the bin map, and a search
+ * must not start past the first entry of its bin or of a larger one.
+ * @note the caller must hold the pool lock
+ */
+void
+MM_MemoryPoolAddressOrderedList::verifyFreeListBins()
+{
+	uintptr_t binMap = 0;
+	MM_HeapLinkedFreeHeader *binPrevious[J9BITS_BITS_IN_SLOT];
+	indexFreeListBins(&binMap, binPrevious);
+
+	Assert_MM_true(binMap == (binMap & _freeListBinMap));
+
+	/* a search for a bin above the largest entry fails wherever it starts */
+	uintptr_t orderedBins = 0;
+	if (0 != binMap) {
+		orderedBins = UDATA_MAX >> ((J9BITS_BITS_IN_SLOT - 1) - getFreeListBin(binMap));
+	}
+
+	/* the start of every bin a search can use is in the list */
+	uintptr_t unseenBins = 0;
+	uintptr_t bins = _freeListBinMap;
+	while (0 != bins) {
+		uintptr_t bin = MM_Bits::leadingZeroes(bins);
+		if (NULL != _freeListBinPrevious[bin]) {
+			unseenBins |= (uintptr_t)1 << bin;
+		}
+		bins &= bins - 1;
+	}
+
+	MM_HeapLinkedFreeHeader *currentFreeEntry = _heapFreeList;
+	while ((NULL != currentFreeEntry) && (0 != unseenBins)) {
+		bins = unseenBins;
+		while (0 != bins) {
+			uintptr_t bin = MM_Bits::leadingZeroes(bins);
+			if (currentFreeEntry == _freeListBinPrevious[bin]) {
+				if (0 != (orderedBins & ((uintptr_t)1 << bin))) {
+					Assert_MM_true((NULL != binPrevious[bin]) && (currentFreeEntry <= binPrevious[bin]));
+				}
+				unseenBins &= ~((uintptr_t)1 << bin);
+			}
+			bins &= bins - 1;
+		}
+		currentFreeEntry = currentFreeEntry->getNext();
+	}
+	Assert_MM_true(0 == unseenBins);
+}
+
+void
+MM_MemoryPoolAddressOrderedList::postProcess(MM_EnvironmentBase *env, Cause cause)
+{
+	if (forSweep == cause) {
+		MM_FreeEntrySizeClassStats *freeEntrySizeClassStats = _largeObjectAllocateStats->getFreeEntrySizeClassStats();
+		Trc_MM_MemoryPoolAddressOrderedList_allocateSearchLengths(env->getLanguageVMThread(), getPoolName(),
+			freeEntrySizeClassStats->getSearchLengthCount(0), freeEntrySizeClassStats->getSearchLengthCount(1),
+			freeEntrySizeClassStats->getSearchLengthCount(2), freeEntrySizeClassStats->getSearchLengthCount(3),
+			freeEntrySizeClassStats->getSearchLengthCount(4), freeEntrySizeClassStats->getSearchLengthCount(5),
+			freeEntrySizeClassStats->getSearchLengthCount(6), freeEntrySizeClassStats->getSearchLengthCount(7));
+		freeEntrySizeClassStats->resetSearchLengthCounts();
+	}
+
+	rebuildFreeListBins();
 }
 
 /****************************************
@@ -422,6 +604,7 @@ MM_MemoryPoolAddressOrderedList::internalAllocate(MM_EnvironmentBase *env, uintp
 	uintptr_t recycleEntrySize;
 	uintptr_t walkCount;
 	J9ModronAllocateHint *allocateHintUsed;
+	uintptr_t searchBin;
 	void *addrBase;
 	uintptr_t largestFreeEntry = 0;
 	
@@ -438,12 +621,31 @@ retry:
 	walkCount = 0;
 	allocateHintUsed = NULL;
 	candidateHintSize = 0;
+	searchBin = J9BITS_BITS_IN_SLOT;
+
+	if (_freeListBinsEnabled && _extensions->fvtest_verifyFreeListBins) {
+		verifyFreeListBins();
+	}
 
-	/* Large object - use a hint if it is available */
-	allocateHintUsed = findHint(sizeInBytesRequired);
-	if(allocateHintUsed) {
-		currentFreeEntry = allocateHintUsed->heapFreeHeader;
-		candidateHintSize = allocateHintUsed->size;
+	if (_freeListBinsEnabled) {
+		/* Start after the entries known to be smaller than the lowest bin that may satisfy the allocate */
+		uintptr_t binMap = _freeListBinMap & (UDATA_MAX << getFreeListBin(sizeInBytesRequired));
+		if (0 == binMap) {
+			currentFreeEntry = NULL;
+		} else {
+			searchBin = MM_Bits::leadingZeroes(binMap);
+			previousFreeEntry = _freeListBinPrevious[searchBin];
+			if (NULL != previousFreeEntry) {
+				currentFreeEntry = previousFreeEntry->getNext();
+			}
+		}
+	} else {
+		/* Large object - use a hint if it is available */
+		allocateHintUsed = findHint(sizeInBytesRequired);
+		if(allocateHintUsed) {
+			currentFreeEntry = allocateHintUsed->heapFreeHeader;
+			candidateHintSize = allocateHintUsed->size;
+		}
 	}
 
 	while(currentFreeEntry) {
@@ -468,8 +670,13 @@ retry:
 		Assert_MM_true((NULL == currentFreeEntry) || (currentFreeEntry > previousFreeEntry));
 	}
 
+	_largeObjectAllocateStats->getFreeEntrySizeClassStats()->recordSearchLength(walkCount);
+
 	/* Check if an entry was found */
 	if(!currentFreeEntry) {
+		if (searchBin < J9BITS_BITS_IN_SLOT) {
+			updateFreeListBins(searchBin, candidateHintSize, previousFreeEntry, false);
+		}
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 		if(_memorySubSpace->replenishPoolForAllocate(env, this, sizeInBytesRequired)) {
 			goto retry;
@@ -479,7 +686,11 @@ retry:
 	}
 
 	_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
-	if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
+	if (_freeListBinsEnabled) {
+		if (walkCount > 0) {
+			updateFreeListBins(searchBin, candidateHintSize, previousFreeEntry, true);
+		}
+	} else if((walkCount >= J9MODRON_ALLOCATION_MANAGER_HINT_MAX_WALK) || ((walkCount > 1) && allocateHintUsed)) {
 		addHint(previousFreeEntry, candidateHintSize);
 	}
 
@@ -500,6 +711,10 @@ retry:
 	if (recycleHeapChunk(recycleEntry, ((uint8_t *)recycleEntry) + recycleEntrySize, previousFreeEntry, currentFreeEntry->getNext())) {
 		updateHint(currentFreeEntry, recycleEntry);
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+		if (_freeListBinsEnabled) {
+			replaceFreeListBinPrevious(currentFreeEntry, recycleEntry);
+			_freeListBinMap |= (uintptr_t)1 << getFreeListBin(recycleEntrySize);
+		}
 	} else {
 		/* Adjust the free memory size and count */
 		_freeMemorySize -= recycleEntrySize;
@@ -510,6 +725,9 @@ retry:
 
 		/* Removed from the free list - Kill the hint if necessary */
 		removeHint(currentFreeEntry);
+		if (_freeListBinsEnabled) {
+			replaceFreeListBinPrevious(currentFreeEntry, previousFreeEntry);
+		}
 	}
 	
 	/* Collector object allocate stats for Survivor are not interesting (_largeObjectCollectorAllocateStats is null for Survivor) */	
@@ -517,6 +735,10 @@ retry:
 		largeObjectAllocateStats->allocateObject(sizeInBytesRequired);
 	}
 
+	if (_freeListBinsEnabled && _extensions->fvtest_verifyFreeListBins) {
+		verifyFreeListBins();
+	}
+
 	if(lockingRequired) {
 			_heapLock.release();
 		}
@@ -567,13 +789,99 @@ MM_MemoryPoolAddressOrderedList::collectorAllocate(MM_EnvironmentBase *env, MM_A
 	return addr;
 }
 
+/**
+ * Find the slice of a nursery pool that TLHs (and survivor copy caches) for the thread should come from.
+ * The slices of the semispaces are bound to the NUMA nodes of the affinity leaders when numaAwareNursery is enabled.
+ * @return true if the thread has a slice in the pool, false if TLHs can come from anywhere in the pool
+ */
+bool
+MM_MemoryPoolAddressOrderedList::getNumaNurserySlice(MM_EnvironmentBase *env, void **sliceBase, void **sliceTop)
+{
+	bool result = false;
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->numaAwareNursery && (MEMORY_TYPE_NEW == _memorySubSpace->getTypeFlags())) {
+		MM_HeapRegionDescriptor *region = _memorySubSpace->getFirstRegion();
+		if (NULL != region) {
+			result = extensions->_numaManager.getAffinityLeaderSlice(env->getNumaNurseryNode(), region->getLowAddress(), region->getHighAddress(), extensions->heap->getPageSize(), sliceBase, sliceTop);
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+	return result;
+}
+
+/**
+ * Find the free entry to allocate a TLH from when the TLH should come from a preferred range of the pool
+ * (the NUMA node slice of the allocating thread).  The first entry which reaches into the range is used, and
+ * split at the base of the range if it starts below it.  If no entry reaches into the range within
+ * PREFERRED_FREE_ENTRY_SEARCH_LIMIT entries, the head entry is used.
+ * @note The caller holds the pool lock
+ * @param[in] headFreeEntry the first entry on the free list
+ * @param[out] previousFreeEntry the entry linked to the returned entry, NULL if the returned entry is the head
+ * @return the free entry to allocate the TLH from
+ */
+MM_HeapLinkedFreeHeader *
+MM_MemoryPoolAddressOrderedList::findPreferredFreeEntry(MM_HeapLinkedFreeHeader *headFreeEntry, void *preferredBase, void *preferredTop, MM_HeapLinkedFreeHeader **previousFreeEntry)
+{
+	MM_HeapLinkedFreeHeader *currentFreeEntry = headFreeEntry;
+	MM_HeapLinkedFreeHeader *currentPrevious = NULL;
+	uintptr_t searchCount = 0;
+
+	while ((NULL != currentFreeEntry) && ((void *)currentFreeEntry->afterEnd() <= preferredBase)) {
+		if (PREFERRED_FREE_ENTRY_SEARCH_LIMIT == ++searchCount) {
+			/* the range is too far down a fragmented list - not worth holding the pool lock for */
+			currentFreeEntry = NULL;
+			break;
+		}
+		currentPrevious = currentFreeEntry;
+		currentFreeEntry = currentFreeEntry->getNext();
+	}
+
+	if ((NULL == currentFreeEntry) || ((void *)currentFreeEntry >= preferredTop)) {
+		/* nothing left in the preferred range */
+		*previousFreeEntry = NULL;
+		return headFreeEntry;
+	}
+
+	if ((void *)currentFreeEntry < preferredBase) {
+		uintptr_t currentFreeEntrySize = currentFreeEntry->getSize();
+		uintptr_t leadingSize = (uintptr_t)preferredBase - (uintptr_t)currentFreeEntry;
+		if ((leadingSize >= _minimumFreeEntrySize) && ((currentFreeEntrySize - leadingSize) >= _minimumFreeEntrySize)) {
+			/* Split the entry at the base of the range, leaving the part below the range on the free list.
+			 * Both parts are smaller than the entry, so the hints and the bin searches which passed it stay valid.
+			 */
+			void *currentFreeEntryTop = (void *)currentFreeEntry->afterEnd();
+			MM_HeapLinkedFreeHeader *currentNext = currentFreeEntry->getNext();
+			MM_HeapLinkedFreeHeader *splitEntry = (MM_HeapLinkedFreeHeader *)preferredBase;
+			recycleHeapChunk(splitEntry, currentFreeEntryTop, currentFreeEntry, currentNext);
+			recycleHeapChunk(currentFreeEntry, splitEntry, currentPrevious, splitEntry);
+
+			_largeObjectAllocateStats->decrementFreeEntrySizeClassStats(currentFreeEntrySize);
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(leadingSize);
+			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(currentFreeEntrySize - leadingSize);
+			_freeEntryCount += 1;
+			if (_freeListBinsEnabled) {
+				_freeListBinMap |= (uintptr_t)1 << getFreeListBin(leadingSize);
+				_freeListBinMap |= (uintptr_t)1 << getFreeListBin(currentFreeEntrySize - leadingSize);
+			}
+
+			currentPrevious = currentFreeEntry;
+			currentFreeEntry = splitEntry;
+		}
+	}
+
+	*previousFreeEntry = currentPrevious;
+	return currentFreeEntry;
+}
+
 MMINLINE bool
-MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats)
+MM_MemoryPoolAddressOrderedList::internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats, void *preferredBase, void *preferredTop)
 {
 	uintptr_t freeEntrySize = 0;
 	void *topOfRecycledChunk = NULL;
 	MM_HeapLinkedFreeHeader *entryNext = NULL;
 	MM_HeapLinkedFreeHeader *freeEntry = NULL;
+	MM_HeapLinkedFreeHeader *previousFreeEntry = NULL;
 	uintptr_t consumedSize = 0;
 	uintptr_t recycleEntrySize = 0;
 	
@@ -601,6 +909,10 @@ retry:
 	}
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
+	if (NULL != preferredBase) {
+		freeEntry = findPreferredFreeEntry(freeEntry, preferredBase, preferredTop, &previousFreeEntry);
+	}
+
 	/* Consume the bytes and set the return pointer values */
 	freeEntrySize = freeEntry->getSize();
 	Assert_MM_true(freeEntrySize >= _minimumFreeEntrySize);
@@ -631,20 +943,48 @@ retry:
 	if (recycleEntrySize > 0) {
 		topOfRecycledChunk = ((uint8_t *)addrTop) + recycleEntrySize;
 		/* Recycle the remaining entry back onto the free list (if applicable) */
-		if (recycleHeapChunk(addrTop, topOfRecycledChunk, NULL, entryNext)) {
+		if (recycleHeapChunk(addrTop, topOfRecycledChunk, previousFreeEntry, entryNext)) {
 			_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(recycleEntrySize);
+			if (NULL != previousFreeEntry) {
+				/* hints below the head go stale on their own, but not those in the middle of the list */
+				updateHint(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop);
+			}
+			if (_freeListBinsEnabled) {
+				replaceFreeListBinPrevious(freeEntry, (MM_HeapLinkedFreeHeader *)addrTop);
+				_freeListBinMap |= (uintptr_t)1 << getFreeListBin(recycleEntrySize);
+			}
 		} else {
 			/* Adjust the free memory size and count */
 			_freeMemorySize -= recycleEntrySize;
 			_freeEntryCount -= 1;
 
 			_allocDiscardedBytes += recycleEntrySize;
+			if (NULL != previousFreeEntry) {
+				removeHint(freeEntry);
+			}
+			if (_freeListBinsEnabled) {
+				replaceFreeListBinPrevious(freeEntry, previousFreeEntry);
+			}
+		}
+	} else if (NULL != previousFreeEntry) {
+		previousFreeEntry->setNext(entryNext);
+		_freeEntryCount -= 1;
+		removeHint(freeEntry);
+		if (_freeListBinsEnabled) {
+			replaceFreeListBinPrevious(freeEntry, previousFreeEntry);
 		}
 	} else {
 		/* If not recycling just update the free list pointer to the next free entry */
 		_heapFreeList = entryNext;
 		/* also update the freeEntryCount as recycleHeapChunk would do this */
 		_freeEntryCount -= 1;
+		if (_freeListBinsEnabled) {
+			replaceFreeListBinPrevious(freeEntry, NULL);
+		}
+	}
+
+	if (_freeListBinsEnabled && _extensions->fvtest_verifyFreeListBins) {
+		verifyFreeListBins();
 	}
 
 	if (lockingRequired) {
@@ -667,8 +1007,11 @@ MM_MemoryPoolAddressOrderedList::allocateTLH(MM_EnvironmentBase *env, MM_Allocat
 											uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop)
 {
 	void *tlhBase = NULL;
+	void *preferredBase = NULL;
+	void *preferredTop = NULL;
 
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats)) {
+	getNumaNurserySlice(env, &preferredBase, &preferredTop);
+	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, true, _largeObjectAllocateStats, preferredBase, preferredTop)) {
 		tlhBase = addrBase;
 	}
 
@@ -693,7 +1036,11 @@ MM_MemoryPoolAddressOrderedList::collectorAllocateTLH(MM_EnvironmentBase *env,
 													 void * &addrBase, void * &addrTop, bool lockingRequired)
 {
 	void *base = NULL;
-	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, lockingRequired, _largeObjectCollectorAllocateStats)) {
+	void *preferredBase = NULL;
+	void *preferredTop = NULL;
+
+	getNumaNurserySlice(env, &preferredBase, &preferredTop);
+	if (internalAllocateTLH(env, maximumSizeInBytesRequired, addrBase, addrTop, lockingRequired, _largeObjectCollectorAllocateStats, preferredBase, preferredTop)) {
 		base = addrBase;
 		allocDescription->setTLHAllocation(true);
 		allocDescription->setNurseryAllocation((_memorySubSpace->getTypeFlags() == MEMORY_TYPE_NEW) ? true : false);
@@ -714,6 +1061,7 @@ MM_MemoryPoolAddressOrderedList::reset(Cause cause)
 	MM_MemoryPool::reset(cause);
 
 	clearHints();
+	resetFreeListBins();
 	_heapFreeList = (MM_HeapLinkedFreeHeader *)NULL;
 
 	_lastFreeEntry = NULL;
@@ -806,6 +1154,8 @@ MM_MemoryPoolAddressOrderedList::expandWithRange(MM_EnvironmentBase *env, uintpt
 		return ;
 	}
 
+	resetFreeListBins();
+
 	/* Find the free entries in the list the appear before/after the range being added */
 	previousFreeEntry = NULL;
 	nextFreeEntry = _heapFreeList;
@@ -910,6 +1260,8 @@ MM_MemoryPoolAddressOrderedList::contractWithRange(MM_EnvironmentBase *env, uint
 		return NULL;
 	}
 
+	resetFreeListBins();
+
 	/* Find the free entry that encompasses the range to contract */
 	/* TODO: Could we use hints to find a better starting address?  Are hints still valid? */
 	previousFreeEntry = NULL;
@@ -997,6 +1349,8 @@ MM_MemoryPoolAddressOrderedList::addFreeEntries(MM_EnvironmentBase *env,
 
 	MM_HeapLinkedFreeHeader *currentFreeEntry = freeListHead;
 
+	resetFreeListBins();
+
 	while (currentFreeEntry != NULL) {
 		_largeObjectAllocateStats->incrementFreeEntrySizeClassStats(currentFreeEntry->getSize());
 		currentFreeEntry = currentFreeEntry->getNext();
@@ -1094,6 +1448,8 @@ MM_MemoryPoolAddressOrderedList::removeFreeEntriesWithinRange(MM_EnvironmentBase
 	retListMemoryCount = 0;
 	retListMemorySize = 0;
 
+	resetFreeListBins();
+
 	/* Find the first free entry, if any, within specified range */
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
@@ -1448,6 +1804,8 @@ MM_MemoryPoolAddressOrderedList::moveHeap(MM_EnvironmentBase *env, void *srcBase
 {
 	MM_HeapLinkedFreeHeader *currentFreeEntry, *previousFreeEntry;
 
+	resetFreeListBins();
+
 	previousFreeEntry = NULL;
 	currentFreeEntry = _heapFreeList;
 	while(currentFreeEntry) {
@@ -1497,6 +1855,8 @@ MM_MemoryPoolAddressOrderedList::recycleHeapChunk(void* chunkBase, void* chunkTo
 
 	_heapLock.acquire();
 
+	resetFreeListBins();
+
 	if ((NULL == _heapFreeList) || (chunkBase < (void*)_heapFreeList)) {
 		/* Add to front of freelist */
 		recycled = recycleHeapChunk(chunkBase, chunkTop, NULL, _heapFreeList);
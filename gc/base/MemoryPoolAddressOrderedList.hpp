@@ -27,12 +27,18 @@
 #include "omrcomp.h"
 #include "modronopt.h"
 
+#include "Bits.hpp"
 #include "HeapLinkedFreeHeader.hpp"
 #include "LightweightNonReentrantLock.hpp"
 #include "MemoryPoolAddressOrderedListBase.hpp"
 #include "HeapRegionDescriptor.hpp"
 #include "EnvironmentBase.hpp"
 
+/**
+ * Number of free entries a TLH allocate looks through for one reaching into the preferred range of the pool
+ */
+#define PREFERRED_FREE_ENTRY_SEARCH_LIMIT 64
+
 class MM_AllocateDescription;
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 class MM_ConcurrentSweepScheme;
@@ -57,6 +63,17 @@ private:
 	struct J9ModronAllocateHint* _hintInactive;
 	struct J9ModronAllocateHint _hintStorage[HINT_ELEMENT_COUNT];
 	uintptr_t _hintLru;
+
+	/* Free list bins (-Xgc:freeListBins).
+	 * Bin i holds the free entry sizes in [2^i, 2^(i+1)).  The bins are not lists of their own (a free entry has
+	 * no room for more links), they index the address ordered list so that coalescing is unaffected.  Every
+	 * entry up to and including the previous entry of a bin is smaller than the bin, so a first fit search can
+	 * start past it.  The index is conservative between sweeps: an empty bin is known to be empty, and the
+	 * previous entries only ever move towards the tail as searches walk the list.
+	 */
+	bool _freeListBinsEnabled; /**< true if allocate searches use the bin index */
+	uintptr_t _freeListBinMap; /**< bit i is clear if the pool has no free entry in bin i */
+	MM_HeapLinkedFreeHeader *_freeListBinPrevious[J9BITS_BITS_IN_SLOT]; /**< for each bin, the free entry a search starts after (NULL for the head of the list) */
 	
 	MM_LargeObjectAllocateStats *_largeObjectCollectorAllocateStats;  /**< Same as _largeObjectAllocateStats except specifically for collector allocates */
 
@@ -73,8 +90,25 @@ private:
 	void updateHint(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
 	void clearHints();
 	void updateHintsBeyondEntry(MM_HeapLinkedFreeHeader *freeEntry);
+
+	/**
+	 * @return the bin of a free entry of the given size
+	 */
+	MMINLINE static uintptr_t
+	getFreeListBin(uintptr_t size)
+	{
+		return (J9BITS_BITS_IN_SLOT - 1) - MM_Bits::trailingZeroes(size);
+	}
+	void resetFreeListBins();
+	void replaceFreeListBinPrevious(MM_HeapLinkedFreeHeader *oldFreeEntry, MM_HeapLinkedFreeHeader *newFreeEntry);
+	void updateFreeListBins(uintptr_t searchBin, uintptr_t largestSkippedSize, MM_HeapLinkedFreeHeader *lastSkippedEntry, bool found);
+	void indexFreeListBins(uintptr_t *binMap, MM_HeapLinkedFreeHeader **binPrevious);
+	void rebuildFreeListBins();
+	void verifyFreeListBins();
 	void *internalAllocate(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
-	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats);
+	bool internalAllocateTLH(MM_EnvironmentBase *env, uintptr_t maximumSizeInBytesRequired, void * &addrBase, void * &addrTop, bool lockingRequired, MM_LargeObjectAllocateStats *largeObjectAllocateStats, void *preferredBase = NULL, void *preferredTop = NULL);
+	MM_HeapLinkedFreeHeader *findPreferredFreeEntry(MM_HeapLinkedFreeHeader *headFreeEntry, void *preferredBase, void *preferredTop, MM_HeapLinkedFreeHeader **previousFreeEntry);
+	bool getNumaNurserySlice(MM_EnvironmentBase *env, void **sliceBase, void **sliceTop);
 
 	bool recycleHeapChunk(void *addrBase, void *addrTop, MM_HeapLinkedFreeHeader *previousFreeEntry, MM_HeapLinkedFreeHeader *nextFreeEntry);	
 	
@@ -142,6 +176,12 @@ public:
 	 */
 	virtual void recalculateMemoryPoolStatistics(MM_EnvironmentBase *env);
 
+	/**
+	 * Called once a sweep or a compaction has rebuilt the free list: the free list bins are rebuilt and, after
+	 * a sweep, the allocate search lengths of the cycle that ends are reported.
+	 */
+	virtual void postProcess(MM_EnvironmentBase *env, Cause cause);
+
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
 #endif
@@ -152,6 +192,8 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize)
 		,_heapFreeList(NULL)
+		,_freeListBinsEnabled(false)
+		,_freeListBinMap(UDATA_MAX)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -160,6 +202,8 @@ public:
 	MM_MemoryPoolAddressOrderedList(MM_EnvironmentBase *env, uintptr_t minimumFreeEntrySize, const char *name) :
 		MM_MemoryPoolAddressOrderedListBase(env, minimumFreeEntrySize, name)
 		,_heapFreeList(NULL)
+		,_freeListBinsEnabled(false)
+		,_freeListBinMap(UDATA_MAX)
 		,_largeObjectCollectorAllocateStats(NULL)
 	{
 		_typeId = __FUNCTION__;
@@ -191,6 +191,10 @@ MM_MemoryPoolAddressOrderedListBase::releaseFreeEntryMemoryPages(MM_EnvironmentB
 	uintptr_t releasedMemory = 0;
 	MM_HeapLinkedFreeHeader* currentFreeEntry = freeEntry;
 	uintptr_t pageSize = env->getExtensions()->heap->getPageSize();
+	if (_extensions->transparentHugePageLayout) {
+		/* the heap only decommits whole huge pages, count what is actually released */
+		pageSize = OMR_MAX(pageSize, _extensions->transparentHugePageSize);
+	}
 	while (NULL != currentFreeEntry) {
 		/* skip entry less than page size */
 		if (pageSize <= currentFreeEntry->getSize()) {
@@ -1157,4 +1157,14 @@ MM_MemoryPoolLargeObjects::releaseFreeMemoryPages(MM_EnvironmentBase* env)
 	releasedMemory += _memoryPoolLargeObjects->releaseFreeMemoryPages(env);
 	return releasedMemory;
 }
+
+uintptr_t
+MM_MemoryPoolLargeObjects::releaseLOAFreeMemoryPages(MM_EnvironmentBase* env)
+{
+	uintptr_t releasedMemory = 0;
+	if (LOA_EMPTY != _currentLOABase) {
+		releasedMemory = _memoryPoolLargeObjects->releaseFreeMemoryPages(env);
+	}
+	return releasedMemory;
+}
 #endif
@@ -225,6 +225,13 @@ public:
 
 #if defined(OMR_GC_IDLE_HEAP_MANAGER)
 	virtual uintptr_t releaseFreeMemoryPages(MM_EnvironmentBase* env);
+
+	/**
+	 * Decommit the pages of the free entries of the LOA only. Large objects are mostly freed in
+	 * multi-page extents which may not be allocated again for a while.
+	 * @return the number of bytes released
+	 */
+	uintptr_t releaseLOAFreeMemoryPages(MM_EnvironmentBase* env);
 #endif
 
 	/**
@@ -658,8 +658,8 @@ MM_MemorySubSpaceSemiSpace::masterTeardownForSuccessfulGC(MM_EnvironmentBase *en
 {
 	_memorySubSpaceEvacuate->rebuildFreeList(env);
 
-	/* Flip the memory space allocate profile */
-	if (!_extensions->isConcurrentScavengerEnabled()) {
+	/* Flip the memory space allocate profile (a concurrent cycle flipped it when the cycle started) */
+	if (!_extensions->isConcurrentScavengeCycle()) {
 		flip(env, set_allocate);
 		flip(env, disable_allocation);
 	}
@@ -675,7 +675,7 @@ void
 MM_MemorySubSpaceSemiSpace::masterTeardownForAbortedGC(MM_EnvironmentBase *env)
 {
 	/* Build free list in survivor. */
-	if (_extensions->isConcurrentScavengerEnabled()) {
+	if (_extensions->isConcurrentScavengeCycle()) {
 		/* There might be live objects in Survivor (newly allocated one since the start of Concurrent Scavenge cycle)
 		 * Sweep in percolate global will rebuild it, so we can skip it here
 		 */
@@ -1006,6 +1006,48 @@ MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectResize(MM_EnvironmentB
 	}
 }
 
+/**
+ * Adjust the sub space memory as decided by the scavenger pause target controller (scavengerPauseTarget).
+ * The decisions are recorded in the scavenger stats of the last scavenge, and are consumed here so that
+ * a later global collect does not apply them again.
+ */
+void
+MM_MemorySubSpaceSemiSpace::checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = MM_GCExtensionsBase::getExtensions(env->getOmrVM());
+	MM_ScavengerStats *scavengerStats = &extensions->scavengerStats;
+	uintptr_t regionSize = extensions->getHeap()->getHeapRegionManager()->getRegionSize();
+	uintptr_t currentSize = getCurrentSize();
+	uintptr_t resizedSize = currentSize;
+
+	if (extensions->dynamicNewSpaceSizing && (NULL != _physicalSubArena)) {
+		if ((0 != scavengerStats->_pauseTargetContractSize) && _physicalSubArena->canContract(env) && (0 != maxContractionInSpace(env))) {
+			_contractionSize = MM_Math::roundToCeiling(extensions->heapAlignment, scavengerStats->_pauseTargetContractSize);
+			_contractionSize = MM_Math::roundToCeiling(regionSize, _contractionSize);
+			if (_contractionSize < currentSize) {
+				resizedSize -= _contractionSize;
+			}
+			extensions->heap->getResizeStats()->setLastContractReason(SCAV_PAUSE_TARGET_EXCEEDED);
+		} else if ((0 != scavengerStats->_pauseTargetExpandSize) && _physicalSubArena->canExpand(env) && (0 != maxExpansionInSpace(env))) {
+			_expansionSize = MM_Math::roundToCeiling(extensions->heapAlignment, scavengerStats->_pauseTargetExpandSize);
+			_expansionSize = MM_Math::roundToCeiling(2 * regionSize, _expansionSize);
+			resizedSize += _expansionSize;
+			extensions->heap->getResizeStats()->setLastExpandReason(SCAV_THROUGHPUT_GOAL_MISSED);
+		}
+	}
+
+	if (extensions->tiltedScavenge && (0 != scavengerStats->_pauseTargetSurvivorSize)) {
+		/* the tilt is applied ahead of the resize, so make it the ratio of the resized nursery */
+		_desiredSurvivorSpaceRatio = (double)scavengerStats->_pauseTargetSurvivorSize / (double)resizedSize;
+		_desiredSurvivorSpaceRatio = OMR_MAX(_desiredSurvivorSpaceRatio, extensions->survivorSpaceMinimumSizeRatio);
+		_desiredSurvivorSpaceRatio = OMR_MIN(_desiredSurvivorSpaceRatio, extensions->survivorSpaceMaximumSizeRatio);
+	}
+
+	scavengerStats->_pauseTargetContractSize = 0;
+	scavengerStats->_pauseTargetExpandSize = 0;
+	scavengerStats->_pauseTargetSurvivorSize = 0;
+}
+
 /**
  * Adjust the sub space memory consumed after a collect.
  * Adjusting semi space memory consumed after a collect includes changing the tilt and/or
@@ -1020,6 +1062,8 @@ MM_MemorySubSpaceSemiSpace::checkResize(MM_EnvironmentBase *env, MM_AllocateDesc
 	 * we have to restore tilt (that has been set to 100% to do unified sliding compact of Nursery */
 	if (_extensions->isConcurrentScavengerEnabled() && _extensions->isScavengerBackOutFlagRaised()) {
 		flip(env, MM_MemorySubSpaceSemiSpace::restore_tilt_after_percolate);
+	} else if (0 != _extensions->scavengerPauseTarget) {
+		checkSubSpaceMemoryPostCollectPauseTarget(env);
 	} else {
 		checkSubSpaceMemoryPostCollectTilt(env);
 		checkSubSpaceMemoryPostCollectResize(env);
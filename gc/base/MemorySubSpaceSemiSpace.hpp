@@ -102,6 +102,7 @@ private:
 
 	void checkSubSpaceMemoryPostCollectTilt(MM_EnvironmentBase *env);
 	void checkSubSpaceMemoryPostCollectResize(MM_EnvironmentBase *env);
+	void checkSubSpaceMemoryPostCollectPauseTarget(MM_EnvironmentBase *env);
 
 protected:
 	virtual void *allocationRequestFailed(MM_EnvironmentBase *env, MM_AllocateDescription *allocateDescription, AllocationType allocationType, MM_ObjectAllocationInterface *objectAllocationInterface, MM_MemorySubSpace *baseSubSpace, MM_MemorySubSpace *previousSubSpace);
@@ -32,6 +32,7 @@
 
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
+#include "Math.hpp"
 #include "ModronAssertions.h"
 #include "NUMAManager.hpp"
 
@@ -207,6 +208,21 @@ MM_NUMAManager::getAffinityLeaderCount() const
 	return _affinityLeaderCount;
 }
 
+bool
+MM_NUMAManager::getAffinityLeaderSlice(uintptr_t affinityLeaderIndex, void *base, void *top, uintptr_t alignment, void **sliceBase, void **sliceTop) const
+{
+	bool result = false;
+	if ((_affinityLeaderCount > 1) && (affinityLeaderIndex > 0) && (affinityLeaderIndex <= _affinityLeaderCount)) {
+		uintptr_t sliceSize = MM_Math::roundToFloor(alignment, ((uintptr_t)top - (uintptr_t)base) / _affinityLeaderCount);
+		if (0 != sliceSize) {
+			*sliceBase = (void *)((uintptr_t)base + (sliceSize * (affinityLeaderIndex - 1)));
+			*sliceTop = (affinityLeaderIndex == _affinityLeaderCount) ? top : (void *)((uintptr_t)*sliceBase + sliceSize);
+			result = true;
+		}
+	}
+	return result;
+}
+
 uintptr_t
 MM_NUMAManager::getMaximumNodeNumber() const
 {
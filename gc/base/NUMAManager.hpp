@@ -136,6 +136,19 @@ public:
 	 */
 	uintptr_t getComputationalResourcesAvailableForAllNodes() const;
 
+	/**
+	 * Split a range of memory into equal, aligned slices - one for each affinity leader - so that memory can be bound to
+	 * and allocated from the node of the thread which uses it.  The last slice absorbs any remainder.
+	 * @param affinityLeaderIndex[in] The affinity leader to find the slice for, starting from 1
+	 * @param base[in] The base of the range to split
+	 * @param top[in] The top of the range to split
+	 * @param alignment[in] The alignment of the slice boundaries (a power of two)
+	 * @param sliceBase[out] The base of the slice
+	 * @param sliceTop[out] The top of the slice
+	 * @return True if the slice was found, false if there are fewer than two affinity leaders or the range is too small to split
+	 */
+	bool getAffinityLeaderSlice(uintptr_t affinityLeaderIndex, void *base, void *top, uintptr_t alignment, void **sliceBase, void **sliceTop) const;
+
 	/**
 	 * @return True if NUMA is enabled and the underlying system exposes NUMA capabilities (false will be returned if we are simulating NUMA since that isn't "physical")
 	 */
@@ -0,0 +1,163 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#include "ObjectCopy.hpp"
+
+#if defined(OMR_GC_OBJECT_COPY_X86)
+#include <immintrin.h>
+#endif
+
+/* Distance (in bytes) ahead of the copy at which the source is prefetched */
+#define OBJECT_COPY_PREFETCH_DISTANCE 512
+
+void
+MM_ObjectCopy::initialize(uintptr_t nonTemporalThreshold)
+{
+	selectKernel(kernel_memcpy);
+	_nonTemporalThreshold = UDATA_MAX;
+	Kernel kernel = getNonTemporalKernel();
+	if ((0 != nonTemporalThreshold) && (kernel_memcpy != kernel)) {
+		/* the small object tier always takes precedence */
+		_nonTemporalThreshold = OMR_MAX(nonTemporalThreshold, (uintptr_t)SMALL_OBJECT_COPY_MAXIMUM + 1);
+		selectKernel(kernel);
+	}
+}
+
+bool
+MM_ObjectCopy::selectKernel(Kernel kernel)
+{
+	bool selected = false;
+	if (isKernelSupported(kernel)) {
+		_kernel = kernel;
+		_copyNonTemporal = getKernelFunction(kernel);
+		selected = true;
+	}
+	return selected;
+}
+
+bool
+MM_ObjectCopy::isKernelSupported(Kernel kernel)
+{
+	bool supported = false;
+	switch (kernel) {
+	case kernel_memcpy:
+		supported = true;
+		break;
+#if defined(OMR_GC_OBJECT_COPY_X86)
+	case kernel_sse2:
+		supported = (0 != __builtin_cpu_supports("sse2"));
+		break;
+#endif /* OMR_GC_OBJECT_COPY_X86 */
+	default:
+		break;
+	}
+	return supported;
+}
+
+MM_ObjectCopy::Kernel
+MM_ObjectCopy::getNonTemporalKernel()
+{
+	Kernel kernel = kernel_memcpy;
+	if (isKernelSupported(kernel_sse2)) {
+		kernel = kernel_sse2;
+	}
+	return kernel;
+}
+
+MM_ObjectCopy::CopyFunction
+MM_ObjectCopy::getKernelFunction(Kernel kernel)
+{
+	CopyFunction function = NULL;
+	switch (kernel) {
+	case kernel_memcpy:
+		function = copyMemcpy;
+		break;
+#if defined(OMR_GC_OBJECT_COPY_X86)
+	case kernel_sse2:
+		function = copyNonTemporalSSE2;
+		break;
+#endif /* OMR_GC_OBJECT_COPY_X86 */
+	default:
+		break;
+	}
+	return function;
+}
+
+const char *
+MM_ObjectCopy::getKernelName(Kernel kernel)
+{
+	switch (kernel) {
+	case kernel_memcpy:
+		return "memcpy";
+	case kernel_sse2:
+		return "sse2-nt";
+	default:
+		return "unknown";
+	}
+}
+
+void
+MM_ObjectCopy::copyMemcpy(void *destination, const void *source, uintptr_t size)
+{
+	memcpy(destination, source, size);
+}
+
+#if defined(OMR_GC_OBJECT_COPY_X86)
+/* Streaming stores need a 16 byte aligned destination: the bytes up to the first boundary and the tail are
+ * copied with regular stores.  The source is read once and left behind, so it is prefetched non-temporally too.
+ * The stores are fenced before returning, since the caller goes on to fix up and publish the object.
+ */
+__attribute__((target("sse2"))) void
+MM_ObjectCopy::copyNonTemporalSSE2(void *destination, const void *source, uintptr_t size)
+{
+	uint8_t *to = (uint8_t *)destination;
+	const uint8_t *from = (const uint8_t *)source;
+	uintptr_t head = OMR_MIN((0 - (uintptr_t)to) & (sizeof(__m128i) - 1), size);
+	memcpy(to, from, head);
+	to += head;
+	from += head;
+	size -= head;
+
+	const uintptr_t bytesPerBlock = 4 * sizeof(__m128i);
+	while (size >= bytesPerBlock) {
+		_mm_prefetch((const char *)(from + OBJECT_COPY_PREFETCH_DISTANCE), _MM_HINT_NTA);
+		__m128i block0 = _mm_loadu_si128((const __m128i *)from);
+		__m128i block1 = _mm_loadu_si128((const __m128i *)from + 1);
+		__m128i block2 = _mm_loadu_si128((const __m128i *)from + 2);
+		__m128i block3 = _mm_loadu_si128((const __m128i *)from + 3);
+		_mm_stream_si128((__m128i *)to, block0);
+		_mm_stream_si128((__m128i *)to + 1, block1);
+		_mm_stream_si128((__m128i *)to + 2, block2);
+		_mm_stream_si128((__m128i *)to + 3, block3);
+		to += bytesPerBlock;
+		from += bytesPerBlock;
+		size -= bytesPerBlock;
+	}
+	memcpy(to, from, size);
+	_mm_sfence();
+}
+#endif /* OMR_GC_OBJECT_COPY_X86 */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Base
+ */
+
+#if !defined(OBJECTCOPY_HPP_)
+#define OBJECTCOPY_HPP_
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrcomp.h"
+#include "modronbase.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define OMR_GC_OBJECT_COPY_X86
+#endif
+
+/**
+ * Copy of object bodies, with a strategy picked by object size and destination.
+ * - small objects are copied a word at a time inline, which is cheaper than a call to memcpy;
+ * - medium objects are copied with memcpy, which the C library already implements with the widest
+ *   aligned vector moves of the processor;
+ * - large objects copied to a destination that will not be read again soon (such as tenure space) are
+ *   copied with non-temporal stores while prefetching the source, so that they do not evict the working
+ *   set of the copying thread from the cache.
+ * The non-temporal kernel is picked once at startup from the features of the processor, large objects
+ * are copied with memcpy where there is none.
+ * @ingroup GC_Base
+ */
+class MM_ObjectCopy
+{
+	/*
+	 * Data members
+	 */
+public:
+	typedef void (*CopyFunction)(void *destination, const void *source, uintptr_t size);
+
+	enum Kernel {
+		kernel_memcpy = 0,
+		kernel_sse2
+	};
+
+	enum {
+		SMALL_OBJECT_COPY_MAXIMUM = 64 /**< largest object (in bytes) copied a word at a time */
+	};
+
+private:
+	CopyFunction _copyNonTemporal; /**< Kernel used to copy large objects */
+	Kernel _kernel; /**< Identifies the selected kernel */
+	uintptr_t _nonTemporalThreshold; /**< smallest object (in bytes) copied with the non-temporal kernel, UDATA_MAX if disabled */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	/**
+	 * Select the non-temporal kernel supported by the processor.
+	 * @param nonTemporalThreshold smallest object (in bytes) copied with non-temporal stores, 0 to disable them
+	 */
+	void initialize(uintptr_t nonTemporalThreshold);
+
+	/**
+	 * Use the given kernel for large objects, if the processor supports it.
+	 * @return true if the kernel was selected, false if it is not supported (the selection is unchanged)
+	 */
+	bool selectKernel(Kernel kernel);
+
+	/**
+	 * @return true if the processor supports the given kernel
+	 */
+	static bool isKernelSupported(Kernel kernel);
+
+	/**
+	 * @return the best non-temporal kernel supported by the processor, kernel_memcpy if there is none
+	 */
+	static Kernel getNonTemporalKernel();
+
+	/**
+	 * @return the function implementing the given kernel, or NULL if it is not built for this platform
+	 */
+	static CopyFunction getKernelFunction(Kernel kernel);
+
+	/**
+	 * @return a printable name for the given kernel
+	 */
+	static const char *getKernelName(Kernel kernel);
+
+	MMINLINE Kernel getKernel() { return _kernel; }
+
+	/**
+	 * Copy an object body.  The ranges must not overlap.
+	 * @param destination where to copy the object to
+	 * @param source the object to copy, aligned on a word
+	 * @param size number of bytes to copy
+	 * @param nonTemporal true if the destination is not expected to be read again soon
+	 * @return true if the object was copied with the non-temporal kernel
+	 */
+	MMINLINE bool
+	copy(void *destination, const void *source, uintptr_t size, bool nonTemporal)
+	{
+		bool copiedNonTemporal = false;
+		if (size <= SMALL_OBJECT_COPY_MAXIMUM) {
+			copyWords(destination, source, size);
+		} else if (nonTemporal && (size >= _nonTemporalThreshold)) {
+			_copyNonTemporal(destination, source, size);
+			copiedNonTemporal = true;
+		} else {
+			memcpy(destination, source, size);
+		}
+		return copiedNonTemporal;
+	}
+
+	/**
+	 * Copy a word at a time, then the bytes left over.
+	 */
+	static MMINLINE void
+	copyWords(void *destination, const void *source, uintptr_t size)
+	{
+		uintptr_t *destinationSlot = (uintptr_t *)destination;
+		const uintptr_t *sourceSlot = (const uintptr_t *)source;
+		while (size >= sizeof(uintptr_t)) {
+			*destinationSlot++ = *sourceSlot++;
+			size -= sizeof(uintptr_t);
+		}
+		uint8_t *destinationByte = (uint8_t *)destinationSlot;
+		const uint8_t *sourceByte = (const uint8_t *)sourceSlot;
+		while (0 < size) {
+			*destinationByte++ = *sourceByte++;
+			size -= 1;
+		}
+	}
+
+	static void copyMemcpy(void *destination, const void *source, uintptr_t size);
+#if defined(OMR_GC_OBJECT_COPY_X86)
+	static void copyNonTemporalSSE2(void *destination, const void *source, uintptr_t size);
+#endif /* OMR_GC_OBJECT_COPY_X86 */
+
+	MM_ObjectCopy()
+		: _copyNonTemporal(copyMemcpy)
+		, _kernel(kernel_memcpy)
+		, _nonTemporalThreshold(UDATA_MAX)
+	{}
+};
+
+#endif /* OBJECTCOPY_HPP_ */
@@ -199,6 +199,29 @@ public:
 		return (flags >> getObjectHeaderSlotFlagsShift()) & (uintptr_t)OMR_OBJECT_METADATA_FLAGS_MASK;
 	}
 
+	/**
+	 * Get a value that identifies the shape of an object, for heuristics that keep per-type data
+	 * without knowledge of the language object model. This is the content of the object header
+	 * slot with the flags byte cleared. Object models using this must guarantee that objects
+	 * with the same type key have their reference slots at the same offsets (as with a class
+	 * pointer, or a size for objects made of reference slots only).
+	 *
+	 * @param objectPtr the object to get the type key for (must not be forwarded)
+	 * @return the type key
+	 */
+	MMINLINE uintptr_t
+	getObjectHeaderTypeKey(omrobjectptr_t objectPtr)
+	{
+		uintptr_t header = 0;
+		void *headerSlotPtr = getObjectHeaderSlotAddress(objectPtr);
+		if (compressObjectReferences()) {
+			header = *(uint32_t*)headerSlotPtr;
+		} else {
+			header = *(uintptr_t*)headerSlotPtr;
+		}
+		return header & ~((uintptr_t)OMR_OBJECT_METADATA_FLAGS_MASK << getObjectHeaderSlotFlagsShift());
+	}
+
 	/**
 	 * Get the age of a heap object. The age value is returned in the low order bits of
 	 * the returned value.
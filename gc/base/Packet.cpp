@@ -59,6 +59,7 @@ MM_Packet::initialize(MM_EnvironmentBase *env, MM_Packet *next, MM_Packet *previ
 
 	_basePtr = _baseAddress;
 	_topPtr = _baseAddress + size;
+	_maximumTopPtr = _topPtr;
 	_currentPtr = _baseAddress;
 	
 	_owner = NULL;
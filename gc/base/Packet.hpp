@@ -44,7 +44,9 @@ private:
 	uintptr_t *_basePtr;
 	uintptr_t *_topPtr;
 	uintptr_t *_currentPtr;
+	uintptr_t *_maximumTopPtr; /**< Top of the packet storage, _topPtr is lowered when the capacity of the packet is limited */
 	uintptr_t _sublistIndex;
+	uintptr_t _poolIndex; /**< Index of the packet amongst all packets of its MM_WorkPackets, used by lock-free packet lists */
 	MM_EnvironmentBase *_owner;
 protected:
 public:
@@ -65,6 +67,16 @@ private:
 		_sublistIndex = sublistIndex;
 	}
 
+	MMINLINE uintptr_t getPoolIndex()
+	{
+		return _poolIndex;
+	}
+
+	MMINLINE void setPoolIndex(uintptr_t poolIndex)
+	{
+		_poolIndex = poolIndex;
+	}
+
 protected:
 public:
 	/**
@@ -140,6 +152,25 @@ public:
 		return (_currentPtr == _topPtr);
 	}
 
+	/**
+	 * Limit the number of slots the packet accepts, so that it fills (and is handed back
+	 * to the shared lists) sooner.
+	 * @note the packet must be empty
+	 * @param slots the number of slots, no more than the size of the packet
+	 */
+	MMINLINE void setCapacity(uintptr_t slots)
+	{
+		_topPtr = OMR_MIN(_basePtr + slots, _maximumTopPtr);
+	}
+
+	/**
+	 * Let the packet accept as many slots as its storage holds.
+	 */
+	MMINLINE void resetCapacity()
+	{
+		_topPtr = _maximumTopPtr;
+	}
+
 	MMINLINE void *pop(MM_EnvironmentBase *env)
 	{
 		if(_currentPtr > _basePtr) {
@@ -211,7 +242,9 @@ public:
 		_basePtr(NULL),
 		_topPtr(NULL),
 		_currentPtr(NULL),
+		_maximumTopPtr(NULL),
 		_sublistIndex(0),
+		_poolIndex(0),
 		_owner(NULL),
 		_next(NULL),
 		_previous(NULL)
@@ -66,6 +66,13 @@ MM_PacketList::tearDown(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_PacketList::enableLockFree(MM_Packet **packetTable)
+{
+	Assert_MM_true(isEmpty());
+	_packetTable = packetTable;
+}
+
 void 
 MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 {
@@ -73,6 +80,11 @@ MM_PacketList::pushList(MM_Packet *head, MM_Packet *tail, uintptr_t count)
 	PacketSublist *list = &_sublists[0];
 	MM_Packet *current = head;
 	uintptr_t i;
+
+	if (NULL != _packetTable) {
+		pushLockFree(list, head, tail, count);
+		return;
+	}
 	
 	list->_lock.acquire();
 	
@@ -101,6 +113,39 @@ MM_PacketList::popList(MM_Packet **head, MM_Packet **tail, uintptr_t *count)
 	*head = NULL;
 	*tail = NULL;
 	*count = 0;
+
+	if (NULL != _packetTable) {
+		/* detach each sublist in turn, the lists may be pushed to meanwhile */
+		for (uintptr_t i = 0; i < _sublistCount; i++) {
+			PacketSublist *list = &_sublists[i];
+			uint64_t oldTop = list->_top;
+			uint64_t witness = 0;
+			while (0 != (uint32_t)oldTop) {
+				witness = MM_AtomicOperations::lockCompareExchangeU64(&list->_top, oldTop, makeTop(oldTop, NULL));
+				if (witness == oldTop) {
+					break;
+				}
+				oldTop = witness;
+			}
+
+			MM_Packet *current = getTopPacket(oldTop);
+			if (NULL != current) {
+				didPop = true;
+				if (NULL == *head) {
+					*head = current;
+				} else {
+					(*tail)->_next = current;
+				}
+				while (NULL != current) {
+					*tail = current;
+					*count += 1;
+					current = current->_next;
+				}
+			}
+		}
+		decrementCount(*count);
+		return didPop;
+	}
 	
 	/* acquire all of our locks */
 	for (uintptr_t i = 0; i < _sublistCount; i++) {
@@ -146,6 +191,9 @@ MM_PacketList::remove(MM_Packet *packetToRemove)
 	PacketSublist *list = &_sublists[packetToRemove->getSublistIndex()];
 	MM_Packet *previous = NULL;
 	MM_Packet *next = NULL;
+
+	/* lock-free lists do not maintain the _previous links */
+	Assert_MM_true(NULL == _packetTable);
 	
 	list->_lock.acquire();
 	
@@ -188,7 +236,7 @@ MM_PacketList::getHead()
 	
 	if (popList(&head, &tail, &count)) {
 		pushList(head, tail, count);
-		result = _sublists[0]._head;
+		result = (NULL != _packetTable) ? getTopPacket(_sublists[0]._top) : _sublists[0]._head;
 	}
 
 	return result;
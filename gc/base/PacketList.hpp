@@ -49,6 +49,7 @@ public:
 		MM_Packet * _head;  /**< Head of the list */
 		MM_Packet * _tail;  /**< Tail of the list */
 		MM_LightweightNonReentrantLock _lock;  /**< Lock for getting/putting packets */
+		volatile uint64_t _top;  /**< Head of a lock-free list: pool index of the first packet plus one in the low half (0 when empty), version in the high half */
 
 		bool
 		initialize(MM_EnvironmentBase *env)
@@ -62,6 +63,7 @@ public:
 		PacketSublist()
 			: _head(NULL)
 			, _tail(NULL)
+			, _top(0)
 		{
 		}
 	};
@@ -73,6 +75,7 @@ private:
 	
 	uintptr_t _sublistCount; /**< the number of lists (split for parallelism). Must be at least 1 */
 	volatile uintptr_t _count;  /**< Number of items in the list */
+	MM_Packet **_packetTable; /**< Packets by pool index when the sublists are lock-free, NULL when they are locked */
 	
 /* Functionality Section */
 private:
@@ -84,7 +87,7 @@ private:
 	 */
 	void incrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && (NULL == _packetTable)) {
 			_count += value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -100,7 +103,7 @@ private:
 	 */
 	void decrementCount(uintptr_t value)
 	{
-		if (1 == _sublistCount) {
+		if ((1 == _sublistCount) && (NULL == _packetTable)) {
 			_count -= value;
 		} else {
 			/* use an atomic, as the locks have been split up */
@@ -121,6 +124,83 @@ private:
 	{
 		return env->getEnvironmentId() % _sublistCount;
 	}
+
+	/**
+	 * Return the first packet of a lock-free sublist.
+	 *
+	 * @param top the tagged head of the sublist
+	 *
+	 * @return the first packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	getTopPacket(uint64_t top)
+	{
+		uint32_t index = (uint32_t)top;
+		return (0 == index) ? NULL : _packetTable[index - 1];
+	}
+
+	/**
+	 * Build the tagged head of a lock-free sublist which replaces the given head.
+	 * The version is bumped on every change so that a stale head (one whose packet was popped
+	 * and pushed back meanwhile) fails the compare and swap.
+	 *
+	 * @param oldTop the tagged head being replaced
+	 * @param packet the new first packet, or NULL to empty the sublist
+	 *
+	 * @return the tagged head
+	 */
+	MMINLINE uint64_t
+	makeTop(uint64_t oldTop, MM_Packet *packet)
+	{
+		uint64_t version = (oldTop >> 32) + 1;
+		uint64_t index = (NULL == packet) ? 0 : (packet->getPoolIndex() + 1);
+		return (version << 32) | index;
+	}
+
+	/**
+	 * Push a chain of packets, linked through _next, on a lock-free sublist.
+	 * The count is raised first so that it never falls below the number of packets on the list.
+	 */
+	MMINLINE void
+	pushLockFree(PacketSublist *list, MM_Packet *head, MM_Packet *tail, uintptr_t count)
+	{
+		incrementCount(count);
+
+		uint64_t oldTop = list->_top;
+		while (true) {
+			tail->_next = getTopPacket(oldTop);
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&list->_top, oldTop, makeTop(oldTop, head));
+			if (witness == oldTop) {
+				break;
+			}
+			oldTop = witness;
+		}
+	}
+
+	/**
+	 * Pop a packet off a lock-free sublist.
+	 *
+	 * @return the packet, or NULL if the sublist is empty
+	 */
+	MMINLINE MM_Packet *
+	popLockFree(PacketSublist *list)
+	{
+		uint64_t oldTop = list->_top;
+		MM_Packet *packet = getTopPacket(oldTop);
+
+		while (NULL != packet) {
+			/* _next is stale if the packet was popped by another thread meanwhile, but then so is the version */
+			uint64_t witness = MM_AtomicOperations::lockCompareExchangeU64(&list->_top, oldTop, makeTop(oldTop, packet->_next));
+			if (witness == oldTop) {
+				decrementCount(1);
+				break;
+			}
+			oldTop = witness;
+			packet = getTopPacket(oldTop);
+		}
+
+		return packet;
+	}
 		
 protected:
 	
@@ -128,6 +208,23 @@ public:
 	
 	bool initialize(MM_EnvironmentBase *env);
 	void tearDown(MM_EnvironmentBase *env) ;
+
+	/**
+	 * Push and pop packets with a compare and swap on the head of each sublist rather than under the sublist lock.
+	 * Lock-free lists do not maintain _tail or the _previous links, so remove() is not supported.
+	 * @note must be called before any packet is put on the list
+	 *
+	 * @param packetTable maps the pool index of every packet which can be put on the list to the packet
+	 */
+	void enableLockFree(MM_Packet **packetTable);
+
+	/**
+	 * @return true if the list is lock-free
+	 */
+	MMINLINE bool isLockFree()
+	{
+		return NULL != _packetTable;
+	}
 	
 	/**
 	 * Push a list of packets onto this packet list.
@@ -162,21 +259,25 @@ public:
 	{
 		uintptr_t index = getSublistIndex(env);
 		PacketSublist *list = &_sublists[index];
-	
-		list->_lock.acquire();
 
-		packet->_next = list->_head;
-		packet->_previous = NULL;
-		packet->setSublistIndex(index);
-		if (NULL == list->_head) {
-			list->_tail = packet;
+		if (NULL != _packetTable) {
+			pushLockFree(list, packet, packet, 1);
 		} else {
-			list->_head->_previous = packet;
+			list->_lock.acquire();
+
+			packet->_next = list->_head;
+			packet->_previous = NULL;
+			packet->setSublistIndex(index);
+			if (NULL == list->_head) {
+				list->_tail = packet;
+			} else {
+				list->_head->_previous = packet;
+			}
+			list->_head = packet;
+			incrementCount(1);
+
+			list->_lock.release();
 		}
-		list->_head = packet;
-		incrementCount(1);
-		
-		list->_lock.release();
 	}
 	
 	/**
@@ -192,7 +293,12 @@ public:
 		for (uintptr_t i = 0; i < _sublistCount; i++) {
 			PacketSublist *list = &_sublists[index];
 
-			if (NULL != list->_head) {
+			if (NULL != _packetTable) {
+				packet = popLockFree(list);
+				if (NULL != packet) {
+					break;
+				}
+			} else if (NULL != list->_head) {
 				list->_lock.acquire();
 				if (NULL != list->_head) {
 					packet = list->_head;
@@ -254,6 +360,7 @@ public:
 		,_sublists(NULL)
 		,_sublistCount(0)
 		,_count(0)
+		,_packetTable(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
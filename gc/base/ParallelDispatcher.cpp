@@ -159,7 +159,7 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	while(slave_status_dying != _statusTable[slaveID]) {
 		/* Wait for a task to be dispatched to the slave thread */
 		while(slave_status_waiting == _statusTable[slaveID]) {
-			omrthread_monitor_wait(_slaveThreadMutex);
+			waitForTask(env);
 		}
 
 		if(slave_status_reserved == _statusTable[slaveID]) {
@@ -177,6 +177,26 @@ MM_ParallelDispatcher::slaveEntryPoint(MM_EnvironmentBase *env)
 	omrthread_monitor_exit(_slaveThreadMutex);	
 }
 
+void
+MM_ParallelDispatcher::waitForTask(MM_EnvironmentBase *env)
+{
+	if (_parkThreads) {
+		/* The park permit is kept by an unpark that happens before the park, so a wakeup is not lost
+		 * between releasing the mutex and parking.
+		 */
+		omrthread_monitor_exit(_slaveThreadMutex);
+		intptr_t rc = omrthread_park(0, 0);
+		if (J9THREAD_INTERRUPTED == rc) {
+			omrthread_clear_interrupted();
+		} else if (J9THREAD_PRIORITY_INTERRUPTED == rc) {
+			omrthread_clear_priority_interrupted();
+		}
+		omrthread_monitor_enter(_slaveThreadMutex);
+	} else {
+		omrthread_monitor_wait(_slaveThreadMutex);
+	}
+}
+
 void
 MM_ParallelDispatcher::masterEntryPoint(MM_EnvironmentBase *env)
 {
@@ -368,7 +388,7 @@ MM_ParallelDispatcher::shutDownThreads()
 	/* making them the master in a single threaded GC */
 	_threadCount = 1;
 
-	wakeUpThreads(_threadShutdownCount);
+	wakeUpThreads(_threadCountMaximum);
 	omrthread_monitor_exit(_slaveThreadMutex);
 
 	omrthread_monitor_enter(_dispatcherMonitor);
@@ -383,11 +403,23 @@ MM_ParallelDispatcher::shutDownThreads()
  * In this implementation, since slaveThreadEntryPoint() allows a thread to
  * go back to sleep if it wasn't selected, we can wake them all up. This
  * may not apply to all subclasses though.
+ * With parking, only the first <code>count</code> threads are woken, so that
+ * a task run on few threads does not pay for waking the idle ones.
  */
 void
 MM_ParallelDispatcher::wakeUpThreads(uintptr_t count)
 {
-	omrthread_monitor_notify_all(_slaveThreadMutex);	
+	if (_parkThreads) {
+		uintptr_t threadCount = OMR_MIN(count, _threadCountMaximum);
+		for (uintptr_t index = 0; index < threadCount; index++) {
+			/* the master (and any slave that failed to start) has no thread to wake */
+			if ((NULL != _threadTable[index]) && (slave_status_waiting != _statusTable[index])) {
+				omrthread_unpark(_threadTable[index]);
+			}
+		}
+	} else {
+		omrthread_monitor_notify_all(_slaveThreadMutex);
+	}
 }
 
 /**
@@ -403,6 +435,13 @@ MM_ParallelDispatcher::setThreadCount(uintptr_t threadCount)
  	_threadCount = threadCount;
 }
 
+uint64_t
+MM_ParallelDispatcher::getTaskSpinUpTime()
+{
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	return omrtime_hires_delta(0, _taskSpinUpTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+}
+
 /**
  * Decide how many threads should be active for a given task.
  */
@@ -479,6 +518,11 @@ MM_ParallelDispatcher::prepareThreadsForTask(MM_EnvironmentBase *env, MM_Task *t
 		_statusTable[index] = slave_status_reserved;
 		_taskTable[index] = task;
 	}
+
+	OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+	_taskThreadCount = threadCount;
+	_taskSpinUpTime = 0;
+	_taskDispatchTime = omrtime_hires_clock();
 	wakeUpThreads(threadCount);
 	omrthread_monitor_exit(_slaveThreadMutex);
 }
@@ -489,6 +533,14 @@ MM_ParallelDispatcher::acceptTask(MM_EnvironmentBase *env)
 	uintptr_t slaveID = env->getSlaveID();
 	
 	env->resetWorkUnitIndex();
+	if (!env->isMasterThread()) {
+		/* Called with _slaveThreadMutex held: record how long the slowest thread took to start on the task */
+		OMRPORT_ACCESS_FROM_OMRVM(_extensions->getOmrVM());
+		uint64_t spinUpTime = omrtime_hires_clock() - _taskDispatchTime;
+		if (spinUpTime > _taskSpinUpTime) {
+			_taskSpinUpTime = spinUpTime;
+		}
+	}
 	_statusTable[slaveID] = slave_status_active;
 	env->_currentTask = _taskTable[slaveID];
 
@@ -514,6 +566,8 @@ MM_ParallelDispatcher::cleanupAfterTask(MM_EnvironmentBase *env)
 	omrthread_monitor_enter(_slaveThreadMutex);
 	
 	_slaveThreadsReservedForGC = false;
+
+	Trc_MM_ParallelDispatcher_cleanupAfterTask_spinUp(_taskThreadCount, getTaskSpinUpTime());
 	
 	if (_inShutdown) {
 		omrthread_monitor_notify_all(_slaveThreadMutex);
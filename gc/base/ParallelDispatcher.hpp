@@ -77,6 +77,11 @@ protected:
 	uintptr_t _threadCount; /**< number of threads currently forked */
 	uintptr_t _activeThreadCount; /**< number of threads actively running a task */
 
+	bool _parkThreads; /**< idle slave threads park individually and only the threads reserved for a task are woken (see MM_GCExtensionsBase::gcThreadParking) */
+	uintptr_t _taskThreadCount; /**< number of threads the current task was dispatched to */
+	uint64_t _taskDispatchTime; /**< time (hires clock) at which the current task was dispatched to the slave threads */
+	uint64_t _taskSpinUpTime; /**< time (hires clock ticks) taken by the last slave thread reserved for the current task to accept it */
+
 	omrsig_handler_fn _handler;
 	void* _handler_arg;
 	uintptr_t _defaultOSStackSize; /**< default OS stack size */
@@ -113,6 +118,12 @@ protected:
 	virtual void setThreadInitializationComplete(MM_EnvironmentBase *env);
 	
 	uintptr_t adjustThreadCount(uintptr_t maxThreadCount);
+
+	/**
+	 * Block an idle slave thread until it is woken by wakeUpThreads().  Called with _slaveThreadMutex held,
+	 * which is held again on return.  The caller must recheck the status of the thread, which may be unchanged.
+	 */
+	void waitForTask(MM_EnvironmentBase *env);
 	
 public:
 	virtual bool startUpThreads();
@@ -123,6 +134,7 @@ public:
 	MMINLINE omrthread_t* getThreadTable() { return _threadTable; }
 	MMINLINE virtual uintptr_t activeThreadCount() { return _activeThreadCount; }
 	virtual void setThreadCount(uintptr_t threadCount);
+	virtual uint64_t getTaskSpinUpTime();
 
 	MMINLINE omrsig_handler_fn getSignalHandler() {return _handler;}
 	MMINLINE void * getSignalHandlerArg() {return _handler_arg;}
@@ -147,6 +159,10 @@ public:
 		,_threadCountMaximum(1)
 		,_threadCount(1)
 		,_activeThreadCount(1)
+		,_parkThreads(_extensions->gcThreadParking)
+		,_taskThreadCount(0)
+		,_taskDispatchTime(0)
+		,_taskSpinUpTime(0)
 		,_handler(handler)
 		,_handler_arg(handler_arg)
 		,_defaultOSStackSize(defaultOSStackSize)
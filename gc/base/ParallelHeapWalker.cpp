@@ -80,6 +80,42 @@ public:
 	}
 };
 
+/**
+ * Task walking the live objects of the heap, for MM_ParallelHeapWalker::liveObjectsDoParallel().
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ParallelLiveObjectDoTask : public MM_ParallelTask
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_HeapWalkerObjectFunc _function;
+	void *_userData;
+
+	MM_ParallelHeapWalker *_heapWalker;
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_PARALLEL_OBJECT_DO; };
+
+	virtual void run(MM_EnvironmentBase *env);
+
+	MM_ParallelLiveObjectDoTask(MM_EnvironmentBase *env, MM_ParallelHeapWalker *heapWalker, MM_HeapWalkerObjectFunc function, void *userData)
+		: MM_ParallelTask(env, env->getExtensions()->dispatcher)
+		, _function(function)
+		, _userData(userData)
+		, _heapWalker(heapWalker)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
 /**
  * newInstance of Parallel Heap Walker
  */
@@ -158,6 +194,63 @@ MM_ParallelHeapWalker::allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObject
 	}
 }
 
+uintptr_t
+MM_ParallelHeapWalker::liveObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t maximumThreadCount)
+{
+	/* Mark the live objects, the mark map then tells where they start */
+	_globalCollector->prepareHeapForWalk(env);
+
+	MM_ParallelLiveObjectDoTask liveObjectDoTask(env, this, function, userData);
+	env->getExtensions()->dispatcher->run(env, &liveObjectDoTask, maximumThreadCount);
+
+	return liveObjectDoTask.getThreadCount();
+}
+
+void
+MM_ParallelHeapWalker::liveObjectsDoChunks(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData)
+{
+	Trc_MM_ParallelHeapWalker_liveObjectsDoChunks_Entry(env->getLanguageVMThread());
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+
+	/* The partitioning only depends on the heap size and on the number of threads */
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	uintptr_t slaveID = env->getSlaveID();
+	uintptr_t chunkSize = extensions->heap->getMemorySize() / (threadCount * 8);
+	chunkSize = MM_Math::roundToCeiling(extensions->heapAlignment, OMR_MAX(chunkSize, 1));
+
+	uintptr_t chunkIndex = 0;
+	uintptr_t objectsWalked = 0;
+	MM_HeapRegionManager *regionManager = extensions->heap->getHeapRegionManager();
+	regionManager->lock();
+	GC_HeapRegionIterator regionIterator(regionManager);
+	MM_HeapRegionDescriptor *region = NULL;
+	MM_HeapMapIterator markedObjectIterator(extensions);
+	OMR_VMThread *omrVMThread = env->getOmrVMThread();
+
+	while (NULL != (region = regionIterator.nextRegion())) {
+		uintptr_t *chunkBase = (uintptr_t *)region->getLowAddress();
+		uintptr_t *regionTop = (uintptr_t *)region->getHighAddress();
+		while (chunkBase < regionTop) {
+			uintptr_t *chunkTop = regionTop;
+			if (((uintptr_t)regionTop - (uintptr_t)chunkBase) > chunkSize) {
+				chunkTop = (uintptr_t *)((uintptr_t)chunkBase + chunkSize);
+			}
+			if (slaveID == (chunkIndex % threadCount)) {
+				markedObjectIterator.reset(_markMap, chunkBase, chunkTop);
+				omrobjectptr_t object = NULL;
+				while (NULL != (object = markedObjectIterator.nextObject())) {
+					function(omrVMThread, region, object, userData);
+					objectsWalked += 1;
+				}
+			}
+			chunkIndex += 1;
+			chunkBase = chunkTop;
+		}
+	}
+	regionManager->unlock();
+	Trc_MM_ParallelHeapWalker_liveObjectsDoChunks_Exit(env->getLanguageVMThread(), chunkIndex, chunkSize, objectsWalked);
+}
+
 /**
  * gets the heap walker and calls the actual objectSlotsDo function
  */
@@ -166,3 +259,9 @@ MM_ParallelObjectDoTask::run(MM_EnvironmentBase *env)
 {
 	_heapWalker->allObjectsDoParallel(env, _function, _userData, _walkFlags);
 }
+
+void
+MM_ParallelLiveObjectDoTask::run(MM_EnvironmentBase *env)
+{
+	_heapWalker->liveObjectsDoChunks(env, _function, _userData);
+}
@@ -47,6 +47,11 @@ public:
 	 * Function members
 	 */
 private:
+	/**
+	 * Walk the live objects in the chunks of the heap dealt to the current thread of a parallel live object walk.
+	 */
+	void liveObjectsDoChunks(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData);
+
 protected:
 public:	
 	/**
@@ -61,6 +66,18 @@ public:
 	 */
 	virtual void allObjectsDo(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t walkFlags, bool parallel, bool prepareHeapForWalk);
 
+	/**
+	 * Mark the live objects of the heap, then walk them in parallel on the dispatcher threads and apply the provided function.
+	 * The regions are split in chunks of equal size which are numbered in address order and dealt round robin to the threads,
+	 * so that for a given heap and number of threads each thread walks the same objects, in address order.  An object is
+	 * walked by the thread whose chunk contains its start.
+	 * @param function called for each live object by the thread walking it, which has a slave ID lower than the number of threads used
+	 * @param maximumThreadCount the walk uses at most this many threads
+	 * @return the number of threads used
+	 * @note The caller must have exclusive VM access.
+	 */
+	uintptr_t liveObjectsDoParallel(MM_EnvironmentBase *env, MM_HeapWalkerObjectFunc function, void *userData, uintptr_t maximumThreadCount);
+
 	MM_MarkMap *getMarkMap() {
 		return _markMap;
 	}
@@ -85,6 +102,7 @@ public:
 	 * Friends
 	 */
 	friend class MM_ParallelObjectDoTask;
+	friend class MM_ParallelLiveObjectDoTask;
 };
 
 #endif /* PARALLEL_HEAP_WALKER_HPP_ */
@@ -44,6 +44,7 @@ void
 MM_ParallelMarkTask::run(MM_EnvironmentBase *env)
 {
 	env->_workStack.prepareForWork(env, (MM_WorkPackets *)(_markingScheme->getWorkPackets()));
+	env->_workStack.enablePacketMagazines(env);
 
 	_markingScheme->markLiveObjectsInit(env, _initMarkMap);
 	_markingScheme->markLiveObjectsRoots(env);
@@ -90,6 +91,14 @@ MM_ParallelMarkTask::cleanup(MM_EnvironmentBase *env)
 		env->_workPacketStats.workPacketsReleased,
 		env->_workPacketStats.workPacketsExchanged,
 		0/* TODO CRG figure out to get the array split size*/);
+	Trc_MM_ParallelMarkTask_packetAcquireStats(
+		env->getLanguageVMThread(),
+		(uint32_t)env->getSlaveID(),
+		env->_workPacketStats._packetAcquireCount,
+		omrtime_hires_delta(0, env->_workPacketStats._packetAcquireTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		omrtime_hires_delta(0, env->_workPacketStats._packetAcquireMaxTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+		env->_workPacketStats._packetMagazineHits,
+		env->_workPacketStats.workPacketsSpilled);
 }
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -37,7 +37,13 @@
 #if defined(OMR_GC_MODRON_COMPACTION)
 #define OMR_XCOMPACTGC "-Xcompactgc"
 #define OMR_XCOMPACTGC_LENGTH 11
+#define OMR_XGCLARGEOBJECTPINNEDSIZE "-Xgc:largeObjectPinnedSize="
+#define OMR_XGCLARGEOBJECTPINNEDSIZE_LENGTH 27
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+#define OMR_XGCLARGEOBJECTAREARELEASEFREEPAGES "-Xgc:largeObjectAreaReleaseFreePages"
+#define OMR_XGCLARGEOBJECTAREARELEASEFREEPAGES_LENGTH 36
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 #define OMR_XGCPOLICY "-Xgcpolicy:"
 #define OMR_XGCPOLICY_LENGTH 11
@@ -48,8 +54,32 @@
 #define OMR_XVERBOSEGCLOG_LENGTH 15
 #define OMR_XGCBUFFERED_LOGGING "-Xgc:bufferedLogging"
 #define OMR_XGCBUFFERED_LOGGING_LENGTH 20
+#define OMR_XGCFREELISTBINS "-Xgc:freeListBins"
+#define OMR_XGCFREELISTBINS_LENGTH 17
 #define OMR_XGCTHREADS "-Xgcthreads"
 #define OMR_XGCTHREADS_LENGTH 11
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+#define OMR_XGCALLOCATIONSITESAMPLEINTERVAL "-Xgc:allocationSiteSampleInterval="
+#define OMR_XGCALLOCATIONSITESAMPLEINTERVAL_LENGTH 34
+#define OMR_XGCTLHADAPTIVESIZING "-Xgc:tlhAdaptiveSizing"
+#define OMR_XGCTLHADAPTIVESIZING_LENGTH 22
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#define OMR_XGCSIZECLASSPROFILINGTARGETCOUNT "-Xgc:sizeClassProfilingTargetCount="
+#define OMR_XGCSIZECLASSPROFILINGTARGETCOUNT_LENGTH 35
+#define OMR_XGCSIZECLASSPROFILING "-Xgc:sizeClassProfiling"
+#define OMR_XGCSIZECLASSPROFILING_LENGTH 23
+#define OMR_XGCSIZECLASSESFILE "-Xgc:sizeClassesFile="
+#define OMR_XGCSIZECLASSESFILE_LENGTH 21
+#define OMR_XGCREGIONGRANTBATCHSIZE "-Xgc:regionGrantBatchSize="
+#define OMR_XGCREGIONGRANTBATCHSIZE_LENGTH 26
+#define OMR_XGCSEGREGATEDINCREMENTAL "-Xgc:segregatedIncremental"
+#define OMR_XGCSEGREGATEDINCREMENTAL_LENGTH 26
+#define OMR_XGCSEGREGATEDQUANTUMBUDGET "-Xgc:segregatedQuantumBudget="
+#define OMR_XGCSEGREGATEDQUANTUMBUDGET_LENGTH 29
+#define OMR_XGCSEGREGATEDINCREMENTALKICKOFF "-Xgc:segregatedIncrementalKickoff="
+#define OMR_XGCSEGREGATEDINCREMENTALKICKOFF_LENGTH 34
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 uintptr_t
 MM_StartupManager::getUDATAValue(char *option, uintptr_t *outputValue)
@@ -264,7 +294,20 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		extensions->nocompactOnSystemGC = 0;
 		extensions->compactOnSystemGC = 0;
 	}
+	else if (0 == strncmp(option, OMR_XGCLARGEOBJECTPINNEDSIZE, OMR_XGCLARGEOBJECTPINNEDSIZE_LENGTH)) {
+		uintptr_t pinnedSize = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCLARGEOBJECTPINNEDSIZE_LENGTH, &pinnedSize)) {
+			result = false;
+		} else {
+			extensions->largeObjectPinnedSize = pinnedSize;
+		}
+	}
 #endif /* OMR_GC_MODRON_COMPACTION */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	else if (0 == strcmp(option, OMR_XGCLARGEOBJECTAREARELEASEFREEPAGES)) {
+		extensions->largeObjectAreaReleaseFreePages = true;
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	else if (0 == strncmp(option, OMR_XVERBOSEGCLOG, OMR_XVERBOSEGCLOG_LENGTH)) {
 		verboseFileName = (char *) omrmem_allocate_memory(strlen(option+OMR_XVERBOSEGCLOG_LENGTH)+1, OMRMEM_CATEGORY_MM);
 		if (NULL == verboseFileName) {
@@ -276,6 +319,9 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 	else if (0 == strncmp(option, OMR_XGCBUFFERED_LOGGING, OMR_XGCBUFFERED_LOGGING_LENGTH)) {
 		extensions->bufferedLogging = true;
 	}
+	else if (0 == strncmp(option, OMR_XGCFREELISTBINS, OMR_XGCFREELISTBINS_LENGTH)) {
+		extensions->freeListBins = true;
+	}
 #if defined(OMR_GC_MORDON_SCAVENGER)
 	else if (0 == strncmp(option, OMR_XGCPOLICY, OMR_XGCPOLICY_LENGTH)) {
 		char *gcpolicy = option + OMR_XGCPOLICY_LENGTH;
@@ -287,6 +333,70 @@ MM_StartupManager::handleOption(MM_GCExtensionsBase *extensions, char *option)
 		}
 	}
 #endif /* defined(OMR_GC_MORDON_SCAVENGER) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	else if (0 == strncmp(option, OMR_XGCSIZECLASSPROFILINGTARGETCOUNT, OMR_XGCSIZECLASSPROFILINGTARGETCOUNT_LENGTH)) {
+		uintptr_t targetCount = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCSIZECLASSPROFILINGTARGETCOUNT_LENGTH, &targetCount)) {
+			result = false;
+		} else {
+			extensions->sizeClassProfilingTargetCount = targetCount;
+		}
+	}
+	else if (0 == strcmp(option, OMR_XGCSIZECLASSPROFILING)) {
+		extensions->sizeClassProfiling = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSIZECLASSESFILE, OMR_XGCSIZECLASSESFILE_LENGTH)) {
+		if (NULL != extensions->sizeClassesFile) {
+			omrmem_free_memory(extensions->sizeClassesFile);
+		}
+		extensions->sizeClassesFile = (char *) omrmem_allocate_memory(strlen(option + OMR_XGCSIZECLASSESFILE_LENGTH) + 1, OMRMEM_CATEGORY_MM);
+		if (NULL == extensions->sizeClassesFile) {
+			result = false;
+		} else {
+			strcpy(extensions->sizeClassesFile, option + OMR_XGCSIZECLASSESFILE_LENGTH);
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCREGIONGRANTBATCHSIZE, OMR_XGCREGIONGRANTBATCHSIZE_LENGTH)) {
+		uintptr_t batchSize = 0;
+		if (0 >= getUDATAValue(option + OMR_XGCREGIONGRANTBATCHSIZE_LENGTH, &batchSize)) {
+			result = false;
+		} else {
+			extensions->regionGrantBatchSize = batchSize;
+		}
+	}
+	else if (0 == strcmp(option, OMR_XGCSEGREGATEDINCREMENTAL)) {
+		extensions->segregatedIncremental = true;
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATEDQUANTUMBUDGET, OMR_XGCSEGREGATEDQUANTUMBUDGET_LENGTH)) {
+		uintptr_t budget = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATEDQUANTUMBUDGET_LENGTH, &budget)) || (0 == budget)) {
+			result = false;
+		} else {
+			extensions->segregatedQuantumBudget = budget;
+		}
+	}
+	else if (0 == strncmp(option, OMR_XGCSEGREGATEDINCREMENTALKICKOFF, OMR_XGCSEGREGATEDINCREMENTALKICKOFF_LENGTH)) {
+		uintptr_t kickoff = 0;
+		if ((0 >= getUDATAValue(option + OMR_XGCSEGREGATEDINCREMENTALKICKOFF_LENGTH, &kickoff)) || (100 < kickoff)) {
+			result = false;
+		} else {
+			extensions->segregatedIncrementalKickoff = kickoff;
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#if defined(OMR_GC_THREAD_LOCAL_HEAP)
+	else if (0 == strncmp(option, OMR_XGCALLOCATIONSITESAMPLEINTERVAL, OMR_XGCALLOCATIONSITESAMPLEINTERVAL_LENGTH)) {
+		uintptr_t interval = 0;
+		if (!getUDATAMemoryValue(option + OMR_XGCALLOCATIONSITESAMPLEINTERVAL_LENGTH, &interval)) {
+			result = false;
+		} else {
+			extensions->allocationSiteSampleInterval = interval;
+		}
+	}
+	else if (0 == strcmp(option, OMR_XGCTLHADAPTIVESIZING)) {
+		extensions->tlhAdaptiveSizing = true;
+	}
+#endif /* defined(OMR_GC_THREAD_LOCAL_HEAP) */
 	else if (0 == strncmp(option, OMR_XGCTHREADS, OMR_XGCTHREADS_LENGTH)) {
 		uintptr_t forcedThreadCount = 0;
 		if (0 >= getUDATAValue(option + OMR_XGCTHREADS_LENGTH, &forcedThreadCount)) {
@@ -36,6 +36,7 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "Forge.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -124,18 +125,19 @@ MM_TLHAllocationInterface::kill(MM_EnvironmentBase *env)
 {
 	 MM_GCExtensionsBase *extensions = env->getExtensions();
 
-	 if(shouldFlush) {
-		extensions->allocationStats.merge(&_stats);
-		_stats.clear();
-		/* Since AllocationStats have been reset, reset the base */
-		_bytesAllocatedBase = 0;
-	}
-	
 	_tlhAllocationSupport.reconnect(env, shouldFlush);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.reconnect(env, shouldFlush);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	/* Merge after flushing the TLHs, so that the remainders they abandon are included */
+	if(shouldFlush) {
+		extensions->allocationStats.merge(&_stats);
+		_stats.clear();
+		/* Since AllocationStats have been reset, reset the base */
+		_bytesAllocatedBase = 0;
+	}
 };
 
 
@@ -207,6 +209,11 @@ MM_TLHAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_AllocateDe
 		_stats._allocationBytes += allocDescription->getContiguousBytes();
 		_stats._allocationCount += 1;
 
+		MM_AllocationSiteSampler *sampler = env->getExtensions()->allocationSiteSampler;
+		if (NULL != sampler) {
+			_tlhAllocationSupport.sampleAllocation(env, sampler, result, allocDescription->getContiguousBytes(), false);
+		}
+
 	}
 
 	env->_oolTraceAllocationBytes += (_stats.bytesAllocated() - _bytesAllocatedBase); /* Increment by bytes allocated */
@@ -288,15 +295,17 @@ MM_TLHAllocationInterface::flushCache(MM_EnvironmentBase *env)
 	}	
 #endif /* OMR_GC_THREAD_LOCAL_HEAP */		
 	
-	extensions->allocationStats.merge(&_stats);
-	_stats.clear();
-	/* Since AllocationStats have been reset, reset the base as well*/
-	_bytesAllocatedBase = 0;
 	_tlhAllocationSupport.flushCache(env);
 
 #if defined(OMR_GC_NON_ZERO_TLH)
 	_tlhAllocationSupportNonZero.flushCache(env);
 #endif /* defined(OMR_GC_NON_ZERO_TLH) */
+
+	/* Merge after flushing the TLHs, so that the remainders they abandon are included */
+	extensions->allocationStats.merge(&_stats);
+	_stats.clear();
+	/* Since AllocationStats have been reset, reset the base as well*/
+	_bytesAllocatedBase = 0;
 }
 
 void
@@ -37,7 +37,9 @@
 
 #include "AllocateDescription.hpp"
 #include "AllocationContext.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "AllocationStats.hpp"
+#include "AtomicOperations.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "EnvironmentBase.hpp"
 #include "FrequentObjectsStats.hpp"
@@ -89,8 +91,17 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 {
 	MM_MemoryPool *memoryPool = getMemoryPool();
 
+	/* Abandon the whole TLH, not only up to an allocation site sample point */
+	restoreTop();
+
 	/* Any previous cache to clear  ? */
 	if (NULL != memoryPool) {
+		uintptr_t abandonedBytes = (uintptr_t)getTop() - (uintptr_t)getRealAlloc();
+		if (0 < abandonedBytes) {
+			MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+			stats->_tlhAbandonedCount += 1;
+			stats->_tlhAbandonedBytes += abandonedBytes;
+		}
 		memoryPool->abandonTlhHeapChunk(getRealAlloc(), getTop());
 		reportClearCache(env);
 	}
@@ -111,15 +122,22 @@ MM_TLHAllocationSupport::clear(MM_EnvironmentBase *env)
 	 MM_GCExtensionsBase *extensions = env->getExtensions();
 
 	if(shouldFlush) {
-		_abandonedList = NULL;
-		_abandonedListSize = 0;
+		flushAbandonedList();
 		clear(env);
 	} else {
 		/* Clear current information accumulated */
 		setAllZeroes();
+		_realTop = NULL;
+		_sampleAllocBase = NULL;
 	}
 
 	_tlh->refreshSize = extensions->tlhInitialSize;
+	resetAllocationRate(env);
+	_allocationRate = 0;
+
+	if (NULL != extensions->allocationSiteSampler) {
+		_bytesUntilSample = extensions->allocationSiteSampler->nextSampleInterval(&_sampleSeed);
+	}
 }
 
 /**
@@ -141,6 +159,8 @@ MM_TLHAllocationSupport::restart(MM_EnvironmentBase *env)
 
 	/* Clear current information accumulated */
 	setAllZeroes();
+	_realTop = NULL;
+	_sampleAllocBase = NULL;
 
 	_tlh->refreshSize = MM_Math::roundToCeiling(extensions->tlhInitialSize, refreshSize / 2);
 }
@@ -171,6 +191,13 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 
 	MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
 
+	if (extensions->tlhAdaptiveSizing) {
+		sampleAllocationRate(env);
+		if (0 != _allocationRate) {
+			setRefreshSize(calculateAdaptiveRefreshSize(env, sizeInBytesRequired));
+		}
+	}
+
 	stats->_tlhDiscardedBytes += getSize();
 
 	/* Try to cache the current TLH */
@@ -274,9 +301,9 @@ MM_TLHAllocationSupport::refresh(MM_EnvironmentBase *env, MM_AllocateDescription
 			stats->_tlhRequestedBytes += getRefreshSize();
 			/* TODO VMDESIGN 1322: adjust the amount consumed by the TLH refresh since a TLH refresh
 			 * may not give you the size requested */
-			/* Increase thread hungriness */
+			/* Increase thread hungriness (adaptive sizing derives the next refresh size from the allocation rate instead) */
 			/* TODO: TLH values (max/min/inc) should be per tlh, or somewhere else? */
-			if (getRefreshSize() < tlhMaximumSize) {
+			if (!extensions->tlhAdaptiveSizing && (getRefreshSize() < tlhMaximumSize)) {
 				setRefreshSize(getRefreshSize() + extensions->tlhIncrementSize);
 			}
 		}
@@ -296,6 +323,8 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 
 	Assert_MM_true(!env->getExtensions()->isSegregatedHeap());
 	uintptr_t sizeInBytesRequired = allocDescription->getContiguousBytes();
+	/* Allocations stop at an allocation site sample point, continue up to the real top of the TLH */
+	restoreTop();
 	/* If there's insufficient space, refresh the current TLH */
 	if (sizeInBytesRequired > getSize()) {
 		refresh(env, allocDescription, shouldCollectOnFailure);
@@ -315,6 +344,11 @@ MM_TLHAllocationSupport::allocateFromTLH(MM_EnvironmentBase *env, MM_AllocateDes
 		allocDescription->setObjectFlags(getObjectFlags());
 		allocDescription->setMemorySubSpace((MM_MemorySubSpace *)_tlh->memorySubSpace);
 		allocDescription->completedFromTlh();
+
+		MM_AllocationSiteSampler *sampler = env->getExtensions()->allocationSiteSampler;
+		if (NULL != sampler) {
+			sampleAllocation(env, sampler, memPtr, sizeInBytesRequired, true);
+		}
 	}
 
 	return memPtr;
@@ -345,10 +379,86 @@ MM_TLHAllocationSupport::allocateTLH(MM_EnvironmentBase *env, MM_AllocateDescrip
 void
 MM_TLHAllocationSupport::flushCache(MM_EnvironmentBase *env)
 {
-	/* Since AllocationStats have been reset, reset the base as well*/
+	flushAbandonedList();
+	clear(env);
+	resetAllocationRate(env);
+}
+
+void
+MM_TLHAllocationSupport::flushAbandonedList()
+{
+	if (NULL != _abandonedList) {
+		MM_AllocationStats *stats = _objectAllocationInterface->getAllocationStats();
+		for (MM_HeapLinkedFreeHeaderTLH *cache = _abandonedList; NULL != cache; cache = (MM_HeapLinkedFreeHeaderTLH *)cache->getNext()) {
+			stats->_tlhAbandonedCount += 1;
+			stats->_tlhAbandonedBytes += cache->getSize();
+		}
+	}
 	_abandonedList = NULL;
 	_abandonedListSize = 0;
-	clear(env);
+}
+
+void
+MM_TLHAllocationSupport::sampleAllocationRate(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t now = omrtime_hires_clock();
+
+	if ((0 != _rateSampleTime) && (now > _rateSampleTime)) {
+		uint64_t elapsedMicros = omrtime_hires_delta(_rateSampleTime, now, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t allocatedBytes = (uintptr_t)getRealAlloc() - (uintptr_t)getBase();
+		uintptr_t rate = (uintptr_t)((allocatedBytes * 1000) / OMR_MAX(elapsedMicros, 1));
+		if (0 != extensions->fvtest_tlhAllocationRate) {
+			rate = extensions->fvtest_tlhAllocationRate;
+		}
+
+		if (0 == _allocationRate) {
+			_allocationRate = rate;
+		} else {
+			_allocationRate = ((_allocationRate * TLH_ADAPTIVE_RATE_HISTORY_WEIGHT) + rate) / (TLH_ADAPTIVE_RATE_HISTORY_WEIGHT + 1);
+		}
+
+		if (_allocationRate > _allocationRateContribution) {
+			MM_AtomicOperations::add(&extensions->tlhAllocationRate, _allocationRate - _allocationRateContribution);
+		} else if (_allocationRate < _allocationRateContribution) {
+			MM_AtomicOperations::subtract(&extensions->tlhAllocationRate, _allocationRateContribution - _allocationRate);
+		}
+		_allocationRateContribution = _allocationRate;
+	}
+
+	_rateSampleTime = now;
+}
+
+void
+MM_TLHAllocationSupport::resetAllocationRate(MM_EnvironmentBase *env)
+{
+	if (0 != _allocationRateContribution) {
+		MM_AtomicOperations::subtract(&env->getExtensions()->tlhAllocationRate, _allocationRateContribution);
+		_allocationRateContribution = 0;
+	}
+	/* the time until the next refresh would include the GC */
+	_rateSampleTime = 0;
+}
+
+uintptr_t
+MM_TLHAllocationSupport::calculateAdaptiveRefreshSize(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	uint64_t refreshSize = (uint64_t)_allocationRate * TLH_ADAPTIVE_REFRESH_INTERVAL;
+
+	/* Bytes the thread is expected to allocate before the next GC: its share of the free memory */
+	uintptr_t globalRate = extensions->tlhAllocationRate;
+	if (globalRate >= _allocationRate) {
+		MM_MemorySubSpace *subspace = _objectAllocationInterface->getOwningEnv()->getMemorySpace()->getDefaultMemorySubSpace();
+		uint64_t freeBytes = subspace->getApproximateActiveFreeMemorySize();
+		uint64_t bytesBeforeGC = (freeBytes * _allocationRate) / OMR_MAX(globalRate, 1);
+		refreshSize = OMR_MIN(refreshSize, bytesBeforeGC);
+	}
+
+	refreshSize = OMR_MAX(refreshSize, (uint64_t)OMR_MAX(extensions->tlhMinimumSize, sizeInBytesRequired));
+	refreshSize = OMR_MIN(refreshSize, (uint64_t)extensions->tlhMaximumSize);
+	return MM_Math::roundToCeiling(extensions->getObjectAlignmentInBytes(), (uintptr_t)refreshSize);
 }
 
 void
@@ -360,6 +470,11 @@ MM_TLHAllocationSupport::setupTLH(MM_EnvironmentBase *env, void *addrBase, void
 		updateFrequentObjectsStats(env);
 	}
 
+	/* Count what was allocated from the outgoing TLH, and start counting from the base of the new one */
+	countSampledBytes();
+	_sampleAllocBase = addrBase;
+	_realTop = NULL;
+
 	/* Set the new TLH values */
 	setBase(addrBase);
 	setAlloc(addrBase);
@@ -395,6 +510,27 @@ MM_TLHAllocationSupport::updateFrequentObjectsStats(MM_EnvironmentBase *env)
 	}
 }
 
+void
+MM_TLHAllocationSupport::sampleAllocation(MM_EnvironmentBase *env, MM_AllocationSiteSampler *sampler, void *objectPtr, uintptr_t size, bool fromTLH)
+{
+	restoreTop();
+	countSampledBytes();
+	if (!fromTLH) {
+		_bytesUntilSample -= OMR_MIN(size, _bytesUntilSample);
+	}
+
+	if (0 == _bytesUntilSample) {
+		/* this allocation crossed the sample point */
+		sampler->recordSample(env, (omrobjectptr_t)objectPtr, size);
+		_bytesUntilSample = sampler->nextSampleInterval(&_sampleSeed);
+	}
+
+	if (_bytesUntilSample < getSize()) {
+		_realTop = getTop();
+		setTop((void *)((uintptr_t)getAlloc() + _bytesUntilSample));
+	}
+}
+
 #if defined(OMR_GC_OBJECT_ALLOCATION_NOTIFY)
 void
 MM_TLHAllocationSupport::objectAllocationNotify(MM_EnvironmentBase *env, void *heapBase, void *heapTop)
@@ -43,6 +43,7 @@
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
 class MM_AllocateDescription;
+class MM_AllocationSiteSampler;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_ObjectAllocationInterface;
@@ -68,6 +69,11 @@ class MM_TLHAllocationSupport
 public:
 protected:
 private:
+	enum {
+		TLH_ADAPTIVE_REFRESH_INTERVAL = 1, /**< time a TLH should last for with -Xgc:tlhAdaptiveSizing, in milliseconds */
+		TLH_ADAPTIVE_RATE_HISTORY_WEIGHT = 3 /**< weight of the previous allocation rate against a new sample */
+	};
+
 	OMR_VMThread * const _omrVMThread; /**< J9VMThread from caller's environment */
 	MM_LanguageThreadLocalHeap _languageTLH;
 	LanguageThreadLocalHeapStruct* const _tlh; /**< current TLH */
@@ -83,6 +89,15 @@ private:
 
 	const bool _zeroTLH; /**< if true this TLH is primary (might be cleared by batchClearTLH), if false this is secondary TLH (and it would not be cleared ever) */
 
+	void *_realTop; /**< top of the TLH while the TLH top is lowered to the next allocation site sample point, NULL otherwise */
+	void *_sampleAllocBase; /**< TLH alloc pointer from which allocated bytes are yet to be counted towards the next allocation site sample */
+	uintptr_t _bytesUntilSample; /**< bytes left to allocate before the next allocation site sample */
+	uint64_t _sampleSeed; /**< random state used to pick the allocation site sample intervals */
+
+	uint64_t _rateSampleTime; /**< hires clock at the last TLH refresh, 0 if the time since then is not a valid allocation rate sample (-Xgc:tlhAdaptiveSizing) */
+	uintptr_t _allocationRate; /**< moving average of the TLH allocation rate of the thread, in bytes per millisecond */
+	uintptr_t _allocationRateContribution; /**< part of the global TLH allocation rate (extensions->tlhAllocationRate) added by this TLH */
+
 public:
 protected:
 private:
@@ -90,6 +105,33 @@ private:
 
 	void flushCache(MM_EnvironmentBase *env);
 
+	/**
+	 * Empty the list of cached TLH remainders, accounting them as abandoned.  The memory is recovered by the next sweep.
+	 */
+	void flushAbandonedList();
+
+	/**
+	 * Update the allocation rate of the thread with the bytes allocated from the outgoing TLH since the last refresh,
+	 * and publish it in the global TLH allocation rate.
+	 */
+	void sampleAllocationRate(MM_EnvironmentBase *env);
+
+	/**
+	 * Remove the allocation rate of the thread from the global TLH allocation rate, and restart the sampling at the next refresh.
+	 * The thread keeps its own rate, which is published again with its next sample.
+	 */
+	void resetAllocationRate(MM_EnvironmentBase *env);
+
+	/**
+	 * Calculate the refresh size of the thread from its allocation rate.  The TLH should last for about
+	 * TLH_ADAPTIVE_REFRESH_INTERVAL, but no longer than the thread is expected to allocate until the next GC,
+	 * estimated from its share of the global TLH allocation rate and the free memory, so that little is left
+	 * unused in the TLH when the GC flushes it.
+	 * @param sizeInBytesRequired size of the allocation which triggered the refresh
+	 * @return the refresh size, within the TLH minimum and maximum sizes
+	 */
+	uintptr_t calculateAdaptiveRefreshSize(MM_EnvironmentBase *env, uintptr_t sizeInBytesRequired);
+
 	MMINLINE void *getBase() { return (void *)_tlh->heapBase; };
 	MMINLINE void setBase(void *basePtr) { _tlh->heapBase = (uint8_t *)basePtr; };
 
@@ -172,6 +214,41 @@ private:
 
 	void updateFrequentObjectsStats(MM_EnvironmentBase *env);
 
+	/**
+	 * Restore the top of the TLH, if it was lowered to the next allocation site sample point.
+	 */
+	MMINLINE void
+	restoreTop()
+	{
+		if (NULL != _realTop) {
+			setTop(_realTop);
+			_realTop = NULL;
+		}
+	}
+
+	/**
+	 * Count the bytes allocated from the TLH since the last call towards the next allocation site sample.
+	 */
+	MMINLINE void
+	countSampledBytes()
+	{
+		if (NULL != _sampleAllocBase) {
+			uintptr_t allocatedBytes = (uintptr_t)getAlloc() - (uintptr_t)_sampleAllocBase;
+			_bytesUntilSample -= OMR_MIN(allocatedBytes, _bytesUntilSample);
+			_sampleAllocBase = getAlloc();
+		}
+	}
+
+	/**
+	 * Count an allocation towards the next allocation site sample, take the sample if it is due, and lower the
+	 * top of the TLH to the following sample point if it is within the TLH.  Allocations which would cross the
+	 * sample point then leave the inline allocation path (if any) for allocateFromTLH().
+	 * @param objectPtr the allocated object
+	 * @param size size of the allocation in bytes
+	 * @param fromTLH true if the object was allocated from this TLH, false if it was allocated outside of the TLH
+	 */
+	void sampleAllocation(MM_EnvironmentBase *env, MM_AllocationSiteSampler *sampler, void *objectPtr, uintptr_t size, bool fromTLH);
+
 	/**
 	 * Create a ThreadLocalHeap object.
 	 */
@@ -185,7 +262,14 @@ private:
 		_objectAllocationInterface(NULL),
 		_abandonedList(NULL),
 		_abandonedListSize(0),
-		_zeroTLH(zeroTLH)
+		_zeroTLH(zeroTLH),
+		_realTop(NULL),
+		_sampleAllocBase(NULL),
+		_bytesUntilSample(0),
+		_sampleSeed((((uint64_t)(uintptr_t)this) * J9CONST_U64(0x9E3779B97F4A7C15)) | 1),
+		_rateSampleTime(0),
+		_allocationRate(0),
+		_allocationRateContribution(0)
 	{};
 
 	/*
@@ -197,10 +197,26 @@ MM_VirtualMemory::commitMemory(void* address, uintptr_t size)
 	bool success = true;
 
 	/* port library takes page aligned addresses and sizes only */
-	void* commitBase = (void*)MM_Math::roundToFloor(_pageSize, (uintptr_t)address);
-	void* commitTop = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)address + size + _tailPadding);
+	uintptr_t commitAlignment = _pageSize;
+	if (_transparentHugePageSize > _pageSize) {
+		/* a partially committed huge page can not be collapsed by khugepaged */
+		commitAlignment = _transparentHugePageSize;
+	}
+	void* commitBase = (void*)MM_Math::roundToFloor(commitAlignment, (uintptr_t)address);
+	void* commitTop = (void*)MM_Math::roundToCeiling(commitAlignment, (uintptr_t)address + size + _tailPadding);
 	uintptr_t commitSize;
 
+	if (commitAlignment != _pageSize) {
+		/* the reserved memory might not end on a huge page */
+		void* reserveTop = (void*)((uintptr_t)_baseAddress + _reserveSize);
+		if (commitBase < _baseAddress) {
+			commitBase = _baseAddress;
+		}
+		if (commitTop > reserveTop) {
+			commitTop = reserveTop;
+		}
+	}
+
 	if (commitBase <= commitTop) {
 		commitSize = (uintptr_t)commitTop - (uintptr_t)commitBase;
 	} else {
@@ -256,8 +272,13 @@ MM_VirtualMemory::decommitMemory(void* address, uintptr_t size, void* lowValidAd
 	}
 
 	/* port library takes page aligned addresses and sizes only */
-	decommitBase = (void*)MM_Math::roundToCeiling(_pageSize, (uintptr_t)decommitBase);
-	decommitTop = (void*)MM_Math::roundToFloor(_pageSize, (uintptr_t)decommitTop);
+	uintptr_t decommitAlignment = _pageSize;
+	if (_transparentHugePageSize > _pageSize) {
+		/* only the huge pages wholly inside the range: the range may share its first and last huge pages with live data */
+		decommitAlignment = _transparentHugePageSize;
+	}
+	decommitBase = (void*)MM_Math::roundToCeiling(decommitAlignment, (uintptr_t)decommitBase);
+	decommitTop = (void*)MM_Math::roundToFloor(decommitAlignment, (uintptr_t)decommitTop);
 
 	if (decommitBase < decommitTop) {
 		/* There is still memory to decommit, calculate size */
@@ -57,6 +57,7 @@ private:
 	uintptr_t _reserveSize; /**< The total number of bytes reserved, starting from _baseAddress */
 	uintptr_t _mode; /**< requested memory mode (memory flags combination) */
 	uintptr_t _consumerCount; /**< number of memory consumers attached to this virtual memory instance */
+	uintptr_t _transparentHugePageSize; /**< if not 0, commits are widened and decommits are bounded to whole transparent huge pages of this size */
 	J9PortVmemIdentifier _identifier;
 
 protected:
@@ -95,6 +96,7 @@ protected:
 		, _reserveSize(0)
 		, _mode(mode)
 		, _consumerCount(0)
+		, _transparentHugePageSize(0)
 		, _identifier()
 		, _extensions(env->getExtensions())
 		, _baseAddress(NULL)
@@ -152,6 +154,16 @@ protected:
 		return _pageFlags;
 	}
 
+	/**
+	 * Commit and decommit this virtual memory in whole transparent huge pages, so that khugepaged
+	 * can back every committed page of it (the reserved memory must start on a huge page).
+	 * @param transparentHugePageSize size of a transparent huge page
+	 */
+	MMINLINE void setTransparentHugePageSize(uintptr_t transparentHugePageSize)
+	{
+		_transparentHugePageSize = transparentHugePageSize;
+	}
+
 	/**
 	 * Return number of memory consumers attached to this virtual memory object
 	 * @return consumers number
@@ -114,6 +114,11 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	if(omrthread_monitor_init_with_name(&_allocatingPackets, 0, "MM_WorkPackets::allocatingPackets")) {
 		return false;
 	}
+
+	if (!_spillLock.initialize(env, &_extensions->lnrlOptions, "MM_WorkPackets:_spillLock")) {
+		return false;
+	}
+	_adaptivePacketSize = _extensions->adaptiveWorkPacketSize;
 	
 	_overflowHandler = createOverflowHandler(env, this);
 	if (NULL == _overflowHandler) {
@@ -148,6 +153,20 @@ MM_WorkPackets::initialize(MM_EnvironmentBase *env)
 	for(uintptr_t i = 0; i < _maxPacketsBlocks; i++) {    
 		_packetsStart[i] = NULL;
 	}
+
+	if (_extensions->packetListLockFree) {
+		/* lock-free lists tag their heads with a pool index rather than a pointer to avoid ABA */
+		_packetTable = (MM_Packet **)env->getForge()->allocate(sizeof(MM_Packet *) * _maxPackets, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == _packetTable) {
+			return false;
+		}
+		_emptyPacketList.enableLockFree(_packetTable);
+		_fullPacketList.enableLockFree(_packetTable);
+		_relativelyFullPacketList.enableLockFree(_packetTable);
+		_nonEmptyPacketList.enableLockFree(_packetTable);
+		_deferredPacketList.enableLockFree(_packetTable);
+		_deferredFullPacketList.enableLockFree(_packetTable);
+	}
 	
 	/* now allocate the initial active packets */
 	while(initialPacketCount > _activePackets) {
@@ -194,6 +213,10 @@ MM_WorkPackets::initWorkPacketsBlock(MM_EnvironmentBase *env)
 	for(uintptr_t i = 0; i < _packetsPerBlock; i++) {
 		baseAddress = (uintptr_t *) (dataStart + (i * dataSize));
 		currentPtr->initialize(env, nextPtr, previousPtr, baseAddress, _slotsInPacket);
+		currentPtr->setPoolIndex(_activePackets + i);
+		if (NULL != _packetTable) {
+			_packetTable[_activePackets + i] = currentPtr;
+		}
 
 		previousPtr = currentPtr;
 		currentPtr += 1;
@@ -231,6 +254,14 @@ MM_WorkPackets::tearDown(MM_EnvironmentBase *env)
 		}
 	}
 
+	if (NULL != _packetTable) {
+		env->getForge()->free(_packetTable);
+		_packetTable = NULL;
+	}
+
+	discardSpilledWork(env);
+	_spillLock.tearDown();
+
 	if (NULL != _inputListMonitor) {
 		omrthread_monitor_destroy(_inputListMonitor);
 		_inputListMonitor = NULL;
@@ -286,6 +317,8 @@ MM_WorkPackets::resetAllPackets(MM_EnvironmentBase *env)
 		putPacket(env, packet);
 	}
 
+	discardSpilledWork(env);
+
 	/* Do sanity check on ctrs */	
 	assume0(_deferredFullPacketList.getCount() == 0);
 	assume0(_deferredPacketList.getCount() == 0);
@@ -332,6 +365,7 @@ MM_WorkPackets::inputPacketAvailable(MM_EnvironmentBase *env)
 	bool res = 	((!_fullPacketList.isEmpty())
 				|| (!_relativelyFullPacketList.isEmpty())
 				|| (!_nonEmptyPacketList.isEmpty())
+				|| (0 != _spillChunkCount)
 				|| (!_overflowHandler->isEmpty()));
 				
 	return res;
@@ -376,6 +410,110 @@ MM_WorkPackets::getInputPacketFromOverflow(MM_EnvironmentBase *env)
 	return NULL;
 }
 
+/**
+ * Copy the contents of a full packet out to a chunk allocated from the forge, so that the packet
+ * can be reused without overflowing its contents (which is only resolved by rescanning the heap).
+ * The spilled work is handed out again, in an empty packet, once the packet lists run dry.
+ *
+ * @param packet - Reference to packet to be emptied
+ * @return true if the packet was emptied, false if the spill limit is reached or the chunk could not be allocated
+ */
+bool
+MM_WorkPackets::spillPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	uintptr_t slots = (uintptr_t)(packet->_currentPtr - packet->_basePtr);
+	uintptr_t chunkSize = sizeof(SpillChunk) + (slots * sizeof(uintptr_t));
+	SpillChunk *chunk = NULL;
+	bool reserved = false;
+
+	_spillLock.acquire();
+	if ((_spillBytes + chunkSize) <= _extensions->workPacketSpillMaximum) {
+		_spillBytes += chunkSize;
+		reserved = true;
+	}
+	_spillLock.release();
+
+	if (reserved) {
+		chunk = (SpillChunk *)env->getForge()->allocate(chunkSize, OMR::GC::AllocationCategory::WORK_PACKETS, OMR_GET_CALLSITE());
+		if (NULL == chunk) {
+			_spillLock.acquire();
+			_spillBytes -= chunkSize;
+			_spillLock.release();
+		} else {
+			chunk->_count = slots;
+			memcpy((void *)(chunk + 1), (void *)packet->_basePtr, slots * sizeof(uintptr_t));
+			packet->resetData(env);
+
+			_spillLock.acquire();
+			chunk->_next = _spillHead;
+			_spillHead = chunk;
+			_spillChunkCount += 1;
+			_spillLock.release();
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats.workPacketsSpilled += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		}
+	}
+
+	return (NULL != chunk);
+}
+
+/**
+ * Get an input packet filled with the most recently spilled work
+ *
+ * @return a packet if there was spilled work and an empty packet to copy it to, NULL otherwise
+ */
+MM_Packet *
+MM_WorkPackets::getInputPacketFromSpill(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+
+	if ((0 != _spillChunkCount) && (NULL != (packet = getPacket(env, &_emptyPacketList)))) {
+		SpillChunk *chunk = NULL;
+
+		_spillLock.acquire();
+		chunk = _spillHead;
+		if (NULL != chunk) {
+			_spillHead = chunk->_next;
+			_spillChunkCount -= 1;
+			_spillBytes -= sizeof(SpillChunk) + (chunk->_count * sizeof(uintptr_t));
+		}
+		_spillLock.release();
+
+		if (NULL == chunk) {
+			/* another thread took the last chunk */
+			putPacket(env, packet);
+			packet = NULL;
+		} else {
+			/* packets on the empty list are at full capacity, which holds any chunk */
+			Assert_MM_true(chunk->_count <= packet->freeSlots());
+			memcpy((void *)packet->_basePtr, (void *)(chunk + 1), chunk->_count * sizeof(uintptr_t));
+			packet->_currentPtr = packet->_basePtr + chunk->_count;
+			env->getForge()->free(chunk);
+		}
+	}
+
+	return packet;
+}
+
+/**
+ * Free any spilled work, which is discarded along with the contents of the packets
+ */
+void
+MM_WorkPackets::discardSpilledWork(MM_EnvironmentBase *env)
+{
+	SpillChunk *chunk = _spillHead;
+
+	while (NULL != chunk) {
+		SpillChunk *next = chunk->_next;
+		env->getForge()->free(chunk);
+		chunk = next;
+	}
+	_spillHead = NULL;
+	_spillChunkCount = 0;
+	_spillBytes = 0;
+}
+
 /**
  * Get an input packet if one is available
  * 
@@ -404,6 +542,10 @@ MM_WorkPackets::getInputPacketNoWait(MM_EnvironmentBase *env)
 		}
 	}
 
+	if(NULL == packet) {
+		packet = getInputPacketFromSpill(env);
+	}
+
 	if(NULL == packet) {
 		packet = getInputPacketFromOverflow(env);
 	}
@@ -579,8 +721,10 @@ MM_WorkPackets::getPacketByOverflowing(MM_EnvironmentBase *env)
 	
 	packet = getPacket(env, &_fullPacketList);
 	if(NULL != packet) {
-		/* Move the contents of the packet to overflow */
-		emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
+		/* Move the contents of the packet to the spill, or failing that to overflow */
+		if (!spillPacket(env, packet)) {
+			emptyToOverflow(env, packet, OVERFLOW_TYPE_WORKSTACK);
+		}
 		
 		omrthread_monitor_enter(_inputListMonitor);
 
@@ -709,9 +853,11 @@ MM_WorkPackets::putPacket(MM_EnvironmentBase *env, MM_Packet *packet)
 	bool mustNotifyWaitingThreads = false;
 
     /* Empty packet */
-	if(freeSlots == _slotsInPacket) {
+	if(packet->isEmpty()) {
 		list = &_emptyPacketList;
 		packet->clearOwner();
+		/* the capacity may have been cut for use as an output packet */
+		packet->resetCapacity();
 				
 	/* Full packet */
 	} else if(freeSlots == 0) {
@@ -35,6 +35,7 @@
 #include "modronopt.h"
 
 #include "BaseVirtual.hpp"
+#include "LightweightNonReentrantLock.hpp"
 #include "Packet.hpp"
 #include "PacketList.hpp"
 #include "WorkPacketOverflow.hpp"
@@ -64,7 +65,16 @@ protected:
 		_fullPacketThreshold = _slotsInPacket >> 4,
 		_satisfactoryCapacity = _slotsInPacket / 2,
 		_indexMask = 0xff,
-		_maxPacketSearch = 20
+		_maxPacketSearch = 20,
+		_maxCapacityShift = 3 /**< adaptive sizing cuts the capacity of output packets to no less than _slotsInPacket >> _maxCapacityShift */
+	};
+
+	/**
+	 * Marking work copied out of a full packet by spillPacket(); the slots follow the header.
+	 */
+	struct SpillChunk {
+		SpillChunk *_next;
+		uintptr_t _count; /**< number of slots in the chunk */
 	};
 
 	uintptr_t _packetsPerBlock;
@@ -73,6 +83,7 @@ protected:
 	uintptr_t _packetsBlocksTop;
 	omrthread_monitor_t _allocatingPackets;
 	MM_Packet *_packetsStart[_maxPacketsBlocks];
+	MM_Packet **_packetTable; /**< Packets by pool index (_maxPackets entries), only allocated when the packet lists are lock-free */
 	MM_PacketList _emptyPacketList;  /**< List for empty packets */
 	MM_PacketList _fullPacketList;  /**< List for full packets */
 	MM_PacketList _relativelyFullPacketList;  /**< List for relatively full packets */
@@ -89,8 +100,17 @@ protected:
 	MM_WorkPacketOverflow *_overflowHandler;
 	MM_GCExtensionsBase *_extensions;
 
+	bool _adaptivePacketSize; /**< Cached MM_GCExtensionsBase::adaptiveWorkPacketSize */
+	SpillChunk *_spillHead; /**< Most recently spilled chunk of marking work */
+	volatile uintptr_t _spillChunkCount; /**< Number of spilled chunks not yet handed out again */
+	uintptr_t _spillBytes; /**< Bytes of forge memory held by spilled chunks */
+	MM_LightweightNonReentrantLock _spillLock; /**< Lock for the spilled chunks */
+
 	void emptyToOverflow(MM_EnvironmentBase *env, MM_Packet *packet, MM_OverflowType type);
 	virtual MM_Packet *getInputPacketFromOverflow(MM_EnvironmentBase *env);
+	bool spillPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+	MM_Packet *getInputPacketFromSpill(MM_EnvironmentBase *env);
+	void discardSpilledWork(MM_EnvironmentBase *env);
 	bool initWorkPacketsBlock(MM_EnvironmentBase *env);
 
 	MM_Packet *getPacket(MM_EnvironmentBase *env, MM_PacketList *list);
@@ -131,7 +151,7 @@ public:
 	 */
 	MMINLINE bool isAllPacketsEmpty()
 	{
-		return(_emptyPacketList.getCount() == _activePackets);
+		return((_emptyPacketList.getCount() == _activePackets) && (0 == _spillChunkCount));
 	};
 	
 	/**
@@ -139,13 +159,27 @@ public:
 	 */
 	MMINLINE bool tracingExhausted()
 	{
-		return(_emptyPacketList.getCount() + _deferredPacketList.getCount() + _deferredFullPacketList.getCount() == _activePackets);
+		return((_emptyPacketList.getCount() + _deferredPacketList.getCount() + _deferredFullPacketList.getCount() == _activePackets) && (0 == _spillChunkCount));
 	};
 	
 	MMINLINE uintptr_t getThreadWaitCount() {
 		return _inputListWaitCount;
 	}
 
+	/**
+	 * Size a new output packet for the current demand for work.  While threads are waiting for
+	 * input packets, the capacity of the packet is cut (further for each waiting thread) so that
+	 * it fills and is handed over sooner.
+	 * @param packet an output packet just acquired by the current thread
+	 */
+	MMINLINE void adjustOutputPacketCapacity(MM_EnvironmentBase *env, MM_Packet *packet)
+	{
+		if (_adaptivePacketSize && packet->isEmpty()) {
+			uintptr_t shift = OMR_MIN(_inputListWaitCount, (uintptr_t)_maxCapacityShift);
+			packet->setCapacity(_slotsInPacket >> shift);
+		}
+	}
+
 	/**
 	 * Returns number of non-empty packets 
 	 */
@@ -226,6 +260,7 @@ public:
 		_activePackets(0),
 		_packetsBlocksTop(0),
 		_allocatingPackets(NULL),
+		_packetTable(NULL),
 		_emptyPacketList(env),
 		_fullPacketList(env),
 		_relativelyFullPacketList(env),
@@ -235,7 +270,13 @@ public:
 		_inputListMonitor(NULL),
 		_inputListWaitCount(0),
 		_inputListDoneIndex(0),
-		_overflowHandler(NULL)
+		_overflowHandler(NULL),
+		_extensions(NULL),
+		_adaptivePacketSize(false),
+		_spillHead(NULL),
+		_spillChunkCount(0),
+		_spillBytes(0),
+		_spillLock()
 	{
 		_typeId = __FUNCTION__;
 	}
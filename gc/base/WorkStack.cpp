@@ -26,6 +26,7 @@
 #include "WorkStack.hpp"
 
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
 #include "WorkPackets.hpp"
 #include "Packet.hpp"
 #include "Task.hpp"
@@ -46,6 +47,8 @@ MM_WorkStack::reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets)
 	Assert_MM_true(NULL == _inputPacket);
 	Assert_MM_true(NULL == _outputPacket);
 	Assert_MM_true(NULL == _deferredPacket);
+	Assert_MM_true(0 == _emptyMagazineCount);
+	Assert_MM_true(0 == _fullMagazineCount);
 }
 
 void
@@ -83,9 +86,94 @@ MM_WorkStack::flush(MM_EnvironmentBase *env)
 		_workPackets->putDeferredPacket(env, _deferredPacket);
 		_deferredPacket = NULL;
 	}	
+	flushFullMagazine(env);
+	flushEmptyMagazine(env);
+	_magazineSize = 0;
 	_workPackets = NULL;
 }
 
+void
+MM_WorkStack::enablePacketMagazines(MM_EnvironmentBase *env)
+{
+	_magazineSize = OMR_MIN(env->getExtensions()->workPacketMagazineSize, (uintptr_t)_maxMagazineSize);
+}
+
+void
+MM_WorkStack::flushEmptyMagazine(MM_EnvironmentBase *env)
+{
+	while (0 < _emptyMagazineCount) {
+		_emptyMagazineCount -= 1;
+		_workPackets->putPacket(env, _emptyMagazine[_emptyMagazineCount]);
+	}
+}
+
+void
+MM_WorkStack::flushFullMagazine(MM_EnvironmentBase *env)
+{
+	while (0 < _fullMagazineCount) {
+		_fullMagazineCount -= 1;
+		_workPackets->putOutputPacket(env, _fullMagazine[_fullMagazineCount]);
+	}
+}
+
+MM_Packet *
+MM_WorkStack::acquireOutputPacket(MM_EnvironmentBase *env)
+{
+	MM_Packet *packet = NULL;
+
+	if (0 < _emptyMagazineCount) {
+		_emptyMagazineCount -= 1;
+		packet = _emptyMagazine[_emptyMagazineCount];
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		env->_workPacketStats._packetMagazineHits += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	} else {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+		packet = _workPackets->getOutputPacket(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (NULL != packet) {
+			env->_workPacketStats.addToPacketAcquireTime(startTime, omrtime_hires_clock());
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	}
+
+	if (NULL != packet) {
+		_workPackets->adjustOutputPacketCapacity(env, packet);
+	}
+	return packet;
+}
+
+void
+MM_WorkStack::releaseOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet)
+{
+	if ((_fullMagazineCount < _magazineSize) && (0 == _workPackets->getThreadWaitCount())) {
+		_fullMagazine[_fullMagazineCount] = packet;
+		_fullMagazineCount += 1;
+	} else {
+		_workPackets->putOutputPacket(env, packet);
+		if (0 < _workPackets->getThreadWaitCount()) {
+			/* other threads ran out of work - share what this thread kept */
+			flushFullMagazine(env);
+		}
+	}
+}
+
+void
+MM_WorkStack::releaseInputPacket(MM_EnvironmentBase *env)
+{
+	if (_inputPacket->isEmpty() && (_emptyMagazineCount < _magazineSize)) {
+		_inputPacket->resetCapacity();
+		_emptyMagazine[_emptyMagazineCount] = _inputPacket;
+		_emptyMagazineCount += 1;
+	} else {
+		_workPackets->putPacket(env, _inputPacket);
+	}
+	_inputPacket = NULL;
+}
+
 /**
  * Push to a deferred packet.
  * 
@@ -135,8 +223,7 @@ MM_WorkStack::popNoWaitFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for resuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -192,8 +279,7 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 {
 	if(NULL != _inputPacket) {
 		/* The current input packet has been used up - return it to the output list for reuse */
-		_workPackets->putPacket(env, _inputPacket);
-		_inputPacket = NULL;
+		releaseInputPacket(env);
 	}
 
 	bool tryRetrieveInputPacket = true;
@@ -211,7 +297,10 @@ MM_WorkStack::popFailed(MM_EnvironmentBase *env)
 		}
 	}
 
-	/* Nothing is immediately available, wait for an input packet to arrive */
+	/* Nothing is immediately available, wait for an input packet to arrive. Spilled work can
+	 * only be handed out in an empty packet, so do not keep any while waiting.
+	 */
+	flushEmptyMagazine(env);
 	_inputPacket = _workPackets->getInputPacket(env);
 	if(NULL != _inputPacket) {
 		/* Any entry on the _inputPacket list must have at least 1 entry */
@@ -226,11 +315,11 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element)
 {
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
-		_workPackets->putOutputPacket(env, _outputPacket);
+		releaseOutputPacket(env, _outputPacket);
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	_outputPacket = acquireOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element, OVERFLOW_TYPE_WORKSTACK);
 	} else {
@@ -244,11 +333,11 @@ void MM_WorkStack::pushFailed(MM_EnvironmentBase *env, void *element1, void *ele
 {
 	if(_outputPacket) {
 		/* The output packet is full - move it to the input list */
-		_workPackets->putOutputPacket(env, _outputPacket);
+		releaseOutputPacket(env, _outputPacket);
 	}
 
 	/* Get a new output packet */
-	_outputPacket = _workPackets->getOutputPacket(env);
+	_outputPacket = acquireOutputPacket(env);
 	if (NULL == _outputPacket) {
 		_workPackets->overflowItem(env, element1, OVERFLOW_TYPE_WORKSTACK);
 		_workPackets->overflowItem(env, element2, OVERFLOW_TYPE_WORKSTACK);
@@ -282,8 +371,7 @@ MM_WorkStack::popNoWaitFromCurrentInputPacket(MM_EnvironmentBase *env)
 		result = _inputPacket->pop(env);
 		if (NULL == result) {
 			/* The current input packet has been used up - return it to the output list for reuse */
-			_workPackets->putPacket(env, _inputPacket);
-			_inputPacket = NULL;
+			releaseInputPacket(env);
 		}
 	}
 	return result;
@@ -298,7 +386,29 @@ MM_WorkStack::inputPacketAvailableFromWorkPackets(MM_EnvironmentBase *env)
 bool
 MM_WorkStack::retrieveInputPacket(MM_EnvironmentBase *env)
 {
+	if (0 < _fullMagazineCount) {
+		if (0 < _workPackets->getThreadWaitCount()) {
+			flushFullMagazine(env);
+		} else {
+			_fullMagazineCount -= 1;
+			_inputPacket = _fullMagazine[_fullMagazineCount];
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_workPacketStats._packetMagazineHits += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			return true;
+		}
+	}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t startTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	_inputPacket = _workPackets->getInputPacketNoWait(env);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if (NULL != _inputPacket) {
+		env->_workPacketStats.addToPacketAcquireTime(startTime, omrtime_hires_clock());
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	if (NULL == _inputPacket) {
 		/* If the output packet contains at least a free entry - invert the input/output */
 		if((NULL != _outputPacket) && !_outputPacket->isEmpty()) {
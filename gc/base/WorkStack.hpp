@@ -45,6 +45,10 @@ class MM_WorkStack : public MM_BaseNonVirtual
 {
 /* data members */
 private:
+	enum {
+		_maxMagazineSize = 8 /**< Upper bound of MM_GCExtensionsBase::workPacketMagazineSize */
+	};
+
 	MM_WorkPackets *_workPackets;
 	MM_Packet *_inputPacket;
 	MM_Packet *_outputPacket;
@@ -52,6 +56,12 @@ private:
 	
 	uintptr_t 		_pushCount;
 
+	MM_Packet *_emptyMagazine[_maxMagazineSize]; /**< Used up input packets kept by the thread for its next output packets */
+	MM_Packet *_fullMagazine[_maxMagazineSize]; /**< Output packets kept by the thread for its next input packets, while no thread is waiting for work */
+	uintptr_t _emptyMagazineCount;
+	uintptr_t _fullMagazineCount;
+	uintptr_t _magazineSize; /**< Number of packets each magazine holds, 0 when the magazines are not in use */
+
 /* function members */
 private:
 	/**
@@ -85,6 +95,38 @@ private:
 	 */
 	void *popNoWaitFailed(MM_EnvironmentBase *env);
 
+	/**
+	 * Get a new output packet, from the empty packet magazine if possible.
+	 * @param env[in] The thread which owns the work stack
+	 * @return the packet, or NULL if none is available
+	 */
+	MM_Packet *acquireOutputPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Hand over a (full) output packet, to the full packet magazine if no thread is waiting for work.
+	 * @param env[in] The thread which owns the work stack
+	 * @param packet[in] The packet to hand over
+	 */
+	void releaseOutputPacket(MM_EnvironmentBase *env, MM_Packet *packet);
+
+	/**
+	 * Return the used up input packet, to the empty packet magazine if there is room.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void releaseInputPacket(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the packets in the empty packet magazine to the shared packet lists.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void flushEmptyMagazine(MM_EnvironmentBase *env);
+
+	/**
+	 * Return the packets in the full packet magazine to the shared packet lists, so that other threads can process them.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void flushFullMagazine(MM_EnvironmentBase *env);
+
 public:
 	void reset(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	/**
@@ -95,6 +137,14 @@ public:
 	void prepareForWork(MM_EnvironmentBase *env, MM_WorkPackets *workPackets);
 	void flush(MM_EnvironmentBase *env);
 
+	/**
+	 * Let the thread keep a few empty and full packets to itself (see MM_GCExtensionsBase::workPacketMagazineSize)
+	 * rather than going through the shared packet lists for every packet.  The magazines are emptied, and
+	 * disabled, by flush() so they must only be enabled by work which ends with a flush.
+	 * @param env[in] The thread which owns the work stack
+	 */
+	void enablePacketMagazines(MM_EnvironmentBase *env);
+
 	/**
 	 * Immediately flush the output packet back to the shared pool so that it can be processed 
 	 * by another thread.
@@ -231,7 +281,10 @@ public:
 		_workPackets(NULL),
 		_inputPacket(NULL),
 		_outputPacket(NULL),
-		_deferredPacket(NULL)
+		_deferredPacket(NULL),
+		_emptyMagazineCount(0),
+		_fullMagazineCount(0),
+		_magazineSize(0)
 	{
 		_typeId = __FUNCTION__;
 	};
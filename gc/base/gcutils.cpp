@@ -190,6 +190,8 @@ getContractReasonAsString(ContractReason reason)
 		return "heap reconfiguration";
 	case FORCED_NURSERY_CONTRACT:
 		return "forced nursery contract";
+	case SCAV_PAUSE_TARGET_EXCEEDED:
+		return "scavenge pause exceeding target";
 	default:
 		return "unknown";
 	}
@@ -217,6 +219,8 @@ getExpandReasonAsString(ExpandReason reason)
 		return "forced nursery expand";
 	case HINT_PREVIOUS_RUNS:
 		return "hint from previous runs";
+	case SCAV_THROUGHPUT_GOAL_MISSED:
+		return "scavenges missing throughput goal";
 	default:
 		return "unknown";
 	}
@@ -92,6 +92,12 @@ MM_AllocationContextSegregated::initialize(MM_EnvironmentBase *env)
 		return false;
 	}
 
+	/* the small allocation lock needs to be acquired before the free region batch can be accessed, no concurrent access should be possible */
+	_freeRegionBatch = MM_RegionPoolSegregated::allocateHeapRegionQueue(env, MM_HeapRegionList::HRL_KIND_LOCAL_WORK, true, false, false);
+	if (NULL == _freeRegionBatch) {
+		return false;
+	}
+
 	return true;
 }
 
@@ -123,6 +129,11 @@ MM_AllocationContextSegregated::tearDown(MM_EnvironmentBase *env)
 		_perContextLargeFullRegions = NULL;
 	}
 
+	if (NULL != _freeRegionBatch) {
+		_freeRegionBatch->kill(env);
+		_freeRegionBatch = NULL;
+	}
+
 	MM_AllocationContext::tearDown(env);
 }
 
@@ -166,6 +177,9 @@ MM_AllocationContextSegregated::flush(MM_EnvironmentBase *env)
 	flushArraylet(env);
 	_regionPool->getArrayletSweepRegions()->enqueue(_perContextArrayletFullRegions);
 
+	/* give back the unused free regions so that the sweep can coalesce them */
+	_regionPool->returnFreeRegionBatch(env, _freeRegionBatch);
+
 	unlockContext();
 }
 
@@ -226,7 +240,18 @@ MM_AllocationContextSegregated::trySweepAndAllocateRegionFromSmallSizeClass(MM_E
 bool
 MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t sizeClass)
 {
-	MM_HeapRegionDescriptorSegregated *region = _regionPool->allocateFromRegionPool(env, 1, sizeClass, MAX_UINT);
+	MM_HeapRegionDescriptorSegregated *region = NULL;
+	uintptr_t batchSize = env->getExtensions()->regionGrantBatchSize;
+	if (1 < batchSize) {
+		/* take the free region lists locks once per batch rather than once per region */
+		if (_freeRegionBatch->isEmpty()) {
+			_regionPool->allocateFreeRegionBatch(env, _freeRegionBatch, batchSize);
+		}
+		region = _regionPool->allocateFromFreeRegionBatch(env, _freeRegionBatch, sizeClass);
+	}
+	if (NULL == region) {
+		region = _regionPool->allocateFromRegionPool(env, 1, sizeClass, MAX_UINT);
+	}
 	bool result = false;
 	if(NULL != region) {
 		/* cache the small full region in AC */
@@ -247,7 +272,8 @@ MM_AllocationContextSegregated::tryAllocateFromRegionPool(MM_EnvironmentBase *en
 bool
 MM_AllocationContextSegregated::shouldPreMarkSmallCells(MM_EnvironmentBase *env)
 {
-	return true;
+	/* in generational mode a marked object is old, so newly allocated cells have to stay unmarked */
+	return !env->getExtensions()->segregatedGenerational;
 }
 
 /*
@@ -378,6 +404,11 @@ MM_AllocationContextSegregated::allocateLarge(MM_EnvironmentBase *env, uintptr_t
 
 		/* reset ACL counts */
 		region->getMemoryPoolACL()->resetCounts();
+
+		if (_markingScheme->isIncrementalMarkActive()) {
+			/* small cells are premarked, large objects are marked here: allocation is black during the incremental mark */
+			_markingScheme->getMarkMap()->atomicSetBit((omrobjectptr_t)result);
+		}
 	}
 
 	return result;
@@ -61,6 +61,7 @@ private:
 	MM_HeapRegionQueue *_perContextSmallFullRegions[OMR_SIZECLASSES_NUM_SMALL+1]; /**< Per-context Regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextArrayletFullRegions; /**< Per-context Arraylet regions that have been allocated into during this GC cycle. */
 	MM_HeapRegionQueue *_perContextLargeFullRegions; /**< Per-context Large object regions that have been allocated into during this GC cycle. */
+	MM_HeapRegionQueue *_freeRegionBatch; /**< Free regions granted to this context in a batch, still free until taken for a small size class */
 
 /* Methods */
 public:
@@ -120,6 +121,7 @@ protected:
 		, _count(0)
 		, _perContextArrayletFullRegions(NULL)
 		, _perContextLargeFullRegions(NULL)
+		, _freeRegionBatch(NULL)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -90,6 +90,12 @@ MM_ConfigurationSegregated::initialize(MM_EnvironmentBase *env)
 			extensions->setSegregatedHeap(true);
 			extensions->setStandardGC(true);
 			extensions->arrayletsPerRegion = extensions->regionSize / env->getOmrVM()->_arrayletLeafSize;
+			/* the incremental mark relies on allocation being black, which the sticky mark bits of generational mode are not */
+			if (extensions->segregatedGenerational) {
+				extensions->segregatedIncremental = false;
+			}
+			/* increments of the incremental mark are paid for by allocating threads */
+			extensions->payAllocationTax = extensions->segregatedIncremental;
 			success = true;
 		}
 	}
@@ -76,6 +76,13 @@ public:
 
 	virtual MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess) = 0;
 
+	/**
+	 * Detach up to maxRegions committed free regions and enqueue them on batch as free singletons,
+	 * splitting contiguous ranges as needed.  The regions are left free (their type is set when they are used).
+	 * @return the number of regions enqueued on batch
+	 */
+	virtual uintptr_t allocateBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t maxRegions) = 0;
+
 	MM_HeapRegionDescriptorSegregated *allocate(MM_EnvironmentBase *env, uintptr_t szClass)
 	{
 		assert(_singleRegionsOnly);
@@ -97,6 +104,11 @@ public:
 	virtual bool isEmpty() { return 0 == _length; }
 	virtual uintptr_t getTotalRegions() = 0;
 	virtual void showList(MM_EnvironmentBase *env) = 0;
+
+	/* Lock statistics, reset once reported */
+	virtual uintptr_t getLockAcquireCount() = 0;
+	virtual uintptr_t getLockContendedCount() = 0;
+	virtual void resetLockCounts() = 0;
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -124,4 +124,38 @@ MM_LockingFreeHeapRegionList::allocate(MM_EnvironmentBase *env, uintptr_t szClas
 	return NULL;
 }
 
+uintptr_t
+MM_LockingFreeHeapRegionList::allocateBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t maxRegions)
+{
+	uintptr_t count = 0;
+	lock();
+	MM_HeapRegionDescriptorSegregated *cur = _head;
+	while ((NULL != cur) && (count < maxRegions)) {
+		MM_HeapRegionDescriptorSegregated *next = cur->getNext();
+		if (cur->isCommitted()) {
+			uintptr_t currentSize = cur->getRange();
+			uintptr_t take = OMR_MIN(currentSize, maxRegions - count);
+			detachInternal(cur);
+			if (take < currentSize) {
+				/* iteration stops after this range, so pushing the remainder back is safe */
+				MM_HeapRegionDescriptorSegregated *remainder = cur->splitRange(take);
+				pushInternal(remainder);
+			}
+			/* break the range up into free singletons */
+			cur->setFree(take);
+			MM_HeapRegionDescriptorSegregated *single = cur;
+			for (uintptr_t i = 0; i < take; i++) {
+				MM_HeapRegionDescriptorSegregated *rest = (1 < single->getRange()) ? single->splitRange(1) : NULL;
+				single->setFree(1);
+				batch->enqueue(single);
+				single = rest;
+			}
+			count += take;
+		}
+		cur = next;
+	}
+	unlock();
+	return count;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
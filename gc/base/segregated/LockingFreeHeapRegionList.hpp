@@ -45,6 +45,8 @@ private:
 	MM_HeapRegionDescriptorSegregated *_tail;
 	omrthread_monitor_t _lockMonitor;
 	uintptr_t _totalRegionsCount;
+	uintptr_t _lockAcquireCount; /**< Number of times the list lock was acquired (updated under the lock) */
+	uintptr_t _lockContendedCount; /**< Number of those acquisitions which found the lock held by another thread */
 
 /* Methods */
 public:
@@ -59,7 +61,9 @@ public:
 		_head(NULL),
 		_tail(NULL),
 		_lockMonitor(NULL),
-		_totalRegionsCount(0)
+		_totalRegionsCount(0),
+		_lockAcquireCount(0),
+		_lockContendedCount(0)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -161,8 +165,14 @@ public:
 
 	virtual MM_HeapRegionDescriptorSegregated* allocate(MM_EnvironmentBase *env, uintptr_t szClass, uintptr_t numRegions, uintptr_t maxExcess);
 
+	virtual uintptr_t allocateBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t maxRegions);
+
 	virtual uintptr_t getTotalRegions();
 
+	virtual uintptr_t getLockAcquireCount() { return _lockAcquireCount; }
+	virtual uintptr_t getLockContendedCount() { return _lockContendedCount; }
+	virtual void resetLockCounts() { _lockAcquireCount = 0; _lockContendedCount = 0; }
+
 	virtual void showList(MM_EnvironmentBase *env);
 
 	/**
@@ -177,7 +187,15 @@ public:
 
 protected:
 private:
-	MMINLINE void lock() { omrthread_monitor_enter(_lockMonitor); }
+	MMINLINE void
+	lock()
+	{
+		if (0 != omrthread_monitor_try_enter(_lockMonitor)) {
+			omrthread_monitor_enter(_lockMonitor);
+			_lockContendedCount += 1;
+		}
+		_lockAcquireCount += 1;
+	}
 	
 	MMINLINE void unlock() { omrthread_monitor_exit(_lockMonitor); }
 
@@ -217,6 +217,10 @@ MM_MemoryPoolSegregated::allocateObject(MM_EnvironmentBase *env, MM_AllocateDesc
 	} else {
 		result = (void *) allocateContiguous(env, allocDesc, allocationContext);
 	}
+
+	if ((NULL != result) && _extensions->payAllocationTax) {
+		allocDesc->setAllocationTaxSize(allocDesc->getBytesRequested());
+	}
 	return result;
 }
 
@@ -91,6 +91,10 @@ MM_MemorySubSpaceSegregated::allocate(MM_EnvironmentBase *env, MM_AllocateDescri
 	default:
 		Assert_MM_unreachable();
 	}
+
+	if (NULL != result) {
+		allocDescription->setMemorySubSpace(this);
+	}
 	return result;
 }
 
@@ -41,6 +41,8 @@
 
 #include "RegionPoolSegregated.hpp"
 
+#include "ut_j9mm.h"
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 uintptr_t defragBucketThresholds[NUM_DEFRAG_BUCKETS] = DEFRAG_BUCKET_THRESHOLDS;
@@ -321,6 +323,69 @@ MM_RegionPoolSegregated::allocateFromRegionPool(MM_EnvironmentBase *env, uintptr
 	return region;
 }
 
+uintptr_t
+MM_RegionPoolSegregated::allocateFreeRegionBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t maxRegions)
+{
+	/* prefer singletons, and only break up contiguous ranges (the coalescable ones last) when there are not enough */
+	uintptr_t count = _singleFreeList->allocateBatch(env, batch, maxRegions);
+	if (count < maxRegions) {
+		count += _multiFreeList->allocateBatch(env, batch, maxRegions - count);
+		if (count < maxRegions) {
+			count += _coalesceFreeList->allocateBatch(env, batch, maxRegions - count);
+		}
+	}
+
+	if (0 < count) {
+		MM_AtomicOperations::add(&_freeRegionBatchCount, 1);
+		MM_AtomicOperations::add(&_freeRegionBatchRegionCount, count);
+	}
+
+	return count;
+}
+
+MM_HeapRegionDescriptorSegregated *
+MM_RegionPoolSegregated::allocateFromFreeRegionBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t szClass)
+{
+	MM_HeapRegionDescriptorSegregated *region = batch->dequeue();
+
+	if (NULL != region) {
+		region->setRangeHead(region);
+		if (szClass == OMR_SIZECLASSES_LARGE) {
+			region->setLarge(1);
+		} else if (szClass == OMR_SIZECLASSES_ARRAYLET) {
+			region->setArraylet();
+		} else {
+			region->setSmall(szClass);
+		}
+		incrementRegionsInUse(1);
+		region->emptyRegionAllocated(env);
+	}
+
+	return region;
+}
+
+void
+MM_RegionPoolSegregated::returnFreeRegionBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch)
+{
+	/* the regions were never counted as in use */
+	_singleFreeList->push(batch);
+}
+
+void
+MM_RegionPoolSegregated::reportFreeRegionGrantStats(MM_EnvironmentBase *env)
+{
+	uintptr_t lockAcquireCount = _singleFreeList->getLockAcquireCount() + _multiFreeList->getLockAcquireCount() + _coalesceFreeList->getLockAcquireCount();
+	uintptr_t lockContendedCount = _singleFreeList->getLockContendedCount() + _multiFreeList->getLockContendedCount() + _coalesceFreeList->getLockContendedCount();
+
+	Trc_MM_RegionPoolSegregated_freeRegionGrantStats(env->getLanguageVMThread(), _freeRegionBatchCount, _freeRegionBatchRegionCount, lockAcquireCount, lockContendedCount);
+
+	_singleFreeList->resetLockCounts();
+	_multiFreeList->resetLockCounts();
+	_coalesceFreeList->resetLockCounts();
+	_freeRegionBatchCount = 0;
+	_freeRegionBatchRegionCount = 0;
+}
+
 /* join the lists for each buckets per size class, per split index */
 void
 MM_RegionPoolSegregated::joinBucketListsForSplitIndex(MM_EnvironmentBase *env)
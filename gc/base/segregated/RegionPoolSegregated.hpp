@@ -123,6 +123,8 @@ private:
 	MM_HeapRegionQueue *_largeSweepRegions; /**< Large object regions that are waiting to be swept during this GC cycle. */
 
 	volatile uintptr_t _regionsInUse; /**< Number of regions that are in use (not on a free list). */
+	volatile uintptr_t _freeRegionBatchCount; /**< Number of free region batches granted to allocation contexts since the stats were last reset */
+	volatile uintptr_t _freeRegionBatchRegionCount; /**< Number of regions in those batches */
 	
 	/**	
 	 * @note Maintain average occupancy (used cells/total cells), calculated after sweep
@@ -171,6 +173,29 @@ public:
 	static MM_HeapRegionQueue* allocateHeapRegionQueue(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly, bool concurrentAccess, bool trackFreeBytes);
 	static MM_FreeHeapRegionList* allocateFreeHeapRegionList(MM_EnvironmentBase *env, MM_HeapRegionList::RegionListKind regionListKind, bool singleRegionsOnly);
 	MM_HeapRegionDescriptorSegregated *allocateFromRegionPool(MM_EnvironmentBase *env, uintptr_t numRegions, uintptr_t szClass, uintptr_t maxExcess);
+
+	/**
+	 * Grant a batch of free singleton regions to an allocation context, taking each free list lock at most once.
+	 * The regions stay free (and are not counted as in use) until they are taken from the batch.
+	 * @return the number of regions enqueued on batch
+	 */
+	uintptr_t allocateFreeRegionBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t maxRegions);
+
+	/**
+	 * Take a region from a batch granted by allocateFreeRegionBatch() and make it a region of the given size class.
+	 * @return the region, or NULL if the batch is empty
+	 */
+	MM_HeapRegionDescriptorSegregated *allocateFromFreeRegionBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch, uintptr_t szClass);
+
+	/**
+	 * Return the unused regions of a batch to the free lists.
+	 */
+	void returnFreeRegionBatch(MM_EnvironmentBase *env, MM_HeapRegionQueue *batch);
+
+	/**
+	 * Report the free region batch and free list lock statistics of the cycle, and reset them.
+	 */
+	void reportFreeRegionGrantStats(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
 	MM_HeapRegionDescriptorSegregated *allocateRegionFromArrayletSizeClass(MM_EnvironmentBase *env);
 	MM_HeapRegionDescriptorSegregated *sweepAndAllocateRegionFromSmallSizeClass(MM_EnvironmentBase *env, uintptr_t sizeClass);
@@ -276,6 +301,8 @@ public:
 		, _largeFullRegions(NULL)
 		, _largeSweepRegions(NULL)
 		, _regionsInUse(0)
+		, _freeRegionBatchCount(0)
+		, _freeRegionBatchRegionCount(0)
 		, _isSweepingSmall(false)
 	{
 		_typeId = __FUNCTION__;
@@ -35,6 +35,8 @@
 #include "MemorySubSpace.hpp"
 #include "SizeClasses.hpp"
 #include "ObjectHeapIteratorSegregated.hpp"
+#include "SegregatedAllocationTracker.hpp"
+#include "SegregatedGC.hpp"
 
 #include "SegregatedAllocationInterface.hpp"
 
@@ -161,6 +163,11 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 				if (ac != NULL) {
 					cell = ac->preAllocateSmall(env, sizeInBytes);
 				}
+				if ((NULL != cell) && env->getExtensions()->payAllocationTax) {
+					/* the tax is paid when the cache is replenished */
+					allocateDescription->setAllocationTaxSize(sizeInBytes);
+					allocateDescription->setMemorySubSpace(memorySpace->getDefaultMemorySubSpace());
+				}
 			}
 		}
 		
@@ -188,6 +195,10 @@ MM_SegregatedAllocationInterface::allocateObject(MM_EnvironmentBase *env, MM_All
 		++_stats._allocationCount;
 	}
 
+	if ((NULL != cell) && (sizeInBytes <= OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES) && (NULL != env->_allocationTracker)) {
+		env->_allocationTracker->recordAllocationSize(sizeInBytes);
+	}
+
 	return cell;
 }
 
@@ -251,9 +262,20 @@ MM_SegregatedAllocationInterface::allocateArrayletLeaf(MM_EnvironmentBase *env,
 void
 MM_SegregatedAllocationInterface::flushCache(MM_EnvironmentBase *env)
 {
+	MM_SegregatedGC *globalCollector = (MM_SegregatedGC *)env->getExtensions()->getGlobalCollector();
+	MM_SegregatedMarkingScheme *markingScheme = (NULL == globalCollector) ? NULL : globalCollector->getMarkingScheme();
+	bool unmarkCells = (NULL != markingScheme) && markingScheme->isIncrementalMarkActive();
+
 	/* make the current caches walkable */
 	for (uintptr_t sizeClass = 0; sizeClass < OMR_SIZECLASSES_NUM_SMALL+1; sizeClass++) {
 		if (_allocationCache[sizeClass].current < _allocationCache[sizeClass].top) {
+			if (unmarkCells) {
+				/* the cells were premarked when the cache was replenished - unmark them so they are swept at the end of the incremental mark */
+				uintptr_t cellSize = _sizeClasses->getCellSize(sizeClass);
+				for (uintptr_t cell = (uintptr_t)_allocationCache[sizeClass].current; cell < (uintptr_t)_allocationCache[sizeClass].top; cell += cellSize) {
+					markingScheme->getMarkMap()->clearBit((omrobjectptr_t)cell);
+				}
+			}
 			MM_HeapLinkedFreeHeader *chunk = MM_HeapLinkedFreeHeader::getHeapLinkedFreeHeader(_allocationCache[sizeClass].current);
 			chunk->setSize((uintptr_t)_allocationCache[sizeClass].top - (uintptr_t)_allocationCache[sizeClass].current);
 			/* next pointer value is irrelevant, it just needs to be low bit tagged, to make it non-object */
@@ -23,6 +23,8 @@
 #include "omrcomp.h"
 #include "omrport.h"
 
+#include <string.h>
+
 #include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
@@ -60,6 +62,15 @@ MM_SegregatedAllocationTracker::initialize(MM_EnvironmentBase *env, uintptr_t vo
 	_flushThreshold = flushThreshold;
 	_globalBytesInUse = globalBytesInUse;
 	updateAllocationTrackerThreshold(env);
+
+	if (env->getExtensions()->sizeClassProfiling) {
+		uintptr_t histogramBytes = sizeof(uintptr_t) * OMR_SIZECLASSES_HISTOGRAM_SIZE;
+		_allocationHistogram = (uintptr_t *)env->getForge()->allocate(histogramBytes, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _allocationHistogram) {
+			return false;
+		}
+		memset(_allocationHistogram, 0, histogramBytes);
+	}
 	return true;
 }
 
@@ -71,6 +82,12 @@ MM_SegregatedAllocationTracker::tearDown(MM_EnvironmentBase *env)
 	 */
 	flushBytes();
 	updateAllocationTrackerThreshold(env);
+
+	if (NULL != _allocationHistogram) {
+		flushAllocationHistogram(env);
+		env->getForge()->free(_allocationHistogram);
+		_allocationHistogram = NULL;
+	}
 }
 
 void
@@ -124,6 +141,15 @@ MM_SegregatedAllocationTracker::addBytesFreed(MM_EnvironmentBase *env, uintptr_t
 	}
 }
 
+void
+MM_SegregatedAllocationTracker::flushAllocationHistogram(MM_EnvironmentBase *env)
+{
+	MM_SizeClasses *sizeClasses = env->getExtensions()->defaultSizeClasses;
+	if ((NULL != _allocationHistogram) && (NULL != sizeClasses)) {
+		sizeClasses->flushAllocationHistogram(env, _allocationHistogram);
+	}
+}
+
 /**
  * Atomically adds this thread's bytes in use to the global memory pool's bytes in use variable used to obtain the current free space approximation.
  */
@@ -25,6 +25,8 @@
 
 #include "omrcomp.h"
 
+#include "SizeClasses.hpp"
+
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
 class MM_EnvironmentBase;
@@ -37,6 +39,7 @@ private:
 	intptr_t _bytesAllocated; /**< A negative amount indicates this tracker has freed more bytes than allocated. */
 	uintptr_t _flushThreshold; /**< If |bytesAllocated| > this threshold, we'll flush the bytes allocated to the pool. */
 	volatile uintptr_t *_globalBytesInUse; /**< The memory pool accumulator to flush bytes to */
+	uintptr_t *_allocationHistogram; /**< Counts of small allocations per size (in granules) not yet flushed to the size classes, NULL unless sizeClassProfiling is enabled */
 
 public:
 	static MM_SegregatedAllocationTracker* newInstance(MM_EnvironmentBase *env, volatile uintptr_t *globalBytesInUse, uintptr_t flushThreshold);
@@ -48,6 +51,23 @@ public:
 	void addBytesAllocated(MM_EnvironmentBase* env, uintptr_t bytesAllocated);
 	void addBytesFreed(MM_EnvironmentBase* env, uintptr_t bytesFreed);
 	intptr_t getUnflushedBytesAllocated(MM_EnvironmentBase* env) { return _bytesAllocated; }
+
+	/**
+	 * Count a small object allocation in the allocation size histogram, when size class profiling is enabled.
+	 * Allocations which are inlined by the language (and never reach the allocation interface) are not counted.
+	 */
+	MMINLINE void
+	recordAllocationSize(uintptr_t sizeInBytes)
+	{
+		if (NULL != _allocationHistogram) {
+			_allocationHistogram[MM_SizeClasses::getHistogramIndex(sizeInBytes)] += 1;
+		}
+	}
+
+	/**
+	 * Add the allocation sizes recorded by this tracker to the histogram of the size classes.
+	 */
+	void flushAllocationHistogram(MM_EnvironmentBase* env);
 	
 protected:
 	virtual bool initialize(MM_EnvironmentBase *env, uintptr_t volatile *globalBytesInUse, uintptr_t flushThreshold);
@@ -58,6 +78,7 @@ private:
 		_bytesAllocated(0)
 		,_flushThreshold(0)
 		,_globalBytesInUse(NULL)
+		,_allocationHistogram(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
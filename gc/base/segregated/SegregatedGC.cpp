@@ -27,12 +27,18 @@
 #include "GlobalAllocationManagerSegregated.hpp"
 #include "Heap.hpp"
 #include "MarkMap.hpp"
+#include "Math.hpp"
+#include "MetronomeStats.hpp"
 #include "modronapicore.hpp"
 #include "MemoryPoolSegregated.hpp"
 #include "ParallelMarkTask.hpp"
+#include "RegionPoolSegregated.hpp"
 #include "SegregatedAllocationInterface.hpp"
+#include "SegregatedAllocationTracker.hpp"
+#include "SegregatedIncrementalMarkTask.hpp"
 #include "SegregatedMarkingScheme.hpp"
 #include "SegregatedSweepTask.hpp"
+#include "SublistFragment.hpp"
 #include "SweepSchemeSegregated.hpp"
 #include "SweepStats.hpp"
 #include "WorkPackets.hpp"
@@ -197,21 +203,44 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	if (NULL != gam) {
 		gam->flushAllocationContexts(env);
 	}
+	((MM_MemoryPoolSegregated *)env->getDefaultMemorySubSpace()->getMemoryPool())->getRegionPool()->reportFreeRegionGrantStats(env);
 
 	reportMarkStart(env);
 	markStats->_startTime = omrtime_hires_clock();
 	/* OMRTODO investigate / fix this function call */
 
-	_markingScheme->masterSetupForGC(env);
+	/* An incremental mark which is active was started by an earlier increment: complete it rather than mark from scratch */
+	bool incrementalMarkCompleted = _markingScheme->isIncrementalMarkActive() && completeIncrementalMark(env);
+
+	if (!incrementalMarkCompleted) {
+		_markingScheme->masterSetupForGC(env);
+
+//		if (env->_cycleState->_gcCode.isOutOfMemoryGC()) {
+//			env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
+//		}
+
+		/* A young collection keeps the (sticky) mark bits of the objects which survived earlier collections
+		 * and starts from the remembered set as well as the roots.  A full collection starts from a clear mark map.
+		 */
+		bool youngCollection = shouldCollectYoung(env);
+		if (_extensions->segregatedGenerational) {
+			flushRememberedSetFragments(env);
+			if (youngCollection) {
+				_extensions->rememberedSet.startProcessingSublist();
+			}
+		}
+		_markingScheme->setYoungCollection(youngCollection);
 
-//	if (env->_cycleState->_gcCode.isOutOfMemoryGC()) {
-//		env->_cycleState->_referenceObjectOptions |= MM_CycleState::references_soft_as_weak;
-//	}
+		/* run the mark */
+		bool initMarkMap = !youngCollection;
+		MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
+		_dispatcher->run(env, &markTask);
 
-	/* run the mark */
-	bool initMarkMap = true; // reset the markmap?
-	MM_ParallelMarkTask markTask(env, _dispatcher, _markingScheme, initMarkMap, env->_cycleState);
-	_dispatcher->run(env, &markTask);
+		if (_extensions->segregatedGenerational) {
+			/* objects remembered before a full collection were not scanned from the remembered set */
+			_markingScheme->clearRememberedSet(env, !youngCollection);
+		}
+	}
 
 	Assert_MM_true(_markingScheme->getWorkPackets()->isAllPacketsEmpty());
 
@@ -239,6 +268,14 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	/* Perform the resize now based on expand/contract calculation from checkResize() (above) */
 	activeSubSpace->performResize(env, allocDescription);
 
+	if (_extensions->segregatedGenerational) {
+		/* the sweep left the mark bits set, so survivors are old until a full collection clears them */
+		uintptr_t activeMemorySize = _extensions->heap->getActiveMemorySize();
+		uintptr_t freeMemorySize = _extensions->heap->getApproximateActiveFreeMemorySize();
+		uintptr_t occupiedMemorySize = activeMemorySize - OMR_MIN(freeMemorySize, activeMemorySize);
+		_fullCollectionPending = (occupiedMemorySize > ((activeMemorySize / 100) * _extensions->segregatedFullCollectionOccupancy));
+	}
+
 	/* Heap size now fixed for next cycle so reset heap statistics */
 	_extensions->heap->resetHeapStatistics(true);
 
@@ -247,11 +284,169 @@ MM_SegregatedGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpa
 	while(OMR_VMThread* thread = vmThreadListIterator.nextOMRVMThread()) {
 		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(thread);
 		((MM_SegregatedAllocationInterface *)(walkEnv->_objectAllocationInterface))->restartCache(walkEnv);
+		if (NULL != walkEnv->_allocationTracker) {
+			walkEnv->_allocationTracker->flushAllocationHistogram(walkEnv);
+		}
 	}
 
 	return true;
 }
 
+bool
+MM_SegregatedGC::shouldCollectYoung(MM_EnvironmentBase *env)
+{
+	bool youngCollection = false;
+	if (_extensions->segregatedGenerational && !_fullCollectionPending && !_markingScheme->isRememberedSetOverflow()) {
+		MM_GCCode gcCode = env->_cycleState->_gcCode;
+		youngCollection = !gcCode.isExplicitGC() && !gcCode.isOutOfMemoryGC() && !gcCode.isAggressiveGC();
+	}
+	return youngCollection;
+}
+
+void
+MM_SegregatedGC::flushRememberedSetFragments(MM_EnvironmentBase *env)
+{
+	GC_OMRVMThreadListIterator vmThreadListIterator(env->getOmrVM());
+	while (OMR_VMThread *thread = vmThreadListIterator.nextOMRVMThread()) {
+		MM_EnvironmentBase *walkEnv = MM_EnvironmentBase::getEnvironment(thread);
+		MM_SublistFragment::flush(&walkEnv->_segregatedRememberedSet);
+	}
+}
+
+bool
+MM_SegregatedGC::isIncrementDue(MM_EnvironmentBase *env)
+{
+	uintptr_t freeMemorySize = _extensions->heap->getApproximateActiveFreeMemorySize();
+	bool due = false;
+	if (_markingScheme->isIncrementalMarkActive()) {
+		due = (_freeMemoryAtLastIncrement >= freeMemorySize) && ((_freeMemoryAtLastIncrement - freeMemorySize) >= _incrementAllocationBudget);
+	} else {
+		due = freeMemorySize < ((_extensions->heap->getActiveMemorySize() / 100) * _extensions->segregatedIncrementalKickoff);
+	}
+	return due;
+}
+
+void
+MM_SegregatedGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	if (isIncrementDue(env)) {
+		env->acquireExclusiveVMAccessForGC(this, false, false);
+		/* another thread may have paid the tax while this one was waiting for exclusive access */
+		if (isIncrementDue(env)) {
+			if (!_markingScheme->isIncrementalMarkActive()) {
+				startIncrementalMark(env, subspace);
+			} else if (_markingScheme->getWorkPackets()->isAllPacketsEmpty() || _markingScheme->isSnapshotOverflow()) {
+				/* no work is left for an increment: the collection completes the mark and sweeps */
+				garbageCollect(env, subspace, NULL, J9MMCONSTANT_IMPLICIT_GC_DEFAULT, NULL, NULL, NULL);
+			} else {
+				runMarkIncrement(env, false);
+			}
+		}
+		env->releaseExclusiveVMAccessForGC();
+	}
+}
+
+void
+MM_SegregatedGC::startIncrementalMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace)
+{
+	/* Cells in the allocation caches were premarked before the mark map is cleared by the first increment,
+	 * so they would be allocated unmarked: give them up, to be swept at the end of the cycle.
+	 */
+	GC_OMRVMInterface::flushCachesForGC(env);
+
+	_cycleState = MM_CycleState();
+	_cycleState._collectionStatistics = &_collectionStatistics;
+	_cycleState._gcCode = MM_GCCode(J9MMCONSTANT_IMPLICIT_GC_DEFAULT);
+	_cycleState._type = _cycleType;
+	_cycleState._activeSubSpace = subSpace;
+
+	/* the occupied heap bounds the bytes to be scanned by the mark */
+	uintptr_t activeMemorySize = _extensions->heap->getActiveMemorySize();
+	uintptr_t freeMemorySize = _extensions->heap->getApproximateActiveFreeMemorySize();
+	_liveBytesEstimate = activeMemorySize - OMR_MIN(freeMemorySize, activeMemorySize);
+
+	Trc_MM_SegregatedGC_incrementalMarkStart(env->getLanguageVMThread(), freeMemorySize, activeMemorySize, _liveBytesEstimate);
+
+	_extensions->globalGCStats.metronomeStats.clearCycle();
+	_markingScheme->masterSetupForGC(env);
+	_markingScheme->setYoungCollection(false);
+	runMarkIncrement(env, true);
+	_markingScheme->setIncrementalMarkActive(true);
+}
+
+void
+MM_SegregatedGC::runMarkIncrement(MM_EnvironmentBase *env, bool initialIncrement)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_MarkStats *markStats = &_extensions->globalGCStats.markStats;
+	MM_MetronomeStats *metronomeStats = &_extensions->globalGCStats.metronomeStats;
+	uintptr_t bytesScannedBefore = markStats->_bytesScanned;
+	uint64_t budgetMicros = _extensions->segregatedQuantumBudget;
+	uint64_t startTime = omrtime_hires_clock();
+	uint64_t deadline = startTime + ((budgetMicros * omrtime_hires_frequency()) / 1000000);
+
+	/* the references recorded by the snapshot barrier since the last increment are marked by this one */
+	flushRememberedSetFragments(env);
+	_extensions->rememberedSet.startProcessingSublist();
+
+	env->_cycleState = &_cycleState;
+	MM_SegregatedIncrementalMarkTask markTask(env, _dispatcher, _markingScheme, initialIncrement, deadline, env->_cycleState);
+	_dispatcher->run(env, &markTask);
+	env->_cycleState = NULL;
+
+	_markingScheme->clearRememberedSet(env, false);
+
+	uint64_t incrementMicros = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	uintptr_t bytesScanned = markStats->_bytesScanned - bytesScannedBefore;
+	metronomeStats->recordIncrement(incrementMicros, budgetMicros, bytesScanned);
+	updateIncrementPacing(env);
+
+	Trc_MM_SegregatedGC_markIncrementEnd(env->getLanguageVMThread(), metronomeStats->_incrementCount, incrementMicros, budgetMicros, bytesScanned, _incrementAllocationBudget);
+}
+
+void
+MM_SegregatedGC::updateIncrementPacing(MM_EnvironmentBase *env)
+{
+	MM_MetronomeStats *metronomeStats = &_extensions->globalGCStats.metronomeStats;
+	uintptr_t freeMemorySize = _extensions->heap->getApproximateActiveFreeMemorySize();
+
+	_freeMemoryAtLastIncrement = freeMemorySize;
+	if (_markingScheme->getWorkPackets()->isAllPacketsEmpty()) {
+		/* the mark can be completed by the next allocation tax */
+		_incrementAllocationBudget = 0;
+	} else {
+		uintptr_t bytesPerIncrement = OMR_MAX(metronomeStats->_cycleBytesScanned / metronomeStats->_incrementCount, 1);
+		uintptr_t remainingBytes = MM_Math::saturatingSubtract(_liveBytesEstimate, metronomeStats->_cycleBytesScanned);
+		uintptr_t remainingIncrements = (remainingBytes / bytesPerIncrement) + 1;
+		/* at least a region between increments, so a nearly full heap does not turn into back to back increments */
+		_incrementAllocationBudget = OMR_MAX(freeMemorySize / (2 * remainingIncrements), _extensions->regionSize);
+	}
+}
+
+bool
+MM_SegregatedGC::completeIncrementalMark(MM_EnvironmentBase *env)
+{
+	MM_MetronomeStats *metronomeStats = &_extensions->globalGCStats.metronomeStats;
+	bool completed = false;
+
+	flushRememberedSetFragments(env);
+	if (_markingScheme->isSnapshotOverflow()) {
+		/* an overwritten reference was not recorded, so objects reachable at the start of the cycle may be unmarked */
+		_markingScheme->clearRememberedSet(env, false);
+	} else {
+		_extensions->rememberedSet.startProcessingSublist();
+		MM_SegregatedIncrementalMarkTask markTask(env, _dispatcher, _markingScheme, false, 0, env->_cycleState);
+		_dispatcher->run(env, &markTask);
+		_markingScheme->clearRememberedSet(env, false);
+		completed = true;
+	}
+	_markingScheme->setIncrementalMarkActive(false);
+
+	Trc_MM_SegregatedGC_incrementalMarkEnd(env->getLanguageVMThread(), completed ? "true" : "false", metronomeStats->_incrementCount, metronomeStats->_incrementsOverBudgetCount,
+			metronomeStats->_maxIncrementMicros, metronomeStats->_totalIncrementMicros, metronomeStats->_cycleBytesScanned);
+	return completed;
+}
+
 void
 MM_SegregatedGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
 {
@@ -48,6 +48,10 @@ protected:
 
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
+	bool _fullCollectionPending; /**< In generational mode, true if the heap occupancy after the last collection calls for a full collection */
+	uintptr_t _liveBytesEstimate; /**< In incremental mode, estimate of the bytes the incremental mark scans in a cycle */
+	uintptr_t _freeMemoryAtLastIncrement; /**< In incremental mode, approximate free heap at the end of the last increment */
+	uintptr_t _incrementAllocationBudget; /**< In incremental mode, bytes the mutators may allocate before the next increment is due */
 private:
 public:
 	/* OMRTODO Remove _objectsMarked and _scanBytes, they are used to fake marking to create more interesting verbose output */
@@ -73,6 +77,50 @@ protected:
 	void reportSweepStart(MM_EnvironmentBase *env);
 	void reportSweepEnd(MM_EnvironmentBase *env);
 
+	/**
+	 * Decide whether the collection keeps the mark bits of old objects (generational mode).
+	 * Explicit, out of memory and aggressive collections, and the collection which follows a remembered set
+	 * overflow or a collection which left the heap occupancy above segregatedFullCollectionOccupancy, are full collections.
+	 * @return true if the collection is a young collection
+	 */
+	bool shouldCollectYoung(MM_EnvironmentBase *env);
+
+	/**
+	 * Flush the thread local fragments of the remembered set, before the remembered set is processed.
+	 */
+	void flushRememberedSetFragments(MM_EnvironmentBase *env);
+
+	/**
+	 * @return true if the allocation tax is due: an increment of the active incremental mark (or the collection which
+	 * completes it), or the first increment of a new cycle if the free heap has dropped below segregatedIncrementalKickoff
+	 */
+	bool isIncrementDue(MM_EnvironmentBase *env);
+
+	/**
+	 * Start an incremental mark cycle and run its first increment, which initializes the mark map and marks the roots.
+	 * @note Expects exclusive access to be held.
+	 */
+	void startIncrementalMark(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
+
+	/**
+	 * Run one increment of the incremental mark, bounded by segregatedQuantumBudget (except for the work of the first increment
+	 * which precedes scanning), and record it in the metronome stats.
+	 * @note Expects exclusive access to be held.
+	 */
+	void runMarkIncrement(MM_EnvironmentBase *env, bool initialIncrement);
+
+	/**
+	 * Pacing: size the allocation budget to the next increment so that the mark is expected to complete with half of the
+	 * current free heap left, given the average bytes scanned by an increment and the live bytes still to be scanned.
+	 */
+	void updateIncrementPacing(MM_EnvironmentBase *env);
+
+	/**
+	 * Complete the incremental mark, without a time bound, at the start of the collection which ends the cycle.
+	 * @return true if the mark was completed, false if the snapshot overflowed and the collection has to mark from scratch
+	 */
+	bool completeIncrementalMark(MM_EnvironmentBase *env);
+
 public:
 	static MM_SegregatedGC *newInstance(MM_EnvironmentBase *env);
 	virtual void kill(MM_EnvironmentBase *env);
@@ -92,6 +140,11 @@ public:
 	virtual void internalPreCollect(MM_EnvironmentBase*, MM_MemorySubSpace*, MM_AllocateDescription*, uint32_t);
 	virtual void internalPostCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace);
 
+	/**
+	 * In incremental mode, allocating threads run the increments of the mark as their allocation tax.
+	 */
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+
 	virtual uintptr_t getVMStateID() { return 100; }
 
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
@@ -120,6 +173,10 @@ public:
 		, _markingScheme(NULL)
 		, _sweepScheme(NULL)
 		, _dispatcher(_extensions->dispatcher)
+		, _fullCollectionPending(false)
+		, _liveBytesEstimate(0)
+		, _freeMemoryAtLastIncrement(0)
+		, _incrementAllocationBudget(0)
 		, _scanBytes(0)
 		, _objectsMarked(0)
 	{
@@ -0,0 +1,78 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#if !defined(SEGREGATEDINCREMENTALMARKTASK_HPP_)
+#define SEGREGATEDINCREMENTALMARKTASK_HPP_
+
+#include "omrcfg.h"
+#include "omrmodroncore.h"
+
+#include "CycleState.hpp"
+#include "ParallelTask.hpp"
+
+#if defined(OMR_GC_SEGREGATED_HEAP)
+
+class MM_Dispatcher;
+class MM_EnvironmentBase;
+class MM_SegregatedMarkingScheme;
+
+/**
+ * One increment of the incremental mark of the segregated heap.
+ * The first increment of a cycle initializes the mark map and marks the roots.  Every increment marks the
+ * references recorded by the snapshot barrier since the previous increment and then scans until the deadline.
+ * The increment which completes the mark has no deadline, and scans until all work (including overflow) is done.
+ */
+class MM_SegregatedIncrementalMarkTask : public MM_ParallelTask
+{
+/* Data members / types */
+public:
+protected:
+private:
+	MM_SegregatedMarkingScheme *_markingScheme;
+	const bool _initialIncrement; /**< True for the first increment of the cycle */
+	const uint64_t _deadline; /**< Hires clock value at which scanning stops, 0 to complete the mark */
+	MM_CycleState *_cycleState; /**< Collection cycle state active for the task */
+
+/* Methods */
+public:
+	virtual uintptr_t getVMStateID() { return OMRVMSTATE_GC_MARK; };
+
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void setup(MM_EnvironmentBase *env);
+	virtual void cleanup(MM_EnvironmentBase *env);
+
+	MM_SegregatedIncrementalMarkTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_SegregatedMarkingScheme *markingScheme, bool initialIncrement, uint64_t deadline, MM_CycleState *cycleState)
+		: MM_ParallelTask(env, dispatcher)
+		, _markingScheme(markingScheme)
+		, _initialIncrement(initialIncrement)
+		, _deadline(deadline)
+		, _cycleState(cycleState)
+	{
+		_typeId = __FUNCTION__;
+	}
+protected:
+private:
+};
+
+#endif /* OMR_GC_SEGREGATED_HEAP */
+
+#endif /* SEGREGATEDINCREMENTALMARKTASK_HPP_ */
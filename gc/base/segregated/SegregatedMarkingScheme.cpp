@@ -20,7 +20,13 @@
  * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
  *******************************************************************************/
 
+#include "ModronAssertions.h"
+
 #include "EnvironmentBase.hpp"
+#include "SublistIterator.hpp"
+#include "SublistPool.hpp"
+#include "SublistPuddle.hpp"
+#include "SublistSlotIterator.hpp"
 
 #include "SegregatedMarkingScheme.hpp"
 
@@ -57,4 +63,82 @@ MM_SegregatedMarkingScheme::kill(MM_EnvironmentBase *env)
 	env->getForge()->free(this);
 }
 
+void
+MM_SegregatedMarkingScheme::markLiveObjectsRoots(MM_EnvironmentBase *env)
+{
+	MM_MarkingScheme::markLiveObjectsRoots(env);
+
+	if (_youngCollection) {
+		/* the puddles were moved to the previous list by the master thread before the mark task started */
+		MM_SublistPuddle *puddle = NULL;
+		while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				omrobjectptr_t objectPtr = *slotPtr;
+				if (NULL != objectPtr) {
+					Assert_MM_true(_markMap->isBitSet(objectPtr));
+					_extensions->objectModel.clearRemembered(objectPtr);
+					env->_workStack.push(env, (void *)objectPtr);
+				}
+			}
+		}
+	}
+}
+
+void
+MM_SegregatedMarkingScheme::clearRememberedSet(MM_EnvironmentBase *env, bool clearRememberedState)
+{
+	if (clearRememberedState) {
+		GC_SublistIterator remSetIterator(&_extensions->rememberedSet);
+		MM_SublistPuddle *puddle = NULL;
+		while (NULL != (puddle = remSetIterator.nextList())) {
+			GC_SublistSlotIterator remSetSlotIterator(puddle);
+			omrobjectptr_t *slotPtr = NULL;
+			while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+				if (NULL != *slotPtr) {
+					_extensions->objectModel.clearRemembered(*slotPtr);
+				}
+			}
+		}
+	}
+	_extensions->rememberedSet.clear(env);
+	_rememberedSetOverflow = false;
+}
+
+void
+MM_SegregatedMarkingScheme::markSnapshotSet(MM_EnvironmentBase *env)
+{
+	MM_SublistPuddle *puddle = NULL;
+	while (NULL != (puddle = _extensions->rememberedSet.popPreviousPuddle(puddle))) {
+		GC_SublistSlotIterator remSetSlotIterator(puddle);
+		omrobjectptr_t *slotPtr = NULL;
+		while (NULL != (slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot())) {
+			inlineMarkObject(env, *slotPtr);
+		}
+	}
+}
+
+bool
+MM_SegregatedMarkingScheme::scanIncrement(MM_EnvironmentBase *env, uint64_t deadline)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	/* objects scanned between reads of the clock */
+	const uintptr_t objectsPerClockCheck = 64;
+	uintptr_t objectsUntilClockCheck = objectsPerClockCheck;
+	omrobjectptr_t objectPtr = NULL;
+
+	while (NULL != (objectPtr = (omrobjectptr_t)env->_workStack.popNoWait(env))) {
+		scanObject(env, objectPtr, SCAN_REASON_PACKET);
+		objectsUntilClockCheck -= 1;
+		if (0 == objectsUntilClockCheck) {
+			if (omrtime_hires_clock() >= deadline) {
+				return false;
+			}
+			objectsUntilClockCheck = objectsPerClockCheck;
+		}
+	}
+	return true;
+}
+
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -26,16 +26,27 @@
 #include "omrcomp.h"
 #include "objectdescription.h"
 
+#include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "HeapRegionDescriptorSegregated.hpp"
 #include "MarkingScheme.hpp"
+#include "SublistFragment.hpp"
 
 #include "BaseVirtual.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
-class MM_EnvironmentBase;
-
+/**
+ * Marking scheme of the segregated heap.
+ * In generational mode (segregatedGenerational) mark bits are sticky: they are left set by the sweep, so every
+ * object which survived a collection is old, and a young collection only marks objects allocated since the last
+ * collection.  The write barrier remembers marked objects which are assigned a reference to an unmarked object,
+ * and the remembered objects are scanned as roots of a young collection.
+ * In incremental mode (segregatedIncremental) the mark runs in increments between which mutators run.  The mark
+ * is snapshot-at-the-beginning: the write barrier records the reference a slot held before it is overwritten,
+ * and objects allocated while the mark is active are allocated marked.  The remembered set, which generational
+ * mode would use, holds the recorded references until the next increment marks them.
+ */
 class MM_SegregatedMarkingScheme : public MM_MarkingScheme
 {
 	/*
@@ -44,12 +55,108 @@ class MM_SegregatedMarkingScheme : public MM_MarkingScheme
 public:
 protected:
 private:
+	bool _youngCollection; /**< True if the current collection keeps the mark bits of old objects (generational mode) */
+	volatile bool _rememberedSetOverflow; /**< True if an object could not be added to the remembered set since the last collection */
+	volatile bool _incrementalMarkActive; /**< True from the first increment of an incremental mark until the collection which completes it */
+	volatile bool _snapshotOverflow; /**< True if an overwritten reference could not be recorded during the active incremental mark */
+
 	/*
 	 * Function members
 	 */
 public:
 	static MM_SegregatedMarkingScheme *newInstance(MM_EnvironmentBase *env);
 	void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Mark roots, and the remembered set in a young collection.
+	 * Remembered objects are old (marked), so they are pushed for scanning without being marked.
+	 */
+	virtual void markLiveObjectsRoots(MM_EnvironmentBase *env);
+
+	/**
+	 * Empty the remembered set at the end of a collection.
+	 * @param clearRememberedState true if the remembered objects are not scanned by this collection, and
+	 * their remembered state has to be cleared so the write barrier can remember them again
+	 */
+	void clearRememberedSet(MM_EnvironmentBase *env, bool clearRememberedState);
+
+	/**
+	 * Mark the references recorded by the snapshot barrier since the previous increment.
+	 * The master thread moves the recorded puddles to the previous list before the increment starts.
+	 */
+	void markSnapshotSet(MM_EnvironmentBase *env);
+
+	/**
+	 * Scan objects from the work stack until it is empty or the deadline is reached.
+	 * Unlike completeScan() this is not a joining scan, and overflow is left to the increment which completes the mark.
+	 * @param[in] env the scanning thread
+	 * @param[in] deadline hires clock value at which to stop scanning
+	 * @return true if the work stack of the thread was emptied before the deadline
+	 */
+	bool scanIncrement(MM_EnvironmentBase *env, uint64_t deadline);
+
+	MMINLINE void setYoungCollection(bool youngCollection) { _youngCollection = youngCollection; }
+	MMINLINE bool isYoungCollection() { return _youngCollection; }
+
+	/**
+	 * @return true if the remembered set overflowed since the last collection, in which case the next
+	 * collection has to be a full collection
+	 */
+	MMINLINE bool isRememberedSetOverflow() { return _rememberedSetOverflow; }
+
+	MMINLINE void
+	setIncrementalMarkActive(bool active)
+	{
+		_snapshotOverflow = false;
+		_incrementalMarkActive = active;
+	}
+	MMINLINE bool isIncrementalMarkActive() { return _incrementalMarkActive; }
+
+	/**
+	 * @return true if an overwritten reference was lost by the snapshot barrier, in which case the incremental
+	 * mark can not be completed and the collection has to mark from scratch
+	 */
+	MMINLINE bool isSnapshotOverflow() { return _snapshotOverflow; }
+
+	/**
+	 * Snapshot-at-the-beginning write barrier.  Record the reference held by a slot which is about to be
+	 * overwritten while the incremental mark is active, so the object it refers to is marked by the next increment.
+	 * @param[in] env the thread making the assignment
+	 * @param[in] oldObjectPtr the reference about to be overwritten
+	 */
+	MMINLINE void
+	snapshotObject(MM_EnvironmentBase *env, omrobjectptr_t oldObjectPtr)
+	{
+		if ((NULL != oldObjectPtr) && _incrementalMarkActive && !_markMap->isBitSet(oldObjectPtr)) {
+			MM_SublistFragment fragment(&env->_segregatedRememberedSet);
+			if (!fragment.add(env, (uintptr_t)oldObjectPtr)) {
+				/* the reference is lost - the collection which completes the cycle marks from scratch */
+				_snapshotOverflow = true;
+			}
+		}
+	}
+
+	/**
+	 * Generational write barrier.  Remember an old (marked) parent which is assigned a reference to a young
+	 * (unmarked) child, so the child is found by the next young collection.
+	 * @param[in] env the thread making the assignment
+	 * @param[in] parentPtr the parent object
+	 * @param[in] childPtr the child object reference
+	 */
+	MMINLINE void
+	rememberObject(MM_EnvironmentBase *env, omrobjectptr_t parentPtr, omrobjectptr_t childPtr)
+	{
+		if ((NULL != childPtr) && _markMap->isBitSet(parentPtr) && !_markMap->isBitSet(childPtr)) {
+			if (_extensions->objectModel.atomicSetRememberedState(parentPtr, STATE_REMEMBERED)) {
+				MM_SublistFragment fragment(&env->_segregatedRememberedSet);
+				if (!fragment.add(env, (uintptr_t)parentPtr)) {
+					/* the parent could not be remembered - it is not scanned until the next full collection */
+					_extensions->objectModel.clearRemembered(parentPtr);
+					_rememberedSetOverflow = true;
+				}
+			}
+		}
+	}
 	
 	MMINLINE void
 	preMarkSmallCells(MM_EnvironmentBase* env, MM_HeapRegionDescriptorSegregated *containingRegion, uintptr_t *cellList, uintptr_t preAllocatedBytes)
@@ -83,6 +190,10 @@ protected:
 	 */
 	MM_SegregatedMarkingScheme(MM_EnvironmentBase *env)
 		: MM_MarkingScheme(env)
+		, _youngCollection(false)
+		, _rememberedSetOverflow(false)
+		, _incrementalMarkActive(false)
+		, _snapshotOverflow(false)
 	{
 		_typeId = __FUNCTION__;
 	}
@@ -21,7 +21,16 @@
  *******************************************************************************/
 #include "SizeClasses.hpp"
 
+#include <string.h>
+
+#include "omrport.h"
+
+#include "AtomicOperations.hpp"
 #include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/* Largest size class table file which is read at startup */
+#define SIZECLASSES_FILE_BUFFER_SIZE 1024
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
@@ -56,12 +65,25 @@ MM_SizeClasses::kill(MM_EnvironmentBase *env)
 bool
 MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 {
+	MM_GCExtensionsBase *extensions = env->getExtensions();
 	OMR_SizeClasses* sizeClasses = env->getOmrVM()->_sizeClasses;
 	_smallCellSizes = sizeClasses->smallCellSizes;
 	_smallNumCells = sizeClasses->smallNumCells;
 	_sizeClassIndex = sizeClasses->sizeClassIndex;
 	
-	memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	/* a table tuned by an earlier profiling run replaces the initial size classes */
+	if ((NULL == extensions->sizeClassesFile) || !loadCellSizes(env->getPortLibrary(), extensions->sizeClassesFile, _smallCellSizes)) {
+		memcpy(_smallCellSizes, initialCellSizes, sizeof(initialCellSizes));
+	}
+
+	if (extensions->sizeClassProfiling) {
+		uintptr_t histogramBytes = sizeof(uintptr_t) * OMR_SIZECLASSES_HISTOGRAM_SIZE;
+		_allocationHistogram = (volatile uintptr_t *)env->getForge()->allocate(histogramBytes, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+		if (NULL == _allocationHistogram) {
+			return false;
+		}
+		memset((void *)_allocationHistogram, 0, histogramBytes);
+	}
 	
 	_sizeClassIndex[0] = 0;
 	_smallNumCells[0] = 0;
@@ -79,7 +101,236 @@ MM_SizeClasses::initialize(MM_EnvironmentBase *env)
 void
 MM_SizeClasses::tearDown(MM_EnvironmentBase *envModron)
 {
-	
+	if (NULL != _allocationHistogram) {
+		reportTunedSizeClasses(envModron);
+		envModron->getForge()->free((void *)_allocationHistogram);
+		_allocationHistogram = NULL;
+	}
+}
+
+void
+MM_SizeClasses::flushAllocationHistogram(MM_EnvironmentBase *env, uintptr_t *histogram)
+{
+	if (NULL != _allocationHistogram) {
+		for (uintptr_t i = 0; i < OMR_SIZECLASSES_HISTOGRAM_SIZE; i++) {
+			if (0 != histogram[i]) {
+				MM_AtomicOperations::add(&_allocationHistogram[i], histogram[i]);
+				histogram[i] = 0;
+			}
+		}
+	}
+}
+
+bool
+MM_SizeClasses::computeTunedCellSizes(MM_Forge *forge, const uintptr_t *histogram, uintptr_t classCount, uintptr_t *cellSizes)
+{
+	/* Dynamic programming over the class boundaries (in granules): cost[k][b] is the least internal fragmentation of the
+	 * allocations up to b granules with k classes, the largest of which has cells of b granules.  A class with cells of
+	 * b granules which follows a class of a granules wastes (b - i) granules for each allocation of i granules in (a, b].
+	 */
+	const uintptr_t granuleCount = OMR_SIZECLASSES_HISTOGRAM_SIZE - 1;
+	const uintptr_t smallestCell = (1 << OMR_SIZECLASSES_LOG_SMALLEST) / OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+	classCount = OMR_MIN(OMR_MAX(classCount, 1), OMR_SIZECLASSES_NUM_SMALL);
+	classCount = OMR_MIN(classCount, granuleCount - smallestCell + 1);
+
+	uintptr_t rowSize = OMR_SIZECLASSES_HISTOGRAM_SIZE;
+	uintptr_t workBytes = ((2 * sizeof(uint64_t)) + (classCount * (sizeof(uint64_t) + sizeof(uintptr_t)))) * rowSize;
+	uint8_t *work = (uint8_t *)forge->allocate(workBytes, OMR::GC::AllocationCategory::DIAGNOSTIC, OMR_GET_CALLSITE());
+	if (NULL == work) {
+		return false;
+	}
+	uint64_t *countPrefix = (uint64_t *)work;
+	uint64_t *granulePrefix = countPrefix + rowSize;
+	uint64_t *cost = granulePrefix + rowSize;
+	uintptr_t *previousBoundary = (uintptr_t *)(cost + classCount * rowSize);
+
+	countPrefix[0] = histogram[0];
+	granulePrefix[0] = 0;
+	for (uintptr_t i = 1; i <= granuleCount; i++) {
+		countPrefix[i] = countPrefix[i - 1] + histogram[i];
+		granulePrefix[i] = granulePrefix[i - 1] + ((uint64_t)histogram[i] * i);
+	}
+
+	/* the first class also holds the (empty) zero granule entry, so it covers [0, b] */
+	for (uintptr_t b = smallestCell; b <= granuleCount; b++) {
+		cost[b] = (countPrefix[b] * b) - granulePrefix[b];
+		previousBoundary[b] = 0;
+	}
+	for (uintptr_t k = 1; k < classCount; k++) {
+		uint64_t *row = cost + (k * rowSize);
+		uint64_t *previousRow = row - rowSize;
+		uintptr_t *boundaryRow = previousBoundary + (k * rowSize);
+		for (uintptr_t b = smallestCell + k; b <= granuleCount; b++) {
+			uint64_t best = (uint64_t)-1;
+			uintptr_t bestBoundary = 0;
+			for (uintptr_t a = smallestCell + k - 1; a < b; a++) {
+				uint64_t candidate = previousRow[a] + ((countPrefix[b] - countPrefix[a]) * b) - (granulePrefix[b] - granulePrefix[a]);
+				if (candidate < best) {
+					best = candidate;
+					bestBoundary = a;
+				}
+			}
+			row[b] = best;
+			boundaryRow[b] = bestBoundary;
+		}
+	}
+
+	/* walk the boundaries back from the largest class, which always has the largest small cell size */
+	uintptr_t boundary = granuleCount;
+	for (uintptr_t k = classCount; k > 0; k--) {
+		cellSizes[OMR_SIZECLASSES_NUM_SMALL - (classCount - k)] = boundary * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		boundary = previousBoundary[((k - 1) * rowSize) + boundary];
+	}
+	for (uintptr_t szClass = OMR_SIZECLASSES_NUM_SMALL - classCount; szClass >= OMR_SIZECLASSES_MIN_SMALL; szClass--) {
+		cellSizes[szClass] = cellSizes[OMR_SIZECLASSES_NUM_SMALL - classCount + 1];
+	}
+	cellSizes[0] = 0;
+
+	forge->free(work);
+	return true;
+}
+
+uint64_t
+MM_SizeClasses::getInternalFragmentation(const uintptr_t *histogram, const uintptr_t *cellSizes)
+{
+	uint64_t wastedBytes = 0;
+	uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL;
+	for (uintptr_t i = 1; i < OMR_SIZECLASSES_HISTOGRAM_SIZE; i++) {
+		uintptr_t sizeInBytes = i * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		while (cellSizes[szClass] < sizeInBytes) {
+			szClass += 1;
+		}
+		wastedBytes += (uint64_t)histogram[i] * (cellSizes[szClass] - sizeInBytes);
+	}
+	return wastedBytes;
+}
+
+bool
+MM_SizeClasses::isValidCellSizes(const uintptr_t *cellSizes)
+{
+	bool valid = (0 == cellSizes[0])
+			&& (cellSizes[OMR_SIZECLASSES_MIN_SMALL] >= (1 << OMR_SIZECLASSES_LOG_SMALLEST))
+			&& (OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES == cellSizes[OMR_SIZECLASSES_MAX_SMALL]);
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; valid && (szClass <= OMR_SIZECLASSES_MAX_SMALL); szClass++) {
+		valid = (0 == (cellSizes[szClass] % OMR_SIZECLASSES_HISTOGRAM_GRANULE)) && (cellSizes[szClass] >= cellSizes[szClass - 1]);
+	}
+	return valid;
+}
+
+void
+MM_SizeClasses::formatCellSizes(OMRPortLibrary *portLibrary, const uintptr_t *cellSizes, char *buffer, uintptr_t bufferSize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	uintptr_t used = omrstr_printf(buffer, bufferSize, "{ 0");
+	for (uintptr_t szClass = OMR_SIZECLASSES_MIN_SMALL; szClass <= OMR_SIZECLASSES_MAX_SMALL; szClass++) {
+		used += omrstr_printf(buffer + used, bufferSize - used, ", %zu", (size_t)cellSizes[szClass]);
+	}
+	omrstr_printf(buffer + used, bufferSize - used, " }");
+}
+
+bool
+MM_SizeClasses::storeCellSizes(OMRPortLibrary *portLibrary, const char *fileName, const uintptr_t *cellSizes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char formatted[SIZECLASSES_FILE_BUFFER_SIZE];
+	formatCellSizes(portLibrary, cellSizes, formatted, sizeof(formatted));
+
+	intptr_t fd = omrfile_open(fileName, EsOpenWrite | EsOpenCreate | EsOpenTruncate, 0666);
+	if (-1 == fd) {
+		return false;
+	}
+	omrfile_printf(fd, "%s\n", formatted);
+	omrfile_close(fd);
+	return true;
+}
+
+bool
+MM_SizeClasses::loadCellSizes(OMRPortLibrary *portLibrary, const char *fileName, uintptr_t *cellSizes)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	char buffer[SIZECLASSES_FILE_BUFFER_SIZE];
+	intptr_t bytesRead = -1;
+
+	intptr_t fd = omrfile_open(fileName, EsOpenRead, 0);
+	if (-1 == fd) {
+		/* nothing was written by an earlier run yet */
+		return false;
+	}
+	bytesRead = omrfile_read(fd, buffer, sizeof(buffer) - 1);
+	omrfile_close(fd);
+
+	uintptr_t table[OMR_SIZECLASSES_NUM_SMALL + 1];
+	uintptr_t count = 0;
+	bool valid = (bytesRead > 0);
+	if (valid) {
+		buffer[bytesRead] = '\0';
+		/* the table is written in the format of SMALL_SIZECLASSES: a brace enclosed, comma separated list */
+		for (char *cursor = buffer; valid && ('\0' != *cursor);) {
+			if ((*cursor >= '0') && (*cursor <= '9')) {
+				uintptr_t value = 0;
+				while ((*cursor >= '0') && (*cursor <= '9')) {
+					value = (value * 10) + (uintptr_t)(*cursor - '0');
+					cursor += 1;
+				}
+				valid = (count <= OMR_SIZECLASSES_NUM_SMALL);
+				if (valid) {
+					table[count] = value;
+					count += 1;
+				}
+			} else {
+				cursor += 1;
+			}
+		}
+	}
+	valid = valid && ((OMR_SIZECLASSES_NUM_SMALL + 1) == count) && isValidCellSizes(table);
+	if (valid) {
+		memcpy(cellSizes, table, sizeof(table));
+	} else {
+		omrtty_printf("Ignoring size class table in %s: expected %zu cell sizes in the format of SMALL_SIZECLASSES\n", fileName, (size_t)(OMR_SIZECLASSES_NUM_SMALL + 1));
+	}
+	return valid;
+}
+
+void
+MM_SizeClasses::reportTunedSizeClasses(MM_EnvironmentBase *env)
+{
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	const uintptr_t *histogram = (const uintptr_t *)_allocationHistogram;
+
+	uint64_t allocationCount = 0;
+	uint64_t bytesRequested = 0;
+	for (uintptr_t i = 1; i < OMR_SIZECLASSES_HISTOGRAM_SIZE; i++) {
+		allocationCount += histogram[i];
+		bytesRequested += (uint64_t)histogram[i] * i * OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+	}
+
+	uintptr_t classCount = extensions->sizeClassProfilingTargetCount;
+	if (0 == classCount) {
+		classCount = OMR_SIZECLASSES_NUM_SMALL;
+	}
+	uintptr_t tunedCellSizes[OMR_SIZECLASSES_NUM_SMALL + 1];
+	if ((0 == allocationCount) || !computeTunedCellSizes(env->getForge(), histogram, classCount, tunedCellSizes)) {
+		omrtty_printf("Size class profiling: no size class table computed (%llu small allocations recorded)\n", allocationCount);
+		return;
+	}
+
+	const uintptr_t *tables[] = { _smallCellSizes, tunedCellSizes };
+	const char *names[] = { "current", "tuned" };
+	char formatted[2][SIZECLASSES_FILE_BUFFER_SIZE];
+	omrtty_printf("Size class profiling: %llu small allocations, %llu bytes requested\n", allocationCount, bytesRequested);
+	for (uintptr_t t = 0; t < 2; t++) {
+		formatCellSizes(env->getPortLibrary(), tables[t], formatted[t], sizeof(formatted[t]));
+
+		/* internal fragmentation as a share of the bytes taken by the cells, in hundredths of a percent */
+		uint64_t wastedBytes = getInternalFragmentation(histogram, tables[t]);
+		uint64_t share = (wastedBytes * 10000) / (bytesRequested + wastedBytes);
+		omrtty_printf("  %s size classes %s: internal fragmentation %llu bytes (%llu.%02.2llu%%)\n", names[t], formatted[t], wastedBytes, share / 100, share % 100);
+	}
+
+	if ((NULL != extensions->sizeClassesFile) && !storeCellSizes(env->getPortLibrary(), extensions->sizeClassesFile, tunedCellSizes)) {
+		omrtty_printf("Size class profiling: unable to write %s\n", extensions->sizeClassesFile);
+	}
 }
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
@@ -28,9 +28,15 @@
 
 #include "BaseVirtual.hpp"
 #include "Debug.hpp"
+#include "Forge.hpp"
 
 #if defined(OMR_GC_SEGREGATED_HEAP)
 
+/* Granularity (in bytes) of the allocation size histogram, and of the cell sizes of a tuned size class table */
+#define OMR_SIZECLASSES_HISTOGRAM_GRANULE 8
+/* Number of entries of the allocation size histogram (entry i counts allocations of i granules) */
+#define OMR_SIZECLASSES_HISTOGRAM_SIZE ((OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES / OMR_SIZECLASSES_HISTOGRAM_GRANULE) + 1)
+
 class MM_EnvironmentBase;
 
 class MM_SizeClasses : public MM_BaseVirtual
@@ -42,11 +48,76 @@ private:
 	uintptr_t* _smallCellSizes; /**< Array mapping size classes to the cell size of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _smallNumCells; /**< Array mapping size classes to the number of cells on a region of that size class. The array actually lives in the J9JavaVM. */
 	uintptr_t* _sizeClassIndex; /**< maps size request to size classes. The array actually lives in the OMR vm. */
+	volatile uintptr_t* _allocationHistogram; /**< Number of small allocations per size (in granules) flushed from the allocation trackers, NULL unless sizeClassProfiling is enabled */
 	
 /* Methods */
 public:
 	static MM_SizeClasses* newInstance(MM_EnvironmentBase* env);
 	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * @return the allocation size histogram entry which counts allocations of the given size
+	 */
+	MMINLINE static uintptr_t getHistogramIndex(uintptr_t sizeInBytes)
+	{
+		uintptr_t index = (sizeInBytes + OMR_SIZECLASSES_HISTOGRAM_GRANULE - 1) / OMR_SIZECLASSES_HISTOGRAM_GRANULE;
+		/* a zero sized allocation takes the smallest cell like any other */
+		return OMR_MAX(index, 1);
+	}
+
+	/**
+	 * Add the counts of a thread local allocation size histogram to the global histogram, and reset them.
+	 * @param[in/out] histogram thread local histogram of OMR_SIZECLASSES_HISTOGRAM_SIZE entries
+	 */
+	void flushAllocationHistogram(MM_EnvironmentBase *env, uintptr_t *histogram);
+
+	/**
+	 * Compute the size class table which minimizes the internal fragmentation (bytes wasted between the end of
+	 * an object and the end of its cell) of the allocations counted in the histogram.
+	 * Cell sizes are multiples of OMR_SIZECLASSES_HISTOGRAM_GRANULE and the largest class is always
+	 * OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES.  When fewer than OMR_SIZECLASSES_NUM_SMALL classes are requested
+	 * the unused leading entries of the table repeat the smallest cell size (a size class which is never selected).
+	 * @param[in] forge allocates the work space
+	 * @param[in] histogram allocation size histogram of OMR_SIZECLASSES_HISTOGRAM_SIZE entries
+	 * @param[in] classCount number of distinct size classes, at most OMR_SIZECLASSES_NUM_SMALL
+	 * @param[out] cellSizes the table, OMR_SIZECLASSES_NUM_SMALL + 1 entries (entry 0 is unused)
+	 * @return true if the table was computed, false on failure to allocate work space
+	 */
+	static bool computeTunedCellSizes(MM_Forge *forge, const uintptr_t *histogram, uintptr_t classCount, uintptr_t *cellSizes);
+
+	/**
+	 * @param[in] histogram allocation size histogram of OMR_SIZECLASSES_HISTOGRAM_SIZE entries
+	 * @param[in] cellSizes size class table of OMR_SIZECLASSES_NUM_SMALL + 1 entries
+	 * @return the bytes wasted at the end of the cells holding the allocations counted in the histogram
+	 */
+	static uint64_t getInternalFragmentation(const uintptr_t *histogram, const uintptr_t *cellSizes);
+
+	/**
+	 * @return true if the table can be used as a size class table: cell sizes are granule multiples, non decreasing,
+	 * at least (1 << OMR_SIZECLASSES_LOG_SMALLEST) and the largest is OMR_SIZECLASSES_MAX_SMALL_SIZE_BYTES
+	 */
+	static bool isValidCellSizes(const uintptr_t *cellSizes);
+
+	/**
+	 * Write a size class table in the format of SMALL_SIZECLASSES (a brace enclosed, comma separated list).
+	 * @param[in] cellSizes size class table of OMR_SIZECLASSES_NUM_SMALL + 1 entries
+	 * @param[out] buffer receives the NUL terminated text, truncated to bufferSize
+	 */
+	static void formatCellSizes(OMRPortLibrary *portLibrary, const uintptr_t *cellSizes, char *buffer, uintptr_t bufferSize);
+
+	/**
+	 * Write a size class table to a file, for loadCellSizes() to read at the next startup.
+	 * @return true if the file was written
+	 */
+	static bool storeCellSizes(OMRPortLibrary *portLibrary, const char *fileName, const uintptr_t *cellSizes);
+
+	/**
+	 * Read a size class table written by storeCellSizes(), such as the one a previous run with sizeClassProfiling
+	 * enabled left in sizeClassesFile.  A file which does not hold a valid table is reported and ignored.
+	 * @param[out] cellSizes the table, OMR_SIZECLASSES_NUM_SMALL + 1 entries, unchanged unless a valid table was read
+	 * @return true if a valid table was read
+	 */
+	static bool loadCellSizes(OMRPortLibrary *portLibrary, const char *fileName, uintptr_t *cellSizes);
 	
 	MMINLINE uintptr_t getCellSize(uintptr_t sizeClass) const
 	{
@@ -77,11 +148,20 @@ protected:
 	bool initialize(MM_EnvironmentBase *env);
 	virtual void tearDown(MM_EnvironmentBase *env);
 	MM_SizeClasses(MM_EnvironmentBase* env)
+		: _smallCellSizes(NULL)
+		, _smallNumCells(NULL)
+		, _sizeClassIndex(NULL)
+		, _allocationHistogram(NULL)
 	{
 		_typeId = __FUNCTION__;
 	};
 	
 private:
+	/**
+	 * Report the internal fragmentation of the recorded allocations with the current size class table and with the
+	 * table tuned to them, and write the tuned table to sizeClassesFile (if any) for use at the next startup.
+	 */
+	void reportTunedSizeClasses(MM_EnvironmentBase *env);
 };
 
 #endif /* OMR_GC_SEGREGATED_HEAP */
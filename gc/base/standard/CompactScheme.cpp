@@ -356,6 +356,13 @@ MM_CompactScheme::masterSetupForGC(MM_EnvironmentStandard *env)
 	_compactTable = (CompactTableEntry*)_markingScheme->getMarkMap()->getMarkBits();
 	_subAreaTable = (SubAreaEntry*)_extensions->sweepHeapSectioning->getBackingStoreAddress();
 	_subAreaTableSize = _extensions->sweepHeapSectioning->getBackingStoreSize();
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* objects may grow when moved, the objects packed below a pinned object could overlap it */
+	_pinnedObjectMinimumSize = 0;
+#else /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+	/* an object of a page or more is the last object starting on its page */
+	_pinnedObjectMinimumSize = (0 == _extensions->largeObjectPinnedSize) ? 0 : OMR_MAX(_extensions->largeObjectPinnedSize, (uintptr_t)sizeof_page);
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
 	_delegate.masterSetupForGC(env);
 }
 
@@ -430,12 +437,14 @@ MM_CompactScheme::createSubAreaTable(MM_EnvironmentStandard *env, bool singleThr
 				_subAreaTable[i].freeChunk = (omrobjectptr_t)p;
 				_subAreaTable[i].memoryPool = memorySubSpace->getMemoryPool(p);
 				_subAreaTable[i].state = state;
+				_subAreaTable[i].pinnedObjects = 0;
 				_subAreaTable[i++].currentAction = SubAreaEntry::none;
 			}
 			_subAreaTable[i].freeChunk = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].memoryPool = NULL;
 			_subAreaTable[i].firstObject = (omrobjectptr_t)highAddress;
 			_subAreaTable[i].state = SubAreaEntry::end_segment;
+			_subAreaTable[i].pinnedObjects = 0;
 			_subAreaTable[i++].currentAction = SubAreaEntry::none;
 		}
 		_subAreaTable[i].state = SubAreaEntry::end_heap;
@@ -493,6 +502,7 @@ MM_CompactScheme::removeNullSubAreas(MM_EnvironmentStandard *env)
 					_compactTo = (_compactTo > _subAreaTable[j].firstObject) ? _compactTo : _subAreaTable[j].firstObject;
 				}
 				_subAreaTable[j].freeChunk = 0;
+				_subAreaTable[j].pinnedObjects = 0;
 				j++;
 			}
 		}
@@ -563,6 +573,16 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 		singleThreaded = true;
 	}
 
+#if defined(OMR_GC_DEFERRED_HASHCODE_INSERTION)
+	/* objects may grow when moved, so destinations can not be planned from their current sizes */
+	bool planMoves = false;
+#else /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+	/* a single sub area per segment is already slid in one piece, there is nothing to plan, and planned
+	 * moves pack each segment from its base, which pinned objects do not allow
+	 */
+	bool planMoves = !singleThreaded && _extensions->compactUsingMovePlan && (0 == _extensions->largeObjectPinnedSize);
+#endif /* defined(OMR_GC_DEFERRED_HASHCODE_INSERTION) */
+
 	env->_compactStats._setupStartTime = omrtime_hires_clock();
 	workerSetupForGC(env, singleThreaded);
 	env->_compactStats._setupEndTime = omrtime_hires_clock();
@@ -571,9 +591,19 @@ MM_CompactScheme::compact(MM_EnvironmentBase *envBase, bool rebuildMarkBits, boo
 	 * to ensure all events issued on master thread.
 	 */
 	if (!singleThreaded || env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
-		env->_compactStats._moveStartTime = omrtime_hires_clock();
-		moveObjects(env, objectCount, byteCount, skippedObjectCount);
-		env->_compactStats._moveEndTime = omrtime_hires_clock();
+		if (planMoves) {
+			env->_compactStats._summaryStartTime = omrtime_hires_clock();
+			summarizeSubAreas(env);
+			env->_compactStats._summaryEndTime = omrtime_hires_clock();
+
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjectsPlanned(env, objectCount, byteCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+		} else {
+			env->_compactStats._moveStartTime = omrtime_hires_clock();
+			moveObjects(env, objectCount, byteCount, skippedObjectCount);
+			env->_compactStats._moveEndTime = omrtime_hires_clock();
+		}
 
 		if (!singleThreaded) {
 			env->_currentTask->synchronizeGCThreads(env, UNIQUE_ID);
@@ -674,7 +704,9 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 					}
 				} else {
 					/* There is some free area in the sub area but not all of it */
-					if (NULL != currentFreeBase) {
+					if (0 != subAreaTable[i].pinnedObjects) {
+						addPinnedGapFreeEntries(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i].freeChunk, currentFreeBase);
+					} else if (NULL != currentFreeBase) {
 						currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
 #if defined(DEBUG_PAINT_FREE)
@@ -689,7 +721,9 @@ void MM_CompactScheme::rebuildFreelist(MM_EnvironmentStandard *env)
 				/* Either there is no free area in the sub area or sub area is
 				 * a fixup_only sub area, i.e. IC is active
 				 */
-				if (NULL != currentFreeBase) {
+				if (0 != subAreaTable[i].pinnedObjects) {
+					addPinnedGapFreeEntries(env, memorySubSpace, poolState, subAreaTable[i].firstObject, subAreaTable[i + 1].firstObject, currentFreeBase);
+				} else if (NULL != currentFreeBase) {
 					currentFreeSize = (uintptr_t)subAreaTable[i].firstObject - (uintptr_t)currentFreeBase;
 
 #if defined(DEBUG_PAINT_FREE)
@@ -801,6 +835,23 @@ MM_CompactScheme::addFreeEntry(MM_EnvironmentStandard *env, MM_MemorySubSpace *m
 	}
 }
 
+void
+MM_CompactScheme::addPinnedGapFreeEntries(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, MM_CompactMemoryPoolState *poolState, omrobjectptr_t start, omrobjectptr_t end, void *&currentFreeBase)
+{
+	GC_ObjectHeapIteratorAddressOrderedList objectIterator(_extensions, start, end, true);
+	omrobjectptr_t objectPtr = NULL;
+	while (NULL != (objectPtr = objectIterator.nextObject())) {
+		if (objectIterator.isDeadObject()) {
+			if (NULL == currentFreeBase) {
+				currentFreeBase = (void *)objectPtr;
+			}
+		} else if (NULL != currentFreeBase) {
+			addFreeEntry(env, memorySubSpace, poolState, currentFreeBase, (uintptr_t)objectPtr - (uintptr_t)currentFreeBase);
+			currentFreeBase = NULL;
+		}
+	}
+	currentFreeBase = NULL;
+}
 
 void
 MM_CompactScheme::moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &skippedObjectCount)
@@ -826,6 +877,238 @@ MM_CompactScheme::moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCoun
 	}
 }
 
+void
+MM_CompactScheme::summarizeSubAreas(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	/* The mark map has to be read in full before the first forwarding pointer overwrites it */
+	while(NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::summarizing)) {
+				omrobjectptr_t start = subAreaTable[i].firstObject;
+				omrobjectptr_t end = pageStart(pageIndex(subAreaTable[i + 1].firstObject));
+				MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)start, (uintptr_t *)end);
+				omrobjectptr_t objectPtr = NULL;
+				uintptr_t liveBytes = 0;
+				while (NULL != (objectPtr = markedObjectIterator.nextObject())) {
+					liveBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeaderForMove(objectPtr);
+				}
+				subAreaTable[i].liveBytes = liveBytes;
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		planSubAreaMoves(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_CompactScheme::planSubAreaMoves(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while(NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		/* Live data of the segment ends up contiguous from its base, in address order */
+		omrobjectptr_t destination = subAreaTable[0].firstObject;
+		intptr_t dependency = 0;
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			/* the first subarea whose range ends above the destination is the lowest one still in the way */
+			while (subAreaTable[dependency + 1].firstObject <= destination) {
+				dependency += 1;
+			}
+			Assert_MM_true(dependency <= i);
+			subAreaTable[i].destination = destination;
+			subAreaTable[i].dependency = dependency;
+			subAreaTable[i].destinationBoundary = NULL;
+			destination = (omrobjectptr_t)((uintptr_t)destination + subAreaTable[i].liveBytes);
+		}
+		/* the end_segment records the end of the live data in the segment */
+		subAreaTable[i].destination = destination;
+		subAreaTable += (i+1);
+	}
+}
+
+void
+MM_CompactScheme::moveObjectsPlanned(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	SubAreaEntry *subAreaTable = _subAreaTable;
+
+	while(NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		intptr_t i;
+		for (i = 0; subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			/* Subareas are claimed in address order, so every lower subarea has an owner that will finish it */
+			if (changeSubAreaAction(env, &subAreaTable[i], SubAreaEntry::sliding)) {
+				for (intptr_t j = subAreaTable[i].dependency; j < i; j++) {
+					while (SubAreaEntry::init == subAreaTable[j].state) {
+						MM_AtomicOperations::yieldCPU();
+					}
+				}
+				MM_AtomicOperations::loadSync();
+
+				slideSubArea(env, subAreaTable, i, objectCount, byteCount);
+
+				MM_AtomicOperations::storeSync();
+				uintptr_t state = MM_AtomicOperations::lockCompareExchange(&subAreaTable[i].state, SubAreaEntry::init, SubAreaEntry::full);
+				Assert_MM_true(state == SubAreaEntry::init);
+			}
+		}
+		/* Number of regions in regionTable, including
+		 * the end_segment region, is i+1 */
+		subAreaTable += (i+1);
+	}
+
+	if (env->_currentTask->synchronizeGCThreadsAndReleaseMaster(env, UNIQUE_ID)) {
+		completePlannedSubAreaTable(env);
+		env->_currentTask->releaseSynchronizedGCThreads(env);
+	}
+}
+
+void
+MM_CompactScheme::slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount)
+{
+	omrobjectptr_t destination = subAreaTable[i].destination;
+	omrobjectptr_t end = pageStart(pageIndex(subAreaTable[i + 1].firstObject));
+
+	/* The compacted subarea table must not split a page between two subareas (see completePlannedSubAreaTable) */
+	omrobjectptr_t pageBoundary = pageStart(pageIndex(destination));
+	if (pageBoundary != destination) {
+		pageBoundary = nextPage(destination);
+	}
+	omrobjectptr_t destinationBoundary = NULL;
+
+	MM_HeapMapIterator markedObjectIterator(_extensions, _markMap, (uintptr_t *)subAreaTable[i].firstObject, (uintptr_t *)end);
+	omrobjectptr_t objectPtr = NULL;
+	omrobjectptr_t nextObject = NULL;
+	intptr_t page = -1; /* invalid value */
+	intptr_t counter = 0; /* obj on page, first is zero */
+	CompactTableEntry entry;
+	for (objectPtr = markedObjectIterator.nextObject(); NULL != objectPtr; objectPtr = nextObject) {
+		/* the object may be overwritten by its own move, step the iterator first */
+		nextObject = markedObjectIterator.nextObject();
+
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(objectPtr);
+		Assert_MM_true(destination <= objectPtr);
+
+		if ((NULL == destinationBoundary) && (destination >= pageBoundary)) {
+			destinationBoundary = destination;
+		}
+
+		/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+		saveForwardingPtr(entry, objectPtr, destination, page, counter);
+
+		if (destination != objectPtr) {
+			memmove(destination, objectPtr, objectSize);
+			objectCount += 1;
+			byteCount += objectSize;
+		}
+		destination = (omrobjectptr_t)((uintptr_t)destination + objectSize);
+	}
+
+	if (page != -1) {
+		_compactTable[page] = entry;
+	}
+
+	Assert_MM_true(destination == (omrobjectptr_t)((uintptr_t)subAreaTable[i].destination + subAreaTable[i].liveBytes));
+	subAreaTable[i].destinationBoundary = destinationBoundary;
+}
+
+void
+MM_CompactScheme::completePlannedSubAreaTable(MM_EnvironmentStandard *env)
+{
+	MM_HeapRegionManager *regionManager = _heap->getHeapRegionManager();
+	GC_HeapRegionIteratorStandard regionIterator(regionManager);
+	MM_HeapRegionDescriptorStandard *region = NULL;
+	uintptr_t i = 0;
+	uintptr_t j = 0;
+
+	/* Single threaded pass rewriting the table in place (j <= i). Each segment now holds its live
+	 * objects contiguously from its base followed by one free range. The new subareas start at the
+	 * first object of a page, like the ones built by setRealLimitsSubAreas, so that rebuilding the
+	 * mark bits never splits a page between two threads.
+	 */
+	while(NULL != (region = regionIterator.nextRegion())) {
+		if (!region->isCommitted() || (0 == region->getSize())) {
+			continue;
+		}
+		MM_MemorySubSpace *memorySubSpace = region->getSubSpace();
+		uintptr_t segmentStart = j;
+
+		/* the first sub area still starts at the base of the segment */
+		_subAreaTable[j].firstObject = _subAreaTable[i].firstObject;
+		_subAreaTable[j].memoryPool = _subAreaTable[i].memoryPool;
+		_subAreaTable[j].state = SubAreaEntry::full;
+		_subAreaTable[j].currentAction = SubAreaEntry::none;
+		i += 1;
+		j += 1;
+
+		for (; _subAreaTable[i].state != SubAreaEntry::end_segment; i++) {
+			omrobjectptr_t destinationBoundary = _subAreaTable[i].destinationBoundary;
+			if ((NULL != destinationBoundary) && (destinationBoundary > _subAreaTable[j - 1].firstObject)) {
+				_subAreaTable[j].firstObject = destinationBoundary;
+				_subAreaTable[j].memoryPool = memorySubSpace->getMemoryPool(destinationBoundary);
+				_subAreaTable[j].state = SubAreaEntry::full;
+				_subAreaTable[j].currentAction = SubAreaEntry::none;
+				j += 1;
+			}
+		}
+
+		omrobjectptr_t segmentTop = _subAreaTable[i].firstObject;
+		omrobjectptr_t liveEnd = _subAreaTable[i].destination;
+		_subAreaTable[j].firstObject = segmentTop;
+		_subAreaTable[j].memoryPool = NULL;
+		_subAreaTable[j].freeChunk = NULL;
+		_subAreaTable[j].state = SubAreaEntry::end_segment;
+		_subAreaTable[j].currentAction = SubAreaEntry::none;
+
+		/* freeChunk follows the conventions of evacuateSubArea: NULL if the sub area is full,
+		 * firstObject if it is entirely free, otherwise the start of its free tail
+		 */
+		for (uintptr_t k = segmentStart; k < j; k++) {
+			if (liveEnd <= _subAreaTable[k].firstObject) {
+				_subAreaTable[k].freeChunk = _subAreaTable[k].firstObject;
+			} else if (liveEnd < _subAreaTable[k + 1].firstObject) {
+				_subAreaTable[k].freeChunk = liveEnd;
+			} else {
+				_subAreaTable[k].freeChunk = NULL;
+			}
+		}
+
+		/* make the rest of the segment walkable for fixup */
+		if (liveEnd < segmentTop) {
+			setFreeChunk(liveEnd, segmentTop);
+		}
+
+		i += 1;
+		j += 1;
+	}
+}
+
 /* Create two free chunks: the first is (from:to_aligned), and the second
  * is (to_aligned:to), where to_aligned=ALIGN(to,page_size). Return the size
  * of the FIRST chunk (if exists), or zero otherwise.
@@ -870,6 +1153,7 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
 	}
 	uintptr_t nobjects = 0;
 	uintptr_t nbytes = 0;
+	uintptr_t npinned = 0;
 	omrobjectptr_t freeChunk;
 	omrobjectptr_t firstObject = subAreaTableEvacuate[i].firstObject;
 	omrobjectptr_t endObject = subAreaTableEvacuate[i+1].firstObject;
@@ -895,7 +1179,7 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
         }
 
         nobjects = nbytes = 0;
-        objectPtr = doCompact(env, subspace, objectPtr, endObject, freeChunk, nobjects, nbytes, true);
+        objectPtr = doCompact(env, subspace, objectPtr, endObject, freeChunk, nobjects, nbytes, npinned, true);
 
         /* Free chunks initially get into the table after compaction,
          * so the problematic last page had already been truncated by now.
@@ -924,7 +1208,8 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
         	uintptr_t state = MM_AtomicOperations::lockCompareExchange(&subAreaTableEvacuate[j].state, SubAreaEntry::busy, SubAreaEntry::ready);
         	Assert_MM_true(state == SubAreaEntry::busy);
         }
-    } while (objectPtr);
+        /* no other free chunk can take a pinned object either */
+    } while ((NULL != objectPtr) && (NULL == getPinnedObject(objectPtr)));
 
 	if (objectPtr == 0) {
 		/* All objects in the sub area were successfully evacuated. */
@@ -1041,8 +1326,9 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
 		Assert_MM_true(_markMap->isBitSet(objectPtr));
 
 		nobjects = nbytes = 0;
-		doCompact(env, subspace, objectPtr, endObject, freeChunk, nobjects, nbytes, false);
+		doCompact(env, subspace, objectPtr, endObject, freeChunk, nobjects, nbytes, npinned, false);
 		Assert_MM_true(freeChunk);
+		subAreaTableEvacuate[i].pinnedObjects = npinned;
 		size_t size = setFreeChunkPageAligned(freeChunk, endObject);
 		if (size < minFreeChunk) {
 			subAreaTableEvacuate[i].freeChunk = 0;
@@ -1075,8 +1361,9 @@ MM_CompactScheme::evacuateSubArea(MM_EnvironmentStandard *env, MM_HeapRegionDesc
 	freeChunk = firstObject;
 	setFreeChunk(freeChunk, objectPtr);
 	nobjects = nbytes = 0;
-	doCompact(env, subspace, objectPtr, endObject, freeChunk, nobjects, nbytes, false);
+	doCompact(env, subspace, objectPtr, endObject, freeChunk, nobjects, nbytes, npinned, false);
 	Assert_MM_true(freeChunk);
+	subAreaTableEvacuate[i].pinnedObjects = npinned;
 	size_t size = setFreeChunkPageAligned(freeChunk, endObject);
 	if (size < minFreeChunk) {
 		subAreaTableEvacuate[i].freeChunk = 0;
@@ -1168,7 +1455,7 @@ MM_CompactScheme::saveForwardingPtr(CompactTableEntry &entry, omrobjectptr_t obj
  * Thread-safe -- does not modify global data, except markbits.
  */
 omrobjectptr_t
-MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, omrobjectptr_t start, omrobjectptr_t finish, omrobjectptr_t &deadObject, uintptr_t &nobjects, uintptr_t &nbytes, bool evacuate)
+MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memorySubSpace, omrobjectptr_t start, omrobjectptr_t finish, omrobjectptr_t &deadObject, uintptr_t &nobjects, uintptr_t &nbytes, uintptr_t &npinned, bool evacuate)
 {
 	/* we use the MM_HeapMapWordIterator in this function so ensure that it is safe (can't be tested during init since assertions don't work at that point) */
 	Assert_MM_true(0 == (sizeof_page % J9MODRON_HEAP_BYTES_PER_UDATA_OF_HEAP_MAP));
@@ -1190,6 +1477,23 @@ MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memo
 	for (objectPtr = markedObjectIterator.nextObject(); objectPtr != 0; objectPtr = nextObject) {
 		nextObject = markedObjectIterator.nextObject();
 
+		if (pageIndex(objectPtr) != page) {
+			omrobjectptr_t pinnedObject = getPinnedObject(objectPtr);
+			if (NULL != pinnedObject) {
+				if (evacuate) {
+					/* Pinned objects are never evacuated, the rest of the sub area slides around them */
+					break;
+				}
+				deadObject = slidePinnedPage(env, objectPtr, pinnedObject, deadObject, entry, page, counter, nobjects, nbytes);
+				npinned += 1;
+				/* all the objects of the page have been handled */
+				while ((NULL != nextObject) && (nextObject <= pinnedObject)) {
+					nextObject = markedObjectIterator.nextObject();
+				}
+				continue;
+			}
+		}
+
 		if (evacuate && (pageIndex(objectPtr) != page)) {
 			/* We should not start evacuating objects from a page unless we are
 			 * sure there is enough space for ALL of them.
@@ -1273,6 +1577,75 @@ MM_CompactScheme::doCompact(MM_EnvironmentStandard *env, MM_MemorySubSpace *memo
 	return objectPtr;
 }
 
+omrobjectptr_t
+MM_CompactScheme::getPinnedObject(omrobjectptr_t objectPtr)
+{
+	omrobjectptr_t pinnedObject = NULL;
+	if (0 != _pinnedObjectMinimumSize) {
+		MM_HeapMapIterator pageIterator(_extensions, _markMap, (uintptr_t *)objectPtr, (uintptr_t *)nextPage(objectPtr));
+		omrobjectptr_t lastObject = NULL;
+		omrobjectptr_t pageObject = NULL;
+		while (NULL != (pageObject = pageIterator.nextObject())) {
+			lastObject = pageObject;
+		}
+		if ((NULL != lastObject) && (_pinnedObjectMinimumSize <= _extensions->objectModel.getConsumedSizeInBytesWithHeader(lastObject))) {
+			pinnedObject = lastObject;
+		}
+	}
+	return pinnedObject;
+}
+
+omrobjectptr_t
+MM_CompactScheme::slidePinnedPage(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, omrobjectptr_t pinnedObject, omrobjectptr_t deadObject, CompactTableEntry &entry, intptr_t &page, intptr_t &counter, uintptr_t &nobjects, uintptr_t &nbytes)
+{
+	/* A page holds at most one marked object per compressed mark bit */
+	omrobjectptr_t packedObjects[maxOffset];
+	uintptr_t packedCount = 0;
+	uintptr_t packedBytes = 0;
+
+	MM_HeapMapIterator pageIterator(_extensions, _markMap, (uintptr_t *)objectPtr, (uintptr_t *)pinnedObject);
+	omrobjectptr_t packedObject = NULL;
+	while (NULL != (packedObject = pageIterator.nextObject())) {
+		Assert_MM_true(packedCount < (uintptr_t)maxOffset);
+		packedObjects[packedCount] = packedObject;
+		packedCount += 1;
+		packedBytes += _extensions->objectModel.getConsumedSizeInBytesWithHeader(packedObject);
+	}
+
+	omrobjectptr_t packedBase = (omrobjectptr_t)((uintptr_t)pinnedObject - packedBytes);
+	Assert_MM_true(deadObject <= packedBase);
+
+	/* Passed by reference: page, counter.  MODIFIED INSIDE the funcall. */
+	omrobjectptr_t destination = packedBase;
+	for (uintptr_t i = 0; i < packedCount; i++) {
+		saveForwardingPtr(entry, packedObjects[i], destination, page, counter);
+		destination = (omrobjectptr_t)((uintptr_t)destination + _extensions->objectModel.getConsumedSizeInBytesWithHeader(packedObjects[i]));
+	}
+	saveForwardingPtr(entry, pinnedObject, pinnedObject, page, counter);
+
+	/* Objects only move up here, so move them in reverse address order to leave the ones below intact */
+	for (uintptr_t i = packedCount; i > 0; i--) {
+		omrobjectptr_t movedObject = packedObjects[i - 1];
+		uintptr_t objectSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(movedObject);
+		destination = (omrobjectptr_t)((uintptr_t)destination - objectSize);
+		if (destination != movedObject) {
+			memmove(destination, movedObject, objectSize);
+			nobjects += 1;
+			nbytes += objectSize;
+		}
+	}
+	Assert_MM_true(destination == packedBase);
+
+	/* The gap is walkable, rebuildFreelist finds it again from the pinned count of the sub area */
+	setFreeChunk(deadObject, packedBase);
+
+	uintptr_t pinnedSize = _extensions->objectModel.getConsumedSizeInBytesWithHeader(pinnedObject);
+	env->_compactStats._pinnedObjects += 1;
+	env->_compactStats._pinnedBytes += pinnedSize;
+
+	return (omrobjectptr_t)((uintptr_t)pinnedObject + pinnedSize);
+}
+
 omrobjectptr_t
 MM_CompactScheme::getForwardingPtr(omrobjectptr_t objectPtr) const
 {
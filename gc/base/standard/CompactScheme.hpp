@@ -93,6 +93,11 @@ private:
 		omrobjectptr_t freeChunk;
         volatile uintptr_t state;
         volatile uintptr_t currentAction; /**< record the status of the subarea for parallelization */
+		uintptr_t liveBytes; /**< planned moves: bytes of marked objects in the subarea */
+		omrobjectptr_t destination; /**< planned moves: address the first marked object slides to (end of live data for end_segment) */
+		omrobjectptr_t destinationBoundary; /**< planned moves: first moved object starting at or above the first page boundary at or above destination */
+		intptr_t dependency; /**< planned moves: lowest subarea of the segment which has to be emptied before this one can slide */
+		uintptr_t pinnedObjects; /**< number of large objects the slide left in place, the free gaps in front of them are only found by walking the subarea */
         
     	/* legal values for currentAction */
     	enum {
@@ -101,7 +106,9 @@ private:
     		evacuating,
     		fixing_up,
     		rebuilding_mark_bits,
-    		fixing_heap_for_walk
+    		fixing_heap_for_walk,
+    		summarizing,
+    		sliding
     	};
     	
     	/* legal values for state
@@ -138,6 +145,7 @@ protected:
     SubAreaEntry *_subAreaTable;  /**< Reference to the subAreaTable which is shared data from the SweepHeapSectioning */
     omrobjectptr_t _compactFrom;
     omrobjectptr_t _compactTo;
+	uintptr_t _pinnedObjectMinimumSize; /**< objects of at least this size are not moved, 0 if all objects are moved (see largeObjectPinnedSize) */
     MM_CompactDelegate _delegate;
 
 public:
@@ -183,8 +191,42 @@ protected:
                         omrobjectptr_t &deadObject,
                         uintptr_t &objectCount,
                         uintptr_t &byteCount,
+                        uintptr_t &pinnedCount,
                         bool evacuate);
 
+	/**
+	 * Find the object to leave in place on the page of objectPtr. Only the last marked object starting on
+	 * a page can be pinned: it must be at least _pinnedObjectMinimumSize, which is never less than a page.
+	 *
+	 * @param[in] objectPtr the first marked object of the page still to be moved
+	 * @return the pinned object, or NULL if all the objects of the page can be moved
+	 */
+	omrobjectptr_t getPinnedObject(omrobjectptr_t objectPtr);
+
+	/**
+	 * Slide the objects of a page which ends with a pinned object. The pinned object stays in place and
+	 * the objects from objectPtr up to it are packed right below it, so that the forwarding addresses of
+	 * the page are still contiguous from its first object. The space between deadObject and the packed
+	 * objects is left as a free chunk.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] objectPtr the first marked object of the page still to be moved
+	 * @param[in] pinnedObject the pinned object of the page (see getPinnedObject)
+	 * @param[in] deadObject the address the next moved object would otherwise have been moved to
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 * @return the end of the pinned object, where the following objects slide to
+	 */
+	omrobjectptr_t slidePinnedPage(MM_EnvironmentStandard *env,
+						omrobjectptr_t objectPtr,
+						omrobjectptr_t pinnedObject,
+						omrobjectptr_t deadObject,
+						class CompactTableEntry &entry,
+						intptr_t &page,
+						intptr_t &counter,
+						uintptr_t &objectCount,
+						uintptr_t &byteCount);
+
     /**
      * Attempt to evacuate objects from the specified subArea.
      *
@@ -206,6 +248,53 @@ protected:
 
     void moveObjects(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount, uintptr_t &skippedObjectCount);
 
+	/**
+	 * Planned moves, first pass. Record the live bytes of every subarea from the mark map, then
+	 * (master only) assign each subarea the destination its objects slide to and the lowest subarea
+	 * it depends on.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void summarizeSubAreas(MM_EnvironmentStandard *env);
+
+	/**
+	 * Compute destinations and dependencies for all subareas from their live bytes. Master thread only.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void planSubAreaMoves(MM_EnvironmentStandard *env);
+
+	/**
+	 * Planned moves, second pass. Slide the subareas of every segment towards the segment base.
+	 * Threads claim subareas in address order and only start on one once all subareas covering
+	 * its destination have been emptied, so that no subarea waits for a higher one.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void moveObjectsPlanned(MM_EnvironmentStandard *env, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Slide all marked objects of a subarea to its planned destination and record their forwarding
+	 * addresses in the compact table.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in] subAreaTable the subArea table of the segment
+	 * @param[in] i The current subArea index
+	 * @param[in/out] objectCount the number of objects moved (accumulated)
+	 * @param[in/out] byteCount the number of bytes moved (accumulated)
+	 */
+	void slideSubArea(MM_EnvironmentStandard *env, SubAreaEntry *subAreaTable, intptr_t i, uintptr_t &objectCount, uintptr_t &byteCount);
+
+	/**
+	 * Replace the subarea table with one describing the compacted heap, in the form expected by
+	 * fixupObjects, rebuildFreelist and rebuildMarkbits. Master thread only.
+	 *
+	 * @param env[in] the current thread
+	 */
+	void completePlannedSubAreaTable(MM_EnvironmentStandard *env);
+
     /**
      * Fix up all references to moved objects in the specified subArea
      *
@@ -220,6 +309,21 @@ protected:
 
     void rebuildFreelist(MM_EnvironmentStandard *env);
 
+	/**
+	 * Add the free gaps left in front of pinned objects in [start, end) to the pool. A free range still open
+	 * at start (currentFreeBase) is extended over a leading gap. A gap after the last object of the range is
+	 * dropped, like the unusable tail of a subarea.
+	 *
+	 * @param env[in] the current thread
+	 * @param[in/out] currentFreeBase base of the free range not yet added to the pool, NULL on return
+	 */
+	void addPinnedGapFreeEntries(MM_EnvironmentStandard *env,
+					MM_MemorySubSpace *memorySubSpace,
+					MM_CompactMemoryPoolState *poolState,
+					omrobjectptr_t start,
+					omrobjectptr_t end,
+					void *&currentFreeBase);
+
     void addFreeEntry(MM_EnvironmentStandard *env,
 					MM_MemorySubSpace *memorySubSpace,
 					MM_CompactMemoryPoolState *poolState,
@@ -335,6 +439,7 @@ public:
         , _markMap(markingScheme->getMarkMap())
         , _subAreaTableSize(0)
     	, _subAreaTable(NULL)
+    	, _pinnedObjectMinimumSize(0)
     	, _delegate()
     {
     	_typeId = __FUNCTION__;
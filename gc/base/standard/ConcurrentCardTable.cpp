@@ -494,6 +494,10 @@ MM_ConcurrentCardTable::initialize(MM_EnvironmentBase *env, MM_Heap *heap)
 			(*mmPrivateHooks)->J9HookRegisterWithCallSite(mmPrivateHooks, J9HOOK_MM_PRIVATE_CACHE_REFRESHED, tlhRefreshed, OMR_GET_CALLSITE(), (void *)this);
 		}
 	
+		if (_extensions->concurrentCardSummary && !initializeSummary(env, heap)) {
+			return false;
+		}
+
 		/* Set default card cleaning masks used by getNextDirtycard */
 		_concurrentCardCleanMask = CONCURRENT_CARD_CLEAN_MASK;
 		_finalCardCleanMask = FINAL_CARD_CLEAN_MASK;
@@ -609,6 +613,7 @@ MM_ConcurrentCardTable::dirtyCardsInRange(MM_EnvironmentBase *env, void *heapBas
 		/* If card not already dirty then dirty it */
 		if (*baseCard != (Card)CARD_DIRTY) {
 			*baseCard = (Card)CARD_DIRTY;
+			summarizeCard(baseCard);
 		}
 		baseCard += 1;
 	}
@@ -917,9 +922,13 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	if (NULL == nextDirtyCard) {
         currentCleaningPhase = _cardCleanPhase;
         if (cardCleaningInProgress(currentCleaningPhase)) {
-			MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
+			uint32_t oldPhase = MM_AtomicOperations::lockCompareExchangeU32((volatile uint32_t*)&_cardCleanPhase,
 																								(uint32_t) currentCleaningPhase,
 																								(uint32_t) currentCleaningPhase + 1);
+			/* The thread which completes the last concurrent phase drops the summary bits of the cards cleaned during the cycle */
+			if (isSummaryEnabled() && ((uint32_t)currentCleaningPhase == oldPhase) && (((uint32_t)currentCleaningPhase + 1) == (uint32_t)_lastCardCleanPhase)) {
+				summarizeCleanedCards(env);
+			}
         }
 	}
 
@@ -930,6 +939,34 @@ MM_ConcurrentCardTable::cleanCards(MM_EnvironmentBase *env, bool isMutator, uint
 	return true;
 }
 
+/**
+ * Rebuild the card summary once concurrent card cleaning is complete.
+ *
+ * The summary bit of a group of cards stays set when its cards are cleaned, so without a rebuild final
+ * card cleaning would visit every group dirtied since the start of the cycle.  The rebuild is done a chunk
+ * of cards at a time and abandoned if another thread wants exclusive VM access; groups not yet rebuilt
+ * are simply scanned by final card cleaning.
+ */
+void
+MM_ConcurrentCardTable::summarizeCleanedCards(MM_EnvironmentBase *env)
+{
+	const uintptr_t cardsPerChunk = CARD_SUMMARY_CARDS_PER_BIT * J9BITS_BITS_IN_SLOT * 16;
+
+	for (CleaningRange *range = _cleaningRanges; range < _lastCleaningRange; range++) {
+		Card *chunkStart = range->baseCard;
+		while (chunkStart < range->topCard) {
+			if (env->isExclusiveAccessRequestWaiting()) {
+				return;
+			}
+			/* chunks are aligned in the card table so that no group of cards straddles two chunks */
+			uintptr_t chunkTopIndex = MM_Math::roundToFloor(cardsPerChunk, (uintptr_t)(chunkStart - getCardTableStart())) + cardsPerChunk;
+			Card *chunkEnd = OMR_MIN(getCardTableStart() + chunkTopIndex, range->topCard);
+			rebuildSummary(env, chunkStart, chunkEnd);
+			chunkStart = chunkEnd;
+		}
+	}
+}
+
 /**
  * Clean all objects in a single card
  *
@@ -966,6 +1003,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 		if (env->isExclusiveAccessRequestWaiting()) {
 			/* Re-dirty the card as we did not finish cleaning it ... */
 			*card = (Card)CARD_DIRTY;
+			summarizeCard(card);
 			/* ...and get out now */
 			return false;
 		}
@@ -1012,6 +1050,7 @@ MM_ConcurrentCardTable::cleanSingleCard(MM_EnvironmentBase *env, Card *card, uin
 	 */
 	if (rememberedObjectsFound && (env->getExtensions()->isRememberedSetInOverflowState())) {
 		*card = (Card)CARD_DIRTY;
+		summarizeCard(card);
 	}
 
 	return true;
@@ -1646,13 +1685,30 @@ MM_ConcurrentCardTable::getNextDirtyCard(MM_EnvironmentBase *env, Card cardMask,
 	 		 * scan the card table.
 	 		 */
 			if (((Card)CARD_CLEAN == *currentCard) && (0 == (uintptr_t)currentCard % sizeof(uintptr_t))) {
+				if (isSummaryEnabled()) {
+					/* Skip the groups of cards which the summary shows to be clean */
+					Card *summarizedCard = skipCleanCardGroups(currentCard, lastCardToClean);
+					if (summarizedCard != currentCard) {
+						_cardTableStats.incCleanCardGroupsSkipped((uintptr_t)(summarizedCard - currentCard) / CARD_SUMMARY_CARDS_PER_BIT);
+						currentCard = summarizedCard;
+					}
+					if (currentCard >= lastCardToClean) {
+						break;
+					}
+				}
 				uintptr_t *nextSlot = (uintptr_t *)currentCard;
 				/* Last card may be in middle of a slot so only scan up to an including last
 				 * complete slots worth of cards; then go card at a time
 				 **/
 				uintptr_t *lastSlot = (uintptr_t *)MM_Math::roundToFloor(sizeof(uintptr_t), (uintptr_t)lastCardToClean);
-				while ((nextSlot < lastSlot) && (SLOT_ALL_CLEAN == *nextSlot)) {
-					nextSlot += 1;
+				if (isSummaryEnabled()) {
+					/* Go back to the summary at the end of the group, in case its bit was set by a card since cleaned */
+					Card *groupTop = currentCard + (CARD_SUMMARY_CARDS_PER_BIT - ((uintptr_t)(currentCard - getCardTableStart()) % CARD_SUMMARY_CARDS_PER_BIT));
+					lastSlot = OMR_MIN(lastSlot, (uintptr_t *)groupTop);
+				}
+				if (nextSlot < lastSlot) {
+					/* CARD_CLEAN is zero, so runs of clean slots are skipped in bulk like empty heap map slots */
+					nextSlot = _extensions->heapMapScan.skipEmptySlots(nextSlot, lastSlot);
 				}
 				/*
 			     * Either end of scan or a slot which contains a dirty card found. Reset scan ptr
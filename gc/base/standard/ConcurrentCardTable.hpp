@@ -196,6 +196,7 @@ private:
 	bool isCardInActiveTLH(MM_EnvironmentBase *env, Card *card);
 	
 	void reportCardCleanPass2Start(MM_EnvironmentBase *env);
+	void summarizeCleanedCards(MM_EnvironmentBase *env);
 		
 	MMINLINE uintptr_t getTLHMarkBitMask(uintptr_t index)
 	{
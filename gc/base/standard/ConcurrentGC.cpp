@@ -314,6 +314,7 @@ MM_ConcurrentGC::reportConcurrentFinalCardCleaningEnd(MM_EnvironmentBase *env, u
 		cardTable->getCardTableStats()->getConcurrentCleanedCardsPhase2(),
 		cardTable->getCardTableStats()->getConcurrentCleanedCardsPhase3(),
 		cardTable->getCardTableStats()->getConcurrentCleanedCards(),
+		cardTable->getCardTableStats()->getCleanCardGroupsSkipped(),
 		_stats.getCardCleaningThreshold(),
 		cardTable->getCardTableStats()->getCardCleaningPhase1Kickoff(),
 		cardTable->getCardTableStats()->getCardCleaningPhase2Kickoff(),
@@ -0,0 +1,138 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "ConcurrentScavengerModeController.hpp"
+#include "Dispatcher.hpp"
+#include "ScavengerStats.hpp"
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+
+MM_ConcurrentScavengerModeController *
+MM_ConcurrentScavengerModeController::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentScavengerModeController *controller = (MM_ConcurrentScavengerModeController *)env->getForge()->allocate(sizeof(MM_ConcurrentScavengerModeController), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != controller) {
+		new(controller) MM_ConcurrentScavengerModeController(env);
+		if (!controller->initialize(env)) {
+			controller->kill(env);
+			controller = NULL;
+		}
+	}
+	return controller;
+}
+
+void
+MM_ConcurrentScavengerModeController::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ConcurrentScavengerModeController::initialize(MM_EnvironmentBase *env)
+{
+	if (0 == _extensions->concurrentScavengerAdaptiveProbeInterval) {
+		_extensions->concurrentScavengerAdaptiveProbeInterval = 1;
+	}
+	return true;
+}
+
+void
+MM_ConcurrentScavengerModeController::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+uint64_t
+MM_ConcurrentScavengerModeController::getPredictedPauseTime()
+{
+	/* until a stop-the-world cycle is measured, its copy rate is estimated from the concurrent phase */
+	double copyRate = _stopTheWorldSampled ? _averageStopTheWorldCopyRate : _averageConcurrentCopyRate;
+	return (copyRate > 0.0) ? (uint64_t)(_averageCopiedBytes / copyRate) : 0;
+}
+
+bool
+MM_ConcurrentScavengerModeController::scavengeConcurrently(MM_EnvironmentBase *env)
+{
+	if (!_concurrentSampled) {
+		/* no read barrier cost to compare with yet, start in the configured mode */
+		return true;
+	}
+	if (_consecutiveStopTheWorldCycles >= _extensions->concurrentScavengerAdaptiveProbeInterval) {
+		/* the read barrier cost changes with the application, measure it again */
+		return true;
+	}
+
+	uint64_t predictedPauseTime = getPredictedPauseTime();
+	if (0 == predictedPauseTime) {
+		return true;
+	}
+	if ((0 != _extensions->scavengerPauseTarget) && (predictedPauseTime > ((uint64_t)_extensions->scavengerPauseTarget * 1000))) {
+		/* a stop-the-world cycle would miss the pause target */
+		return true;
+	}
+
+	/* The read barrier time is summed across the mutator threads, while a pause stalls all of them at once,
+	 * so the comparison favours stop-the-world cycles when many threads run into the read barrier.
+	 */
+	return predictedPauseTime > getPredictedConcurrentCost();
+}
+
+void
+MM_ConcurrentScavengerModeController::update(MM_EnvironmentBase *env, bool concurrentCycle)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	uintptr_t copiedBytes = stats->_flipBytes + stats->_tenureAggregateBytes;
+	uint64_t pauseTime = omrtime_hires_delta(0, stats->_stopTheWorldTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+
+	_averageCopiedBytes = average(_averageCopiedBytes, (double)copiedBytes, !(_concurrentSampled || _stopTheWorldSampled));
+
+	if (concurrentCycle) {
+		uint64_t readBarrierTime = omrtime_hires_delta(0, stats->_readObjectBarrierTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t concurrentPhaseTime = omrtime_hires_delta(0, stats->_concurrentPhaseTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uintptr_t backgroundThreads = OMR_MAX(_extensions->concurrentScavengerBackgroundThreads, 1);
+		uintptr_t threadCount = _extensions->dispatcher->threadCount();
+
+		_averageConcurrentPauseTime = average(_averageConcurrentPauseTime, (double)pauseTime, !_concurrentSampled);
+		_averageReadBarrierTime = average(_averageReadBarrierTime, (double)readBarrierTime, !_concurrentSampled);
+		if (0 != concurrentPhaseTime) {
+			double concurrentCopyRate = (double)stats->_concurrentPhaseBytesScanned * (double)threadCount / ((double)concurrentPhaseTime * (double)backgroundThreads);
+			_averageConcurrentCopyRate = average(_averageConcurrentCopyRate, concurrentCopyRate, (0.0 == _averageConcurrentCopyRate));
+		}
+		_concurrentSampled = true;
+		_consecutiveStopTheWorldCycles = 0;
+	} else {
+		if (0 != pauseTime) {
+			_averageStopTheWorldCopyRate = average(_averageStopTheWorldCopyRate, (double)copiedBytes / (double)pauseTime, !_stopTheWorldSampled);
+			_stopTheWorldSampled = true;
+		}
+		_consecutiveStopTheWorldCycles += 1;
+	}
+
+	stats->_adaptivePredictedPauseTime = getPredictedPauseTime();
+	stats->_adaptivePredictedConcurrentCost = getPredictedConcurrentCost();
+}
+
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
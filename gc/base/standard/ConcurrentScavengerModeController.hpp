@@ -0,0 +1,141 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSCAVENGERMODECONTROLLER_HPP_)
+#define CONCURRENTSCAVENGERMODECONTROLLER_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+
+/**
+ * Per cycle mode selection for Concurrent Scavenger (concurrentScavengerAdaptive).
+ * A concurrent cycle trades most of the scavenge pause for read barrier slow path calls made by the mutator
+ * threads while the cycle is in progress.  The controller keeps a cost model of both modes: the pause of a
+ * stop-the-world cycle is predicted from the bytes copied by recent cycles and the stop-the-world copy rate,
+ * and the cost of a concurrent cycle from its remaining pauses (start and end of the cycle) and the time
+ * spent in the read barrier slow path.  Before each cycle it picks the mode predicted to be cheaper.
+ * While stop-the-world cycles are picked, a concurrent cycle is run every concurrentScavengerAdaptiveProbeInterval
+ * cycles to refresh the read barrier cost, which depends on the application.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentScavengerModeController : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	double _averageCopiedBytes; /**< weighted average of the bytes copied (flipped and tenured) by a cycle */
+	double _averageStopTheWorldCopyRate; /**< weighted average of the bytes copied per microsecond of pause by stop-the-world cycles, 0 before the first one */
+	double _averageConcurrentCopyRate; /**< weighted average of the bytes scanned per microsecond by the concurrent phase, scaled to the stop-the-world GC thread count */
+	double _averageConcurrentPauseTime; /**< weighted average of the total pause of a concurrent cycle, in microseconds */
+	double _averageReadBarrierTime; /**< weighted average of the read barrier slow path time of a concurrent cycle, in microseconds */
+	bool _concurrentSampled; /**< true once a concurrent cycle has been measured */
+	bool _stopTheWorldSampled; /**< true once a stop-the-world cycle has been measured */
+	uintptr_t _consecutiveStopTheWorldCycles; /**< number of stop-the-world cycles since the last concurrent cycle */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	/**
+	 * Fold a new sample into a weighted average, the first sample becomes the average.
+	 */
+	MMINLINE double
+	average(double currentAverage, double sample, bool firstSample)
+	{
+		return firstSample ? sample : ((currentAverage * 0.7) + (sample * 0.3));
+	}
+
+	/**
+	 * @return the predicted pause of a stop-the-world cycle in microseconds, 0 if there is no copy rate to predict it from
+	 */
+	uint64_t getPredictedPauseTime();
+
+	/**
+	 * @return the predicted pauses and read barrier time of a concurrent cycle in microseconds
+	 */
+	MMINLINE uint64_t
+	getPredictedConcurrentCost()
+	{
+		return (uint64_t)(_averageConcurrentPauseTime + _averageReadBarrierTime);
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ConcurrentScavengerModeController *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Decide the mode of the next cycle.
+	 * Must be called by the thread triggering the scavenge, while no concurrent cycle is in progress.
+	 * @return true if the cycle should run concurrently, false if stop-the-world
+	 */
+	bool scavengeConcurrently(MM_EnvironmentBase *env);
+
+	/**
+	 * Feed the cost model with the statistics of a successful cycle, and record the predictions in the cycle scavenger stats.
+	 * Must be called by the master thread at the end of the cycle, after the scavenge stats have been merged.
+	 * @param env[in] the master thread
+	 * @param concurrentCycle[in] true if the cycle ran concurrently
+	 */
+	void update(MM_EnvironmentBase *env, bool concurrentCycle);
+
+	/**
+	 * Create a ConcurrentScavengerModeController object.
+	 */
+	MM_ConcurrentScavengerModeController(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _averageCopiedBytes(0.0)
+		, _averageStopTheWorldCopyRate(0.0)
+		, _averageConcurrentCopyRate(0.0)
+		, _averageConcurrentPauseTime(0.0)
+		, _averageReadBarrierTime(0.0)
+		, _concurrentSampled(false)
+		, _stopTheWorldSampled(false)
+		, _consecutiveStopTheWorldCycles(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+#endif /* CONCURRENTSCAVENGERMODECONTROLLER_HPP_ */
@@ -0,0 +1,256 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#include "omrcfg.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "omrmodroncore.h"
+#include "ModronAssertions.h"
+
+#include "ConcurrentSweepGC.hpp"
+
+#include "AllocateDescription.hpp"
+#include "ConcurrentSweepScheme.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+/**
+ * Create new instance of ConcurrentSweepGC object.
+ *
+ * @return Reference to new MM_ConcurrentSweepGC object or NULL
+ */
+MM_ConcurrentSweepGC *
+MM_ConcurrentSweepGC::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepGC *globalGC = (MM_ConcurrentSweepGC *)env->getForge()->allocate(sizeof(MM_ConcurrentSweepGC), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != globalGC) {
+		new(globalGC) MM_ConcurrentSweepGC(env);
+		if (!globalGC->initialize(env)) {
+			globalGC->kill(env);
+			globalGC = NULL;
+		}
+	}
+	return globalGC;
+}
+
+/**
+ * Destroy instance of an ConcurrentSweepGC object.
+ */
+void
+MM_ConcurrentSweepGC::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+/**
+ * Initialize a new ConcurrentSweepGC object.
+ * The master GC thread runs collections implicitly (on the requesting thread) and holds VM access
+ * while it drives the background sweep.  The background sweep is not resumed once it has yielded to an
+ * exclusive access request: chunks left behind are swept on demand by allocating threads or completed
+ * by the next collection, which notifies the master GC thread again.
+ *
+ * @return TRUE if initialization completed OK;FALSE otherwise
+ */
+bool
+MM_ConcurrentSweepGC::initialize(MM_EnvironmentBase *env)
+{
+	if (!MM_ParallelGlobalGC::initialize(env)) {
+		return false;
+	}
+
+	/* the sweep scheme is picked from the same option that selected this collector */
+	Assert_MM_true(_extensions->concurrentSweep);
+
+	if (!_masterGCThread.initialize(this, true, true, false)) {
+		return false;
+	}
+
+	return true;
+}
+
+/**
+ * Teardown a ConcurrentSweepGC object.
+ */
+void
+MM_ConcurrentSweepGC::tearDown(MM_EnvironmentBase *env)
+{
+	_masterGCThread.tearDown(env);
+	MM_ParallelGlobalGC::tearDown(env);
+}
+
+/**
+ * Start the master GC thread which drives the background sweep.
+ */
+bool
+MM_ConcurrentSweepGC::collectorStartup(MM_GCExtensionsBase* extensions)
+{
+	if (!MM_ParallelGlobalGC::collectorStartup(extensions)) {
+		return false;
+	}
+	return _masterGCThread.startup();
+}
+
+/**
+ * Stop the master GC thread which drives the background sweep.
+ */
+void
+MM_ConcurrentSweepGC::collectorShutdown(MM_GCExtensionsBase *extensions)
+{
+	_masterGCThread.shutdown();
+	MM_ParallelGlobalGC::collectorShutdown(extensions);
+}
+
+/**
+ * Collect on the requesting thread through the master GC thread, so that the master GC thread is
+ * notified of the background sweep work left behind by the collection.
+ */
+bool
+MM_ConcurrentSweepGC::internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription)
+{
+	if (_disableGC) {
+		return MM_ParallelGlobalGC::internalGarbageCollect(env, subSpace, allocDescription);
+	}
+
+	_extensions->globalGCStats.gcCount += 1;
+	_masterGCThread.garbageCollect(env, allocDescription);
+	return true;
+}
+
+/**
+ * Run the stop-the-world part of the collection.
+ * There is no concurrent mark to have initialized the mark map ahead of the collection, so the
+ * mark map is always initialized by the collection itself.
+ */
+void
+MM_ConcurrentSweepGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits)
+{
+	MM_ParallelGlobalGC::masterThreadGarbageCollect(env, allocDescription, true, rebuildMarkBits);
+}
+
+void
+MM_ConcurrentSweepGC::internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode)
+{
+	/**
+	 * Finish off any sweep work still pending before the GC.  We do this to make sure the
+	 * heap is walkable (the sweep could have connected part of an entry that spans many chunks,
+	 * thus creating an unwalkable portion of the heap).
+	 */
+	completeConcurrentSweep(env);
+
+	MM_ParallelGlobalGC::internalPreCollect(env, subSpace, allocDescription, gcCode);
+}
+
+/**
+ * Replenish a pools free lists to satisfy a given allocate.
+ * Allocating threads sweep and connect chunks on demand until an entry of the requested size is available.
+ * @note This call is made under the pools allocation lock (or equivalent)
+ * @return True if the pool was replenished with a free entry that can satisfy the size, false otherwise.
+ */
+bool
+MM_ConcurrentSweepGC::replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size)
+{
+	return _sweepScheme->replenishPoolForAllocate(env, memoryPool, size);
+}
+
+/**
+ * Pay the allocation tax for the mutator.
+ */
+void
+MM_ConcurrentSweepGC::payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription)
+{
+	concurrentSweep(env, baseSubSpace, allocDescription);
+}
+
+void
+MM_ConcurrentSweepGC::concurrentSweep(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_AllocateDescription *allocDescription)
+{
+	uintptr_t oldVMstate = env->pushVMstate(OMRVMSTATE_GC_CONCURRENT_SWEEP);
+	getConcurrentSweepScheme()->payAllocationTax(env, subspace, allocDescription);
+	env->popVMstate(oldVMstate);
+}
+
+void
+MM_ConcurrentSweepGC::completeConcurrentSweep(MM_EnvironmentBase *env)
+{
+	MM_ConcurrentSweepScheme *concurrentSweep = getConcurrentSweepScheme();
+
+	/* If concurrent sweep was not on this cycle, or has already been completed, do nothing */
+	if (!concurrentSweep->isConcurrentSweepActive()) {
+		return;
+	}
+
+	concurrentSweep->completeSweep(env, ABOUT_TO_GC);
+}
+
+/**
+ * @return true if chunks are left to be swept in the background
+ */
+bool
+MM_ConcurrentSweepGC::isConcurrentWorkAvailable(MM_EnvironmentBase *env)
+{
+	return getConcurrentSweepScheme()->isSweepWorkAvailable();
+}
+
+/**
+ * The background sweep is not reported as a concurrent phase: the concurrent phase events are
+ * reported by the standard verbose handler as part of a scavenge.  The sweep scheme traces its own progress.
+ */
+void
+MM_ConcurrentSweepGC::preConcurrentInitializeStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats)
+{
+	stats->_cycleID = _cycleState._verboseContextID;
+}
+
+/**
+ * Sweep the chunks left behind by the last collection with background GC threads.
+ * @note Called by the master GC thread while holding VM access.
+ * @return the number of heap bytes swept
+ */
+uintptr_t
+MM_ConcurrentSweepGC::masterThreadConcurrentCollect(MM_EnvironmentBase *env)
+{
+	uintptr_t bytesSwept = getConcurrentSweepScheme()->sweepInBackground(env, _extensions->concurrentSweepBackgroundThreads);
+
+	if (getConcurrentSweepScheme()->isSweepWorkAvailable()) {
+		/* Yielded to an exclusive access request - the remaining chunks are left to allocating threads and the next collection */
+		getConcurrentPhaseStats()->_terminationRequestType = (NULL == _extensions->gcExclusiveAccessThreadId)
+				? MM_ConcurrentPhaseStatsBase::terminationRequest_External
+				: MM_ConcurrentPhaseStatsBase::terminationRequest_ByGC;
+	}
+
+	return bytesSwept;
+}
+
+void
+MM_ConcurrentSweepGC::postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned)
+{
+	stats->_bytesScanned = bytesConcurrentlyScanned;
+}
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
@@ -0,0 +1,115 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(CONCURRENTSWEEPGC_HPP_)
+#define CONCURRENTSWEEPGC_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+
+#include "ConcurrentPhaseStatsBase.hpp"
+#include "MasterGCThread.hpp"
+#include "ParallelGlobalGC.hpp"
+
+class MM_ConcurrentSweepScheme;
+
+/**
+ * Flat mark and sweep global collector which sweeps lazily.
+ * The collection pause marks the heap and sweeps only as much as is needed to satisfy the allocation which
+ * triggered it.  The remaining chunks are swept after the pause, by background GC threads driven from the
+ * master GC thread and by allocating threads that run out of free entries in their pool.  Any sweep work
+ * still pending is completed at the start of the next collection.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ConcurrentSweepGC : public MM_ParallelGlobalGC
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_MasterGCThread _masterGCThread; /**< An object which manages the state of the master GC thread */
+	MM_ConcurrentPhaseStatsBase _concurrentPhaseStats; /**< Stats of the background sweep phase, required by the master GC thread */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE MM_ConcurrentSweepScheme *getConcurrentSweepScheme() { return (MM_ConcurrentSweepScheme *)_sweepScheme; }
+
+	/**
+	 * Run a concurrent sweep as part of the current allocation tax.
+	 */
+	void concurrentSweep(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_AllocateDescription *allocDescription);
+
+	/**
+	 * Finish all concurrent sweep activities.
+	 * @note Expects exclusive access to be held.
+	 * @note Expects to have parallel helper threads available.
+	 */
+	void completeConcurrentSweep(MM_EnvironmentBase *env);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	void tearDown(MM_EnvironmentBase *env);
+
+	virtual void masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap, bool rebuildMarkBits);
+	virtual bool internalGarbageCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription);
+	virtual void internalPreCollect(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, MM_AllocateDescription *allocDescription, uint32_t gcCode);
+
+public:
+	static MM_ConcurrentSweepGC *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	virtual bool collectorStartup(MM_GCExtensionsBase* extensions);
+	virtual void collectorShutdown(MM_GCExtensionsBase *extensions);
+
+	virtual void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, MM_MemorySubSpace *baseSubSpace, MM_AllocateDescription *allocDescription);
+	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, uintptr_t size);
+
+	virtual bool isConcurrentWorkAvailable(MM_EnvironmentBase *env);
+	virtual void preConcurrentInitializeStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats);
+	virtual uintptr_t masterThreadConcurrentCollect(MM_EnvironmentBase *env);
+	virtual void postConcurrentUpdateStatsAndReport(MM_EnvironmentBase *env, MM_ConcurrentPhaseStatsBase *stats, UDATA bytesConcurrentlyScanned);
+	virtual MM_ConcurrentPhaseStatsBase *getConcurrentPhaseStats() { return &_concurrentPhaseStats; }
+
+	MM_ConcurrentSweepGC(MM_EnvironmentBase *env)
+		: MM_ParallelGlobalGC(env)
+		, _masterGCThread(env)
+		, _concurrentPhaseStats()
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_CONCURRENT_SWEEP */
+
+#endif /* CONCURRENTSWEEPGC_HPP_ */
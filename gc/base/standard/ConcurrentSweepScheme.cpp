@@ -328,6 +328,60 @@ MM_ConcurrentSweepFindMinimumSizeFreeTask::run(MM_EnvironmentBase *env)
 	((MM_ConcurrentSweepScheme *)_sweepScheme)->workThreadFindMinimumSizeFreeEntry(env, _memorySubSpace, _minimumFreeSize);
 }
 
+/**
+ * Parallel task to sweep chunks in the background once the collection pause has ended.
+ * Skeletal task object that calls back to the sweeper.  Threads running the task hold VM access and
+ * give up their work as soon as another thread requests exclusive access.
+ * 
+ * @note Defined privately by MM_ConcurrentSweepScheme.
+ */
+class MM_ConcurrentSweepBackgroundTask : public MM_ParallelSweepTask
+{
+	/*
+	 * Data members
+	 */
+private:
+protected:
+public:
+	volatile UDATA _bytesSwept;  /**< Heap bytes swept by all threads participating in the task */
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+public:
+	virtual UDATA getVMStateID() { return OMRVMSTATE_GC_CONCURRENT_SWEEP; }
+
+	virtual void run(MM_EnvironmentBase *env);
+	virtual void cleanup(MM_EnvironmentBase *env);
+
+	MM_ConcurrentSweepBackgroundTask(MM_EnvironmentBase *env, MM_Dispatcher *dispatcher, MM_ConcurrentSweepScheme *concurrentSweepScheme)
+		: MM_ParallelSweepTask(env, dispatcher, concurrentSweepScheme)
+		, _bytesSwept(0)
+		{}
+};
+
+/**
+ * Sweep chunks until there are none left or exclusive access is requested.
+ * Callback to the sweeper to do the work.  No true functionality.
+ */
+void
+MM_ConcurrentSweepBackgroundTask::run(MM_EnvironmentBase *env)
+{
+	((MM_ConcurrentSweepScheme *)_sweepScheme)->workThreadSweepInBackground(env);
+}
+
+/**
+ * Gather the bytes swept by the thread before its statistics are merged into the global sweep statistics.
+ */
+void
+MM_ConcurrentSweepBackgroundTask::cleanup(MM_EnvironmentBase *env)
+{
+	MM_AtomicOperations::add(&_bytesSwept, env->_sweepStats.concurrentSweepBytes);
+	MM_ParallelSweepTask::cleanup(env);
+}
+
 /**
  * Allocate and initialize a new instance of the receiver.
  * @return a new instance of the receiver, or NULL on failure.
@@ -440,6 +494,8 @@ MM_ConcurrentSweepScheme::reportCompletedConcurrentSweep(MM_EnvironmentBase *env
 		_stats._completeSweepPhaseBytesSwept,
 		omrtime_hires_delta(_stats._completeConnectPhaseTimeStart, _stats._completeConnectPhaseTimeEnd, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
 		_stats._completeConnectPhaseBytesConnected,
+		_stats._backgroundBytesSwept,
+		_stats._allocationBytesSwept,
 		reason);
 }
 
@@ -855,6 +911,14 @@ MM_ConcurrentSweepScheme::sweepNextAvailableChunk(MM_EnvironmentStandard *env, M
 			MM_AtomicOperations::add((UDATA *)&_stats._concurrentCompleteSweepBytesSwept, chunk->size());
 		} else if (concurrentsweep_mode_stw_complete_sweep == _stats._mode) {
 			MM_AtomicOperations::add((UDATA *)&_stats._completeSweepPhaseBytesSwept, chunk->size());
+		} else if (concurrentsweep_mode_on == _stats._mode) {
+			if (MUTATOR_THREAD == env->getThreadType()) {
+				/* Allocating thread sweeping on demand or paying its allocation tax */
+				MM_AtomicOperations::add((UDATA *)&_stats._allocationBytesSwept, chunk->size());
+			} else {
+				/* Background GC thread - merged into the global sweep stats when the background task completes */
+				env->_sweepStats.concurrentSweepBytes += chunk->size();
+			}
 		}
 		return true;
 	}
@@ -1303,6 +1367,35 @@ MM_ConcurrentSweepScheme::workThreadCompleteSweep(MM_EnvironmentBase *envBase)
 	}
 }
 
+/**
+ * Sweep chunks of all memory pools in the background.
+ * This routine is the task entry point for all GC threads.  Chunks are swept but not connected: connection is
+ * left to allocating threads replenishing their pool, or to the completion of the sweep before the next collection.
+ * Threads hold VM access while sweeping and stop as soon as another thread requests exclusive access.
+ * @note Do not call directly as this is the entry point for the dispatched task.
+ */
+void
+MM_ConcurrentSweepScheme::workThreadSweepInBackground(MM_EnvironmentBase *envBase)
+{
+	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
+
+	MM_MemoryPool *memoryPool;
+	MM_HeapMemoryPoolIterator poolIterator(envBase, _extensions->heap);
+	while(NULL != (memoryPool = poolIterator.nextPool())) {
+		MM_ConcurrentSweepPoolState *sweepState = (MM_ConcurrentSweepPoolState *)getPoolState(memoryPool);
+
+		while(!env->isExclusiveAccessRequestWaiting()) {
+			if(!concurrentSweepNextAvailableChunk(env, sweepState)) {
+				break;
+			}
+		}
+
+		if(env->isExclusiveAccessRequestWaiting()) {
+			break;
+		}
+	}
+}
+
 /**
  * Sweep enough heap to find a free entry of the minimum free size.
  * This routine is the task entry point for all GC Threads.  The thread responsibilities in the task are split into 
@@ -1565,6 +1658,34 @@ MM_ConcurrentSweepScheme::completeSweepingConcurrently(MM_EnvironmentBase *envMo
 	return true;
 }
 
+/**
+ * Sweep the remaining chunks with background GC threads.
+ * The GC threads sweep until all chunks have been swept or until exclusive access is requested, so the caller
+ * may have to come back for more once it has regained VM access.  Bytes swept so far by the GC threads and by
+ * allocating threads are folded into the global sweep statistics.
+ * @note The calling thread is expected to hold VM access and to be able to dispatch tasks.
+ * @param threadCount the number of GC threads to sweep with
+ * @return the number of heap bytes swept by the GC threads.
+ */
+UDATA
+MM_ConcurrentSweepScheme::sweepInBackground(MM_EnvironmentBase *env, UDATA threadCount)
+{
+	UDATA bytesSwept = 0;
+
+	if(isSweepWorkAvailable()) {
+		MM_ConcurrentSweepBackgroundTask backgroundTask(env, _dispatcher, this);
+		_dispatcher->run(env, &backgroundTask, threadCount);
+		bytesSwept = backgroundTask._bytesSwept;
+		_stats._backgroundBytesSwept += bytesSwept;
+
+		MM_SweepStats *sweepStats = &_extensions->globalGCStats.sweepStats;
+		sweepStats->allocationSweepBytes = _stats._allocationBytesSwept;
+		Trc_MM_ConcurrentSweepScheme_sweepInBackground(env->getLanguageVMThread(), bytesSwept, sweepStats->concurrentSweepBytes, sweepStats->allocationSweepBytes);
+	}
+
+	return bytesSwept;
+}
+
 /**
  * Add to the concurrently sweeping thread pool count.
  * 
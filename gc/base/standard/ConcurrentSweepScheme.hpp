@@ -37,6 +37,7 @@ class MM_AllocateDescription;
 class MM_GlobalCollector;
 class MM_MemoryPool;
 class MM_MemoryPoolAddressOrderedList;
+class MM_ConcurrentSweepBackgroundTask;
 class MM_ConcurrentSweepCompleteSweepTask;
 class MM_ConcurrentSweepFindMinimumSizeFreeTask;
 class MM_ConcurrentSweepPoolState;
@@ -118,6 +119,8 @@ private:
 
 	void workThreadCompleteSweep(MM_EnvironmentBase *env);
 
+	void workThreadSweepInBackground(MM_EnvironmentBase *env);
+
 	void workThreadFindMinimumSizeFreeEntry(MM_EnvironmentBase *env, MM_MemorySubSpace *memorySubSpace, UDATA minimumFreeSize);
 
 	bool isConcurrentSweepCandidate(MM_MemorySubSpace *memorySubSpace);
@@ -162,6 +165,14 @@ public:
 	virtual bool sweepForMinimumSize(MM_EnvironmentBase *env, MM_MemorySubSpace *baseMemorySubSpace, MM_AllocateDescription *allocateDescription);
 	bool completeSweepingConcurrently(MM_EnvironmentBase *envModron);
 
+	/**
+	 * Determine whether any chunk is still waiting to be swept in the current concurrent sweep.
+	 * @note The answer is racy and only meant to decide whether background sweeping is worth starting.
+	 * @return true if concurrent sweep is active and not all chunks have been swept, false otherwise.
+	 */
+	bool isSweepWorkAvailable() { return isConcurrentSweepActive() && (_stats._totalChunkSweptCount < _stats._totalChunkCount); }
+	UDATA sweepInBackground(MM_EnvironmentBase *env, UDATA threadCount);
+
 	virtual bool replenishPoolForAllocate(MM_EnvironmentBase *env, MM_MemoryPool *memoryPool, UDATA size);
 	void payAllocationTax(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace,  MM_AllocateDescription *allocDescriptionn);
 
@@ -183,6 +194,7 @@ public:
 	/*
 	 * Friends
 	 */
+	friend class MM_ConcurrentSweepBackgroundTask;
 	friend class MM_ConcurrentSweepCompleteSweepTask;
 	friend class MM_ConcurrentSweepFindMinimumSizeFreeTask;
 };
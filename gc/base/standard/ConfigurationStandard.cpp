@@ -29,6 +29,7 @@
 
 #include "ConfigurationStandard.hpp"
 
+#include "AllocationSiteSampler.hpp"
 #if defined(OMR_GC_MODRON_CONCURRENT_MARK)
 #include "ConcurrentGCIncrementalUpdate.hpp"
 #include "ConcurrentGCSATB.hpp"
@@ -79,10 +80,33 @@ bool
 MM_ConfigurationStandard::initialize(MM_EnvironmentBase* env)
 {
 	MM_GCExtensionsBase* extensions = env->getExtensions();
+	if (extensions->transparentHugePageLayout && !extensions->isConcurrentScavengerHWSupported()) {
+		/* the heap is committed, and the nursery and tenure boundaries are moved, in whole regions: make them whole huge pages */
+		extensions->regionSize = OMR_MAX(extensions->regionSize, extensions->transparentHugePageSize);
+	}
 	bool result = MM_Configuration::initialize(env);
 	if (result) {
 		extensions->payAllocationTax = extensions->isConcurrentMarkEnabled() || extensions->isConcurrentSweepEnabled();
 		extensions->setStandardGC(true);
+		if (NULL != extensions->allocationSiteSampler) {
+			/* the standard collectors check the sampled objects at their first collection */
+			result = extensions->allocationSiteSampler->enableSurvivalTracking(env);
+		}
+#if defined(OMR_GC_MODRON_SCAVENGER)
+		if (extensions->numaAwareNursery) {
+			if (!extensions->scavengerEnabled || (extensions->_numaManager.getAffinityLeaderCount() < 2)) {
+				/* nothing to split the nursery between */
+				extensions->numaAwareNursery = false;
+			} else {
+				/* the node slices are bound when the semispaces are resized, tilting would move them on every scavenge */
+				extensions->tiltedScavenge = false;
+			}
+		}
+		if (!extensions->scavengerEnabled || extensions->isConcurrentScavengerEnabled()) {
+			/* the controller works from stop-the-world scavenge pauses */
+			extensions->scavengerPauseTarget = 0;
+		}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 	}
 
 	return result;
@@ -95,9 +119,11 @@ MM_ConfigurationStandard::initializeGCThreadCount(MM_EnvironmentBase* env)
 
 	MM_Configuration::initializeGCThreadCount(env);
 
-#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+#if defined(OMR_GC_CONCURRENT_SCAVENGER) || defined(OMR_GC_CONCURRENT_SWEEP)
 	MM_GCExtensionsBase* extensions = env->getExtensions();
+#endif /* OMR_GC_CONCURRENT_SCAVENGER || OMR_GC_CONCURRENT_SWEEP */
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/* If not explicitly set, concurrent phase of CS runs with approx 1/4 the thread count (relative to STW phases thread count */
 	if (!extensions->concurrentScavengerBackgroundThreadsForced) {
 		extensions->concurrentScavengerBackgroundThreads = OMR_MAX(1, (extensions->gcThreadCount + 1) / 4);
@@ -105,6 +131,15 @@ MM_ConfigurationStandard::initializeGCThreadCount(MM_EnvironmentBase* env)
 		extensions->concurrentScavengerBackgroundThreads = extensions->gcThreadCount;
 	}
 #endif
+
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/* Background sweeping competes with the mutators for CPU, run it with the same share of the GC threads as CS */
+	if (!extensions->concurrentSweepBackgroundThreadsForced) {
+		extensions->concurrentSweepBackgroundThreads = OMR_MAX(1, (extensions->gcThreadCount + 1) / 4);
+	} else if (extensions->concurrentSweepBackgroundThreads > extensions->gcThreadCount) {
+		extensions->concurrentSweepBackgroundThreads = extensions->gcThreadCount;
+	}
+#endif /* OMR_GC_CONCURRENT_SWEEP */
 }
 
 
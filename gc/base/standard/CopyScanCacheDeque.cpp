@@ -0,0 +1,79 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "CopyScanCacheDeque.hpp"
+#include "CopyScanCacheStandard.hpp"
+#include "GCExtensionsBase.hpp"
+#include "ModronAssertions.h"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+MM_CopyScanCacheDeque *
+MM_CopyScanCacheDeque::newInstance(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	MM_CopyScanCacheDeque *deque = (MM_CopyScanCacheDeque *)env->getForge()->allocate(sizeof(MM_CopyScanCacheDeque), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != deque) {
+		new(deque) MM_CopyScanCacheDeque();
+		if (!deque->initialize(env, capacity)) {
+			deque->kill(env);
+			deque = NULL;
+		}
+	}
+	return deque;
+}
+
+void
+MM_CopyScanCacheDeque::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_CopyScanCacheDeque::initialize(MM_EnvironmentBase *env, uintptr_t capacity)
+{
+	/* indices are masked into the buffer, so the capacity has to be a power of two */
+	Assert_MM_true((0 != capacity) && (0 == (capacity & (capacity - 1))));
+
+	_buffer = (MM_CopyScanCacheStandard * volatile *)env->getForge()->allocate(sizeof(MM_CopyScanCacheStandard *) * capacity, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _buffer) {
+		return false;
+	}
+	_capacity = capacity;
+	_mask = capacity - 1;
+
+	return true;
+}
+
+void
+MM_CopyScanCacheDeque::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _buffer) {
+		env->getForge()->free((void *)_buffer);
+		_buffer = NULL;
+	}
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,192 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(COPYSCANCACHEDEQUE_HPP_)
+#define COPYSCANCACHEDEQUE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+class MM_CopyScanCacheStandard;
+
+/**
+ * Bounded work-stealing deque of scan caches (Chase-Lev).
+ * The owning GC thread pushes and pops at the bottom without synchronization, other GC
+ * threads steal from the top with a single compare-and-swap. The deque does not grow:
+ * push fails when it is full and the caller is expected to fall back to a shared list.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_CopyScanCacheDeque : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_CopyScanCacheStandard * volatile *_buffer; /**< circular array of _capacity entries */
+	uintptr_t _capacity; /**< number of entries in _buffer, a power of two */
+	uintptr_t _mask; /**< _capacity - 1 */
+	uint8_t _padding0[128]; /**< keep _top (written by thieves) and _bottom (written by the owner) on different cache lines */
+	volatile uintptr_t _top; /**< index of the oldest entry, advanced by pop (last entry) and steal */
+	uint8_t _padding1[128];
+	volatile uintptr_t _bottom; /**< index one past the youngest entry, only written by the owner */
+	uint8_t _padding2[128];
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t capacity);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_CopyScanCacheDeque *newInstance(MM_EnvironmentBase *env, uintptr_t capacity);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Push a cache onto the bottom of the deque. Must only be called by the owning thread.
+	 * @param cache[in] the cache to push
+	 * @return true on success, false if the deque is full
+	 */
+	MMINLINE bool
+	push(MM_CopyScanCacheStandard *cache)
+	{
+		uintptr_t bottom = _bottom;
+		if ((bottom - _top) >= _capacity) {
+			return false;
+		}
+		_buffer[bottom & _mask] = cache;
+		/* the entry must be visible before thieves can see the new bottom */
+		MM_AtomicOperations::writeBarrier();
+		_bottom = bottom + 1;
+		return true;
+	}
+
+	/**
+	 * Pop the youngest cache from the bottom of the deque. Must only be called by the owning thread.
+	 * @return the cache, or NULL if the deque is empty (or the last entry was stolen concurrently)
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	pop()
+	{
+		uintptr_t bottom = _bottom;
+		if (bottom == _top) {
+			return NULL;
+		}
+		bottom -= 1;
+		_bottom = bottom;
+		/* publish the reservation of the bottom entry before reading top (store-load ordering) */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t top = _top;
+		MM_CopyScanCacheStandard *cache = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			/* more than one entry, no thief can reach this one */
+			cache = _buffer[bottom & _mask];
+		} else {
+			if (bottom == top) {
+				/* last entry - race against thieves for it */
+				cache = _buffer[bottom & _mask];
+				if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+					cache = NULL;
+				}
+			}
+			/* the deque is empty now, restore the canonical empty state (bottom == top) */
+			_bottom = bottom + 1;
+		}
+		return cache;
+	}
+
+	/**
+	 * Steal the oldest cache from the top of the deque. May be called by any thread.
+	 * @return the cache, or NULL if the deque is empty or another thread won the race for the entry
+	 */
+	MMINLINE MM_CopyScanCacheStandard *
+	steal()
+	{
+		uintptr_t top = _top;
+		/* top has to be read before bottom */
+		MM_AtomicOperations::readWriteBarrier();
+		uintptr_t bottom = _bottom;
+		MM_CopyScanCacheStandard *cache = NULL;
+		if ((intptr_t)(bottom - top) > 0) {
+			MM_AtomicOperations::readBarrier();
+			cache = _buffer[top & _mask];
+			if (top != MM_AtomicOperations::lockCompareExchange(&_top, top, top + 1)) {
+				cache = NULL;
+			}
+		}
+		return cache;
+	}
+
+	/**
+	 * Racy check for entries in the deque, used by idle threads looking for work to steal.
+	 * @return true if the deque appears to contain no entries
+	 */
+	MMINLINE bool
+	isEmpty()
+	{
+		return (intptr_t)(_bottom - _top) <= 0;
+	}
+
+	/**
+	 * Racy count of entries in the deque, meant for heuristics only.
+	 * @return approximate number of entries
+	 */
+	MMINLINE uintptr_t
+	getApproximateEntryCount()
+	{
+		intptr_t count = (intptr_t)(_bottom - _top);
+		return (count > 0) ? (uintptr_t)count : 0;
+	}
+
+	/**
+	 * Create a CopyScanCacheDeque object.
+	 */
+	MM_CopyScanCacheDeque()
+		: MM_BaseVirtual()
+		, _buffer(NULL)
+		, _capacity(0)
+		, _mask(0)
+		, _top(0)
+		, _bottom(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* COPYSCANCACHEDEQUE_HPP_ */
@@ -60,6 +60,7 @@ public:
 	bool _loaAllocation;  /** true, if tenure TLH remainder is in LOA (TODO: try preventing remainder creation in LOA) */
 	void *_survivorTLHRemainderBase; /**< base and top pointers of the last unused survivor TLH copy cache, that might be reused  on next copy refresh */
 	void *_survivorTLHRemainderTop;
+	uintptr_t _hotFieldSampleCountdown; /**< copied references left before the scavenger hot field profiler takes the next sample */
 
 protected:
 
@@ -93,6 +94,7 @@ public:
 		,_loaAllocation(false)
 		,_survivorTLHRemainderBase(NULL)
 		,_survivorTLHRemainderTop(NULL)
+		,_hotFieldSampleCountdown(0)
 	{
 		_typeId = __FUNCTION__;
 	}
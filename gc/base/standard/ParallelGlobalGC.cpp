@@ -27,9 +27,11 @@
 #include "modronbase.h"
 #include "modronopt.h"
 #include "modronapicore.hpp"
+#include "mmprivatehook.h"
 
 #include "AllocateDescription.hpp"
 #include "AllocationFailureStats.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #if defined(OMR_GC_MODRON_COMPACTION)
@@ -44,6 +46,7 @@
 #include "HeapMapIterator.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionIteratorStandard.hpp"
+#include "IdleHeapReleaser.hpp"
 #include "MarkingScheme.hpp"
 #include "MemorySpace.hpp"
 #include "MemorySubSpace.hpp"
@@ -192,9 +195,24 @@ hookGlobalGcSweepEndRsoSafetyFixHeap(J9HookInterface** hook, uintptr_t eventNum,
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(event->currentThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 
-	extensions->scavengerRsoScanUnsafe = !extensions->isRememberedSetInOverflowState();
+	MM_ParallelGlobalGC *pggc = (MM_ParallelGlobalGC *)userData;
+
+	if (extensions->isRememberedSetInCardOverflowState() && !extensions->isRememberedSetInFullOverflowState()) {
+#if defined(OMR_GC_MODRON_COMPACTION)
+		if (pggc->isCompactThisCycle()) {
+			/* Objects recorded by card are about to move, fall back to the overflow walk */
+			extensions->setRememberedSetOverflowState();
+		} else
+#endif /* OMR_GC_MODRON_COMPACTION */
+		{
+			/* Objects recorded by card which died must not be scanned by the next scavenge */
+			extensions->scavenger->retainMarkedRememberedSetCardObjects(env, pggc->getMarkingScheme()->getMarkMap());
+		}
+	}
+
+	/* Objects recorded by card are collected without walking the heap, only the full overflow needs a walkable heap */
+	extensions->scavengerRsoScanUnsafe = !extensions->isRememberedSetInFullOverflowState();
 	if (!extensions->scavengerRsoScanUnsafe) {
-		MM_ParallelGlobalGC *pggc = (MM_ParallelGlobalGC *)userData;
 		pggc->fixHeapForWalk(env, MEMORY_TYPE_OLD_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 	}
 }
@@ -314,6 +332,15 @@ MM_ParallelGlobalGC::initialize(MM_EnvironmentBase *env)
 		goto error_no_memory;
 	}
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (0 != _extensions->idleHeapReleaseInterval) {
+		_idleHeapReleaser = MM_IdleHeapReleaser::newInstance(env, this);
+		if (NULL == _idleHeapReleaser) {
+			goto error_no_memory;
+		}
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+
 	/* Attach to hooks required by the global collector's
 	 * heap resize (expand/contraction) functions
 	 */
@@ -374,6 +401,13 @@ MM_ParallelGlobalGC::tearDown(MM_EnvironmentBase *env)
 	}
 #endif /* OMR_GC_MODRON_COMPACTION */
 
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _idleHeapReleaser) {
+		_idleHeapReleaser->kill(env);
+		_idleHeapReleaser = NULL;
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
+
 	if (NULL != _heapWalker) {
 		_heapWalker->kill(env);
 		_heapWalker = NULL;
@@ -461,6 +495,11 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	markAll(env, initMarkMap);
 
 	_delegate.postMarkProcessing(env);
+
+	if (NULL != _extensions->allocationSiteSampler) {
+		/* before compaction can move the sampled objects */
+		_extensions->allocationSiteSampler->globalMarkComplete(env, _markingScheme->getMarkMap());
+	}
 	
 	sweep(env, allocDescription, rebuildMarkBits);
 
@@ -506,7 +545,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 	 */
 	if (_delegate.isAllowUserHeapWalk() || env->_cycleState->_gcCode.isRASDumpGC()) {
 		if (!_fixHeapForWalkCompleted) {
-#if defined(J9VM_GC_MODRON_COMPACTION)
+#if defined(OMR_GC_MODRON_COMPACTION)
 			if (compactedThisCycle) {
 				OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
 				U_64 startTime = omrtime_hires_clock();
@@ -514,7 +553,7 @@ MM_ParallelGlobalGC::masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_Allo
 				_extensions->globalGCStats.fixHeapForWalkTime = omrtime_hires_delta(startTime, omrtime_hires_clock(), OMRPORT_TIME_DELTA_IN_MICROSECONDS);
 				_extensions->globalGCStats.fixHeapForWalkReason = FIXUP_DEBUG_TOOLING;
 			} else
-#endif /* J9VM_GC_MODRON_COMPACTION */
+#endif /* OMR_GC_MODRON_COMPACTION */
 			{
 				fixHeapForWalk(env, MEMORY_TYPE_RAM, FIXUP_DEBUG_TOOLING, fixObject);
 			}
@@ -684,6 +723,12 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		
 		/* Compaction trigger is a multiple of the minimum tlh size */
 		uintptr_t compaction_trigger_avgtlh= _extensions->tlhMinimumSize * MINIMUM_TLHSIZE_MULTIPLIER;
+		if (_extensions->tlhAdaptiveSizing) {
+			/* Slow allocating threads request small TLHs, only TLHs much smaller than requested are a sign of fragmentation */
+			uintptr_t refreshCount = allocStats->_tlhRefreshCountFresh + allocStats->_tlhRefreshCountReused;
+			uintptr_t avgRequestedTlh = allocStats->_tlhRequestedBytes / refreshCount;
+			compaction_trigger_avgtlh = OMR_MIN(compaction_trigger_avgtlh, avgRequestedTlh / 2);
+		}
 		if(avgTlh < compaction_trigger_avgtlh) {
 			compactReason = COMPACT_FRAGMENTED;
 			goto compactionReqd;
@@ -720,7 +765,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 	{
 		MM_MemoryPool *memoryPool= _extensions->heap->getDefaultMemorySpace()->getTenureMemorySubSpace()->getMemoryPool();
 		uintptr_t darkMatterBytes = 0;
-		if (!_extensions->concurrentSweep) {
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatterBytes = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t freeMemorySize = memoryPool->getActualFreeMemorySize();
@@ -745,7 +790,7 @@ MM_ParallelGlobalGC::shouldCompactThisCycle(MM_EnvironmentBase *env, MM_Allocate
 		uintptr_t reusableFreeMemory = stats->getPageAlignedFreeMemory(pageSize);
 
 		uintptr_t darkMatter = 0;
-		if (!_extensions->concurrentSweep){
+		if (!_extensions->isConcurrentSweepEnabled()) {
 			darkMatter = memoryPool->getDarkMatterBytes();
 		}
 		uintptr_t memoryFragmentationDiff = freeMemory - reusableFreeMemory;
@@ -1082,6 +1127,31 @@ MM_ParallelGlobalGC::tenureMemoryPoolPostCollect(MM_EnvironmentBase *env)
 		/* resize LOA only when the sweep is completed (to avoid concurrent sweep's confusion due to the resize) */
 		MM_MemoryPoolLargeObjects *memoryPool = (MM_MemoryPoolLargeObjects *) tenureMemorySubspace->getMemoryPool();
 		memoryPool->resizeLOA(env);
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		if (_extensions->largeObjectAreaReleaseFreePages) {
+			/* large objects die in multi-page extents: hand their pages back instead of keeping them resident until reused */
+			OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+			uint64_t startTime = omrtime_hires_clock();
+			uintptr_t releasedBytes = memoryPool->releaseLOAFreeMemoryPages(env);
+			uint64_t endTime = omrtime_hires_clock();
+			Trc_MM_ParallelGlobalGC_tenureMemoryPoolPostCollect_releasedLOAPages(env->getLanguageVMThread(), releasedBytes);
+
+			TRIGGER_J9HOOK_MM_PRIVATE_HEAP_RESIZE(
+				_extensions->privateHookInterface,
+				env->getOmrVMThread(),
+				endTime,
+				J9HOOK_MM_PRIVATE_HEAP_RESIZE,
+				HEAP_RELEASE_FREE_PAGES,
+				tenureMemorySubspace->getTypeFlags(),
+				/* GC Time Ratio not applicable for "release free heap pages" */
+				0,
+				releasedBytes,
+				tenureMemorySubspace->getActiveMemorySize(),
+				omrtime_hires_delta(startTime, endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS),
+				/* reason enum variable not applicable/used, so passing univeral value 1 = not found*/
+				1);
+		}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	}
 }
 
@@ -1314,6 +1384,15 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	}
 #endif /* defined(OMR_GC_OBJECT_MAP) */
 
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_extensions->scavengerEnabled && (NULL != _extensions->scavenger)) {
+		result = _extensions->scavenger->rememberedSetHeapAddRange(env, size, lowAddress, highAddress);
+		if (0 == result) {
+			goto scavenger_failed_heapAddRange;
+		}
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
 	result = _delegate.heapAddRange(env, subspace, size, lowAddress, highAddress);
 	if (0 == result) {
 		goto parallelGlobalGC_failed_heapAddRange;
@@ -1322,6 +1401,12 @@ MM_ParallelGlobalGC::heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *su
 	return true;
 
 parallelGlobalGC_failed_heapAddRange:
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_extensions->scavengerEnabled && (NULL != _extensions->scavenger)) {
+		_extensions->scavenger->rememberedSetHeapRemoveRange(env, size, lowAddress, highAddress, NULL, NULL);
+	}
+scavenger_failed_heapAddRange:
+#endif /* OMR_GC_MODRON_SCAVENGER */
 #if defined(OMR_GC_OBJECT_MAP)
 	_extensions->getObjectMap()->heapRemoveRange(env, subspace, size, lowAddress, highAddress, NULL, NULL);
 objectMap_failed_heapAddRange:
@@ -1342,6 +1427,11 @@ MM_ParallelGlobalGC::heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace
 {
 	bool result = _markingScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 	result = result && _sweepScheme->heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+#if defined(OMR_GC_MODRON_SCAVENGER)
+	if (_extensions->scavengerEnabled && (NULL != _extensions->scavenger)) {
+		result = result && _extensions->scavenger->rememberedSetHeapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+#endif /* OMR_GC_MODRON_SCAVENGER */
 
 	result = result && _delegate.heapRemoveRange(env, subspace, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
 
@@ -1366,12 +1456,22 @@ MM_ParallelGlobalGC::collectorStartup(MM_GCExtensionsBase* extensions)
 		extensions->scavenger->collectorStartup(extensions);
 	}
 #endif /* defined(OMR_GC_MODRON_SCAVENGER) */
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if ((NULL != _idleHeapReleaser) && !_idleHeapReleaser->startup()) {
+		return false;
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	return true;
 }
 
 void
 MM_ParallelGlobalGC::collectorShutdown(MM_GCExtensionsBase *extensions)
 {
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	if (NULL != _idleHeapReleaser) {
+		_idleHeapReleaser->shutdown();
+	}
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 #if defined(OMR_GC_MODRON_SCAVENGER)
 	if (extensions->scavengerEnabled && (NULL != extensions->scavenger)) {
 		extensions->scavenger->collectorShutdown(extensions);
@@ -49,6 +49,9 @@ void healReferenceSlots(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *regi
 
 class MM_CollectionStatisticsStandard;
 class MM_CompactScheme;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+class MM_IdleHeapReleaser;
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 class MM_Dispatcher;
 class MM_MarkingScheme;
 class MM_MemorySubSpace;
@@ -80,6 +83,9 @@ protected:
 	MM_CycleState _cycleState;  /**< Embedded cycle state to be used as the master cycle state for GC activity */
 	MM_CollectionStatisticsStandard _collectionStatistics; /** Common collect stats (memory, time etc.) */
 	bool _fixHeapForWalkCompleted;
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+	MM_IdleHeapReleaser *_idleHeapReleaser; /**< Background thread releasing the free pages of an idle heap, allocated only if idleHeapReleaseInterval is set */
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 public:
 	
 /*
@@ -321,6 +327,11 @@ public:
 	getCompactScheme(MM_EnvironmentBase *env) {
 		return _compactScheme;
 	}
+
+	/**
+	 * Return true if the current global collect decided to compact (valid once sweep completed)
+	 */
+	MMINLINE bool isCompactThisCycle() { return _compactThisCycle; }
 #endif /* OMR_GC_MODRON_COMPACTION */
 
 	virtual void completeExternalConcurrentCycle(MM_EnvironmentBase *env);
@@ -340,6 +351,9 @@ public:
 		, _cycleState()
 		, _collectionStatistics()
 		, _fixHeapForWalkCompleted(false)
+#if defined(OMR_GC_IDLE_HEAP_MANAGER)
+		, _idleHeapReleaser(NULL)
+#endif /* OMR_GC_IDLE_HEAP_MANAGER */
 	{
 		_typeId = __FUNCTION__;
 	}
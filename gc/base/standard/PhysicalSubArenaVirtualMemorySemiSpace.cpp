@@ -36,7 +36,9 @@
 #include "Heap.hpp"
 #include "HeapRegionDescriptorStandard.hpp"
 #include "HeapRegionManager.hpp"
+#include "HeapVirtualMemory.hpp"
 #include "HeapWalker.hpp"
+#include "MemoryManager.hpp"
 #include "MemorySubSpace.hpp"
 #include "MemorySubSpaceSemiSpace.hpp"
 #include "ParallelGlobalGC.hpp"
@@ -193,6 +195,7 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::inflate(MM_EnvironmentBase *env)
 		subSpaceAllocate->heapReconfigured(env);
 		result = result && subSpaceSurvivor->expanded(env, this, _lowSemiSpaceRegion->getSize(), _lowSemiSpaceRegion->getLowAddress(), _lowSemiSpaceRegion->getHighAddress(), false);
 		subSpaceSurvivor->heapReconfigured(env);
+		bindNumaSlices(env);
 		return result;
 	}
 	return false;
@@ -896,6 +899,8 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::contract(MM_EnvironmentBase *env, uin
 	Assert_MM_true(_lowAddress == _lowSemiSpaceRegion->getLowAddress());
 	Assert_MM_true(_highAddress == _highSemiSpaceRegion->getHighAddress());
 
+	bindNumaSlices(env);
+
 	return totalContractSize;
 }
 
@@ -1354,9 +1359,41 @@ MM_PhysicalSubArenaVirtualMemorySemiSpace::expandNoCheck(MM_EnvironmentBase *env
 	Assert_MM_true(_lowAddress == (void *)_lowSemiSpaceRegion->getLowAddress());
 	Assert_MM_true(_highAddress == (void *)_highSemiSpaceRegion->getHighAddress());
 
+	bindNumaSlices(env);
+
 	return splitExpandSize;
 }
 
+/**
+ * Bind the slices of both semispaces to the NUMA nodes of the affinity leaders they belong to, so that
+ * TLHs and survivor copy caches allocated from a thread's slice are backed by memory local to the thread.
+ * The slices move whenever the semispaces are resized, so they are bound again after every resize.
+ */
+void
+MM_PhysicalSubArenaVirtualMemorySemiSpace::bindNumaSlices(MM_EnvironmentBase *env)
+{
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	MM_NUMAManager *numaManager = &extensions->_numaManager;
+
+	if (extensions->numaAwareNursery && numaManager->isPhysicalNUMASupported()) {
+		uintptr_t leaderCount = 0;
+		J9MemoryNodeDetail const *leaders = numaManager->getAffinityLeaders(&leaderCount);
+		MM_HeapRegionDescriptor *semiSpaceRegions[] = { _lowSemiSpaceRegion, _highSemiSpaceRegion };
+
+		for (uintptr_t regionIndex = 0; regionIndex < 2; regionIndex++) {
+			MM_HeapRegionDescriptor *region = semiSpaceRegions[regionIndex];
+			for (uintptr_t node = 1; node <= leaderCount; node++) {
+				void *sliceBase = NULL;
+				void *sliceTop = NULL;
+				if (numaManager->getAffinityLeaderSlice(node, region->getLowAddress(), region->getHighAddress(), _heap->getPageSize(), &sliceBase, &sliceTop)) {
+					/* binding is only a placement hint - memory left unbound is still usable */
+					extensions->memoryManager->setNumaAffinity(((MM_HeapVirtualMemory *)_heap)->getVmemHandle(), leaders[node - 1].j9NodeNumber, sliceBase, (uintptr_t)sliceTop - (uintptr_t)sliceBase);
+				}
+			}
+		}
+	}
+}
+
 /**
  * Split and reduce the expansion request to meet allocate and survivor space restrictions.
  * Given the expand value (that is rounded to proper alignment), calculate the actual allocate and
@@ -44,6 +44,7 @@ private:
 	bool _avoidMovingObjects; /**< VMDESIGN 1690: avoid moving objects during contract where possible */
 
 	uintptr_t calculateExpansionSplit(MM_EnvironmentBase *env, uintptr_t requestExpandSize, uintptr_t *allocateSpaceSize, uintptr_t *survivorSpaceSize);
+	void bindNumaSlices(MM_EnvironmentBase *env);
 
 protected:
 	MM_HeapRegionDescriptor *_lowSemiSpaceRegion;
@@ -0,0 +1,242 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "Bits.hpp"
+#include "Heap.hpp"
+#include "HeapRegionManager.hpp"
+#include "MarkMap.hpp"
+#include "ModronAssertions.h"
+#include "RSCardOverflow.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* initial number of entries of the collected object array, it doubles as required */
+#define RS_CARD_OVERFLOW_INITIAL_OBJECT_CAPACITY 1024
+
+MM_RSCardOverflow *
+MM_RSCardOverflow::newInstance(MM_EnvironmentBase *env)
+{
+	MM_RSCardOverflow *overflow = (MM_RSCardOverflow *)env->getForge()->allocate(sizeof(MM_RSCardOverflow), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != overflow) {
+		new(overflow) MM_RSCardOverflow(env);
+		if (!overflow->initialize(env)) {
+			overflow->kill(env);
+			overflow = NULL;
+		}
+	}
+	return overflow;
+}
+
+void
+MM_RSCardOverflow::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_RSCardOverflow::initialize(MM_EnvironmentBase *env)
+{
+	/* cards cover the whole reserved heap, so the summary never has to follow heap expansion */
+	_heapBase = (uintptr_t)_extensions->heap->getHeapBase();
+	_heapTop = (uintptr_t)_extensions->heap->getHeapTop();
+	/* the object map slots of a card must not be shared with the next card */
+	Assert_MM_true(0 == (RS_CARD_OVERFLOW_CARD_SIZE % J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT));
+
+	_objectMap = MM_MarkMap::newInstance(env, _extensions->heap->getMaximumPhysicalRange());
+	if (NULL == _objectMap) {
+		return false;
+	}
+
+	_cardCount = ((_heapTop - _heapBase) + RS_CARD_OVERFLOW_CARD_SIZE - 1) >> RS_CARD_OVERFLOW_CARD_SIZE_SHIFT;
+	_summaryWordCount = (_cardCount + RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD - 1) / RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD;
+
+	_summary = (volatile uintptr_t *)env->getForge()->allocate(sizeof(uintptr_t) * _summaryWordCount, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == _summary) {
+		return false;
+	}
+	memset((void *)_summary, 0, sizeof(uintptr_t) * _summaryWordCount);
+
+	return true;
+}
+
+void
+MM_RSCardOverflow::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _objectMap) {
+		_objectMap->kill(env);
+		_objectMap = NULL;
+	}
+	if (NULL != _summary) {
+		env->getForge()->free((void *)_summary);
+		_summary = NULL;
+	}
+	if (NULL != _objects) {
+		env->getForge()->free(_objects);
+		_objects = NULL;
+	}
+}
+
+bool
+MM_RSCardOverflow::heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	return _objectMap->heapAddRange(env, size, lowAddress, highAddress);
+}
+
+bool
+MM_RSCardOverflow::heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	/* the range holds no live object, but dead ones may still be recorded */
+	_objectMap->setBitsInRange(env, lowAddress, highAddress, true);
+	return _objectMap->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+}
+
+bool
+MM_RSCardOverflow::growObjects(MM_EnvironmentBase *env)
+{
+	uintptr_t newCapacity = (0 == _objectCapacity) ? RS_CARD_OVERFLOW_INITIAL_OBJECT_CAPACITY : (_objectCapacity * 2);
+	omrobjectptr_t *newObjects = (omrobjectptr_t *)env->getForge()->allocate(sizeof(omrobjectptr_t) * newCapacity, OMR::GC::AllocationCategory::REMEMBERED_SET, OMR_GET_CALLSITE());
+	if (NULL == newObjects) {
+		return false;
+	}
+	if (NULL != _objects) {
+		memcpy(newObjects, _objects, sizeof(omrobjectptr_t) * _objectCount);
+		env->getForge()->free(_objects);
+	}
+	_objects = newObjects;
+	_objectCapacity = newCapacity;
+	return true;
+}
+
+void
+MM_RSCardOverflow::clearCard(MM_EnvironmentBase *env, uintptr_t cardIndex)
+{
+	uintptr_t slotIndex = _objectMap->getSlotIndex((omrobjectptr_t)getCardBase(cardIndex));
+	for (uintptr_t slot = 0; slot < RS_CARD_OVERFLOW_MAP_SLOTS_PER_CARD; slot++) {
+		_objectMap->setSlot(slotIndex + slot, 0);
+	}
+}
+
+bool
+MM_RSCardOverflow::collectObjects(MM_EnvironmentBase *env)
+{
+	bool result = true;
+	_objectCount = 0;
+
+	for (uintptr_t summaryIndex = 0; summaryIndex < _summaryWordCount; summaryIndex++) {
+		uintptr_t summaryWord = _summary[summaryIndex];
+		if (0 == summaryWord) {
+			continue;
+		}
+		_summary[summaryIndex] = 0;
+
+		while (0 != summaryWord) {
+			uintptr_t bit = MM_Bits::leadingZeroes(summaryWord);
+			summaryWord &= summaryWord - 1;
+			uintptr_t cardIndex = (summaryIndex * RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD) + bit;
+			uintptr_t cardBase = getCardBase(cardIndex);
+			uintptr_t slotIndex = _objectMap->getSlotIndex((omrobjectptr_t)cardBase);
+
+			for (uintptr_t slot = 0; slot < RS_CARD_OVERFLOW_MAP_SLOTS_PER_CARD; slot++) {
+				uintptr_t slotValue = _objectMap->getSlot(slotIndex + slot);
+				if (0 == slotValue) {
+					continue;
+				}
+				/* keep clearing the cards once collection has failed */
+				_objectMap->setSlot(slotIndex + slot, 0);
+				uintptr_t slotBase = cardBase + (slot * J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT);
+				while (result && (0 != slotValue)) {
+					omrobjectptr_t objectPtr = (omrobjectptr_t)(slotBase + (MM_Bits::leadingZeroes(slotValue) * J9MODRON_HEAP_BYTES_PER_HEAPMAP_BIT));
+					slotValue &= slotValue - 1;
+					/* an object may have been unremembered since it was recorded */
+					if (_extensions->objectModel.isRemembered(objectPtr)) {
+						if ((_objectCount == _objectCapacity) && !growObjects(env)) {
+							result = false;
+							break;
+						}
+						_objects[_objectCount] = objectPtr;
+						_objectCount += 1;
+					}
+				}
+			}
+		}
+	}
+
+	if (!result) {
+		_objectCount = 0;
+	}
+	return result;
+}
+
+void
+MM_RSCardOverflow::retainMarkedObjects(MM_EnvironmentBase *env, MM_MarkMap *markMap)
+{
+	/* both maps cover the heap from its base with the same geometry, so they are combined slot by slot */
+	Assert_MM_true(markMap->getHeapBase() == _objectMap->getHeapBase());
+
+	for (uintptr_t summaryIndex = 0; summaryIndex < _summaryWordCount; summaryIndex++) {
+		uintptr_t summaryWord = _summary[summaryIndex];
+		while (0 != summaryWord) {
+			uintptr_t bit = MM_Bits::leadingZeroes(summaryWord);
+			summaryWord &= summaryWord - 1;
+			uintptr_t cardIndex = (summaryIndex * RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD) + bit;
+			uintptr_t slotIndex = _objectMap->getSlotIndex((omrobjectptr_t)getCardBase(cardIndex));
+
+			uintptr_t retained = 0;
+			for (uintptr_t slot = 0; slot < RS_CARD_OVERFLOW_MAP_SLOTS_PER_CARD; slot++) {
+				uintptr_t slotValue = _objectMap->getSlot(slotIndex + slot);
+				if (0 != slotValue) {
+					slotValue &= markMap->getSlot(slotIndex + slot);
+					_objectMap->setSlot(slotIndex + slot, slotValue);
+					retained |= slotValue;
+				}
+			}
+			if (0 == retained) {
+				_summary[summaryIndex] &= ~((uintptr_t)1 << bit);
+			}
+		}
+	}
+}
+
+void
+MM_RSCardOverflow::clear(MM_EnvironmentBase *env)
+{
+	for (uintptr_t summaryIndex = 0; summaryIndex < _summaryWordCount; summaryIndex++) {
+		uintptr_t summaryWord = _summary[summaryIndex];
+		if (0 != summaryWord) {
+			_summary[summaryIndex] = 0;
+			while (0 != summaryWord) {
+				uintptr_t bit = MM_Bits::leadingZeroes(summaryWord);
+				summaryWord &= summaryWord - 1;
+				clearCard(env, (summaryIndex * RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD) + bit);
+			}
+		}
+	}
+	_objectCount = 0;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,189 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(RSCARDOVERFLOW_HPP_)
+#define RSCARDOVERFLOW_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+#include "ModronAssertions.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+#include "HeapMap.hpp"
+#include "MarkMap.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#define RS_CARD_OVERFLOW_CARD_SIZE_SHIFT 12
+#define RS_CARD_OVERFLOW_CARD_SIZE ((uintptr_t)1 << RS_CARD_OVERFLOW_CARD_SIZE_SHIFT)
+#define RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD (sizeof(uintptr_t) * 8)
+#define RS_CARD_OVERFLOW_MAP_SLOTS_PER_CARD (RS_CARD_OVERFLOW_CARD_SIZE / J9MODRON_HEAP_BYTES_PER_HEAPMAP_SLOT)
+
+/**
+ * Card granular remembered set overflow.
+ * Remembered objects which do not fit into the remembered set (MM_SublistPool) are recorded by the
+ * card of the heap they are in, instead of switching the remembered set into the global overflow state
+ * that has to be recovered by walking all of tenure space. Each recorded object sets its bit in an object map
+ * (one bit per object grain, like the mark map), and a summary bitmap (one bit per card) makes finding the recorded
+ * cards proportional to the number of overflowed objects rather than to the heap size.
+ *
+ * Since the object map holds exact object starts, collecting the recorded objects never walks the heap, so it does
+ * not depend on the heap being walkable. A global collect drops the recorded objects which died with #retainMarkedObjects().
+ *
+ * Objects are recorded concurrently (by mutators and GC threads), while the recorded cards are only collected
+ * by the master thread at the start of a scavenge.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_RSCardOverflow : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions; /**< GC Extensions */
+	uintptr_t _heapBase; /**< lowest address covered by the cards */
+	uintptr_t _heapTop; /**< address following the highest address covered by the cards */
+	MM_MarkMap *_objectMap; /**< one bit per recorded object, committed with the heap */
+	volatile uintptr_t *_summary; /**< one bit per card, set if the card records an object */
+	uintptr_t _cardCount; /**< number of cards covering the heap */
+	uintptr_t _summaryWordCount; /**< number of entries in _summary */
+	omrobjectptr_t *_objects; /**< remembered objects found in the recorded cards by the last #collectObjects() */
+	uintptr_t _objectCount; /**< number of valid entries in _objects */
+	uintptr_t _objectCapacity; /**< number of entries _objects can hold */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	bool growObjects(MM_EnvironmentBase *env);
+
+	MMINLINE uintptr_t getCardBase(uintptr_t cardIndex) { return _heapBase + (cardIndex << RS_CARD_OVERFLOW_CARD_SIZE_SHIFT); }
+
+	/**
+	 * Clear the object map bits of a card.
+	 */
+	void clearCard(MM_EnvironmentBase *env, uintptr_t cardIndex);
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_RSCardOverflow *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Commit the object map for a range added to the heap.
+	 * @see MM_HeapMap::heapAddRange()
+	 */
+	bool heapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress);
+
+	/**
+	 * Forget the objects recorded in a range removed from the heap and decommit its object map.
+	 * @see MM_HeapMap::heapRemoveRange()
+	 */
+	bool heapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Record a remembered object which could not be added to the remembered set.
+	 * May be called concurrently by any thread.
+	 * @param objectPtr[in] a remembered (tenured) object
+	 */
+	MMINLINE void
+	addObject(omrobjectptr_t objectPtr)
+	{
+		uintptr_t heapOffset = (uintptr_t)objectPtr - _heapBase;
+		Assert_MM_true(heapOffset < (_heapTop - _heapBase));
+
+		if (_objectMap->atomicSetBit(objectPtr)) {
+			uintptr_t cardIndex = heapOffset >> RS_CARD_OVERFLOW_CARD_SIZE_SHIFT;
+			uintptr_t bit = (uintptr_t)1 << (cardIndex % RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD);
+			volatile uintptr_t *summaryWord = _summary + (cardIndex / RS_CARD_OVERFLOW_BITS_PER_SUMMARY_WORD);
+			if (0 == (*summaryWord & bit)) {
+				MM_AtomicOperations::bitOr(summaryWord, bit);
+			}
+		}
+	}
+
+	/**
+	 * Collect every remembered object recorded in the cards into the array returned by #getObjects(),
+	 * reading only the object map of the recorded cards. The cards are cleared.
+	 * Must only be called by the master thread while no object can be recorded.
+	 * @return true on success, false if the objects could not be collected (the cards are still cleared)
+	 */
+	bool collectObjects(MM_EnvironmentBase *env);
+
+	/**
+	 * Drop the recorded objects which are not marked, so that only live objects are collected by the next scavenge.
+	 * Must be called by a global collect after marking completed and before any object is moved.
+	 * @param markMap[in] the mark map of the global collect
+	 */
+	void retainMarkedObjects(MM_EnvironmentBase *env, MM_MarkMap *markMap);
+
+	/**
+	 * Clear all recorded cards and forget the collected objects.
+	 * Must not be called concurrently with #addObject().
+	 */
+	void clear(MM_EnvironmentBase *env);
+
+	/**
+	 * Forget the collected objects (the cards are untouched).
+	 */
+	MMINLINE void clearObjects() { _objectCount = 0; }
+
+	MMINLINE omrobjectptr_t *getObjects() { return _objects; }
+	MMINLINE uintptr_t getObjectCount() { return _objectCount; }
+
+	/**
+	 * Create a RSCardOverflow object.
+	 */
+	MM_RSCardOverflow(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _heapBase(0)
+		, _heapTop(0)
+		, _objectMap(NULL)
+		, _summary(NULL)
+		, _cardCount(0)
+		, _summaryWordCount(0)
+		, _objects(NULL)
+		, _objectCount(0)
+		, _objectCapacity(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* RSCARDOVERFLOW_HPP_ */
@@ -46,10 +46,12 @@
 #if defined(OMR_GC_MODRON_SCAVENGER)
 
 #include "AllocateDescription.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "AtomicOperations.hpp"
 #include "CollectionStatisticsStandard.hpp"
 #include "CollectorLanguageInterface.hpp"
 #include "ConcurrentScavengeTask.hpp"
+#include "ConcurrentScavengerModeController.hpp"
 #include "ConfigurationStandard.hpp"
 #include "CycleState.hpp"
 #include "Dispatcher.hpp"
@@ -76,9 +78,11 @@
 #include "OMRVMThreadListIterator.hpp"
 #include "ParallelScavengeTask.hpp"
 #include "PhysicalSubArena.hpp"
+#include "RSCardOverflow.hpp"
 #include "RSOverflow.hpp"
 #include "Scavenger.hpp"
 #include "ScavengerBackOutScanner.hpp"
+#include "ScavengerPauseController.hpp"
 #include "ScavengerRootScanner.hpp"
 #include "ScavengerStats.hpp"
 #include "SlotObject.hpp"
@@ -116,6 +120,22 @@
 #define CACHE_LINE_SIZE 64
 #endif
 
+/* layout of _stealingScanState: _doneIndex of the scan loop in the high bits, count of idle threads in the low bits */
+#define STEALING_IDLE_COUNT_BITS 16
+#define STEALING_IDLE_COUNT_MASK ((((uintptr_t)1) << STEALING_IDLE_COUNT_BITS) - 1)
+#define STEALING_SCAN_STATE(doneIndex) (((uintptr_t)(doneIndex)) << STEALING_IDLE_COUNT_BITS)
+/* number of CPU yields an idle thread spins for before yielding its time slice */
+#define STEALING_IDLE_SPIN_COUNT 64
+
+/* number of types the hot field profiler can track (power of two) */
+#define SCAVENGER_HOT_FIELD_PROFILE_TABLE_SIZE 4096
+
+/* number of remembered set entries to look ahead when prefetching remembered object headers */
+#define SCAVENGER_REMEMBERED_SET_PREFETCH_DISTANCE 8
+
+/* work (in bytes of copying) a remembered object is assumed to cost when sizing a scavenge */
+#define SCAVENGER_REMEMBERED_OBJECT_WORK 64
+
 /* create macros to interpret the hot field descriptor */
 #define HOTFIELD_SHOULD_ALIGN(descriptor) (0x1 == (0x1 & (descriptor)))
 #define HOTFIELD_ALIGNMENT_BIAS(descriptor, heapObjectAlignment) (((descriptor) >> 1) * (heapObjectAlignment))
@@ -279,15 +299,84 @@ MM_Scavenger::initialize(MM_EnvironmentBase *env)
 	}
 
 	_cacheLineAlignment = CACHE_LINE_SIZE;
+	_objectCopy.initialize(_extensions->scavengerNonTemporalCopyThreshold);
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	if (_extensions->concurrentScavenger) {
 		if (!_masterGCThread.initialize(this, true, true, true)) {
 			return false;
 		}
+		/* mutator threads release caches to the scan list during the concurrent phase, they do not own deques */
+		_extensions->scavengerWorkStealing = false;
+		/* hot fields are copied without the read barrier protocol of the concurrent phase */
+		_extensions->scavengerHotFieldProfiling = false;
+		/* the concurrent phase scans the remembered set with its own (direct/indirect) protocol */
+		_extensions->scavengerRememberedSetBatching = false;
+		_extensions->scavengerRememberedSetCardOverflow = false;
+
+		/* with hardware support the read barrier costs nothing to compare stop-the-world cycles with */
+		if (_extensions->concurrentScavengerAdaptive && !_extensions->concurrentScavengerHWSupport) {
+			_modeController = MM_ConcurrentScavengerModeController::newInstance(env);
+			if (NULL == _modeController) {
+				return false;
+			}
+		}
 	}
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+	if (_extensions->scavengerWorkStealing) {
+		uintptr_t dequeSize = 1;
+		while (dequeSize < _extensions->scavengerWorkStealingDequeSize) {
+			dequeSize <<= 1;
+		}
+		_extensions->scavengerWorkStealingDequeSize = dequeSize;
+
+		_scanCacheDequeCount = _dispatcher->threadCountMaximum();
+		_scanCacheDeques = (MM_CopyScanCacheDeque **)env->getForge()->allocate(sizeof(MM_CopyScanCacheDeque *) * _scanCacheDequeCount, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+		if (NULL == _scanCacheDeques) {
+			return false;
+		}
+		memset(_scanCacheDeques, 0, sizeof(MM_CopyScanCacheDeque *) * _scanCacheDequeCount);
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			_scanCacheDeques[i] = MM_CopyScanCacheDeque::newInstance(env, dequeSize);
+			if (NULL == _scanCacheDeques[i]) {
+				return false;
+			}
+		}
+	}
+
+	if (_extensions->scavengerHotFieldProfiling) {
+		if (0 == _extensions->scavengerHotFieldSampleRate) {
+			_extensions->scavengerHotFieldSampleRate = 1;
+		}
+		_hotFieldProfile = MM_ScavengerHotFieldProfile::newInstance(env, SCAVENGER_HOT_FIELD_PROFILE_TABLE_SIZE);
+		if (NULL == _hotFieldProfile) {
+			return false;
+		}
+	}
+
+	if (0 == _extensions->scavengerRememberedSetBatchSize) {
+		_extensions->scavengerRememberedSetBatchSize = 1;
+	}
+
+	if (0 != _extensions->fvtest_rememberedSetMaxSize) {
+		_extensions->rememberedSet.setMaxSize(_extensions->fvtest_rememberedSetMaxSize);
+	}
+
+	if (_extensions->scavengerRememberedSetCardOverflow) {
+		_rsCardOverflow = MM_RSCardOverflow::newInstance(env);
+		if (NULL == _rsCardOverflow) {
+			return false;
+		}
+	}
+
+	if (0 != _extensions->scavengerPauseTarget) {
+		_pauseController = MM_ScavengerPauseController::newInstance(env);
+		if (NULL == _pauseController) {
+			return false;
+		}
+	}
+
 	if (!_delegate.initialize(env)) {
 		return false;
 	}
@@ -303,6 +392,38 @@ MM_Scavenger::tearDown(MM_EnvironmentBase *env)
 	_scavengeCacheFreeList.tearDown(env);
 	_scavengeCacheScanList.tearDown(env);
 
+	if (NULL != _scanCacheDeques) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			if (NULL != _scanCacheDeques[i]) {
+				_scanCacheDeques[i]->kill(env);
+			}
+		}
+		env->getForge()->free(_scanCacheDeques);
+		_scanCacheDeques = NULL;
+	}
+
+	if (NULL != _hotFieldProfile) {
+		_hotFieldProfile->kill(env);
+		_hotFieldProfile = NULL;
+	}
+
+	if (NULL != _rsCardOverflow) {
+		_rsCardOverflow->kill(env);
+		_rsCardOverflow = NULL;
+	}
+
+	if (NULL != _pauseController) {
+		_pauseController->kill(env);
+		_pauseController = NULL;
+	}
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (NULL != _modeController) {
+		_modeController->kill(env);
+		_modeController = NULL;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
 	if (NULL != _scanCacheMonitor) {
 		omrthread_monitor_destroy(_scanCacheMonitor);
 		_scanCacheMonitor = NULL;
@@ -368,6 +489,7 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_rescanThreadsForRememberedObjects = false;
 
 	_doneIndex = 0;
+	_stealingScanState = STEALING_SCAN_STATE(0);
 
 	restoreMasterThreadTenureTLHRemainders(env);
 
@@ -436,9 +558,60 @@ MM_Scavenger::masterSetupForGC(MM_EnvironmentStandard *env)
 	_activeSubSpace->cacheRanges(_evacuateMemorySubSpace, &_evacuateSpaceBase, &_evacuateSpaceTop);
 	_activeSubSpace->cacheRanges(_survivorMemorySubSpace, &_survivorSpaceBase, &_survivorSpaceTop);
 
+	if (NULL != _rsCardOverflow) {
+		masterSetupRememberedSetCardOverflow(env);
+	}
+
 	/* assume that value of RS Overflow flag will not be changed until scavengeRememberedSet() call, so handle it first */
 	_isRememberedSetInOverflowAtTheBeginning = isRememberedSetInOverflowState();
 	_extensions->rememberedSet.startProcessingSublist();
+
+	if (_extensions->scavengerRememberedSetBatching) {
+		masterSetupRememberedSetBatches(env);
+	}
+}
+
+void
+MM_Scavenger::masterSetupRememberedSetCardOverflow(MM_EnvironmentStandard *env)
+{
+	if (_extensions->isRememberedSetInFullOverflowState()) {
+		/* the overflow scan finds every remembered object, including those recorded by card */
+		_rsCardOverflow->clear(env);
+	} else if (_extensions->isRememberedSetInCardOverflowState()) {
+		/* Collecting reads the object map only, it does not depend on the heap being walkable */
+		if (!_rsCardOverflow->collectObjects(env)) {
+			_rsCardOverflow->clear(env);
+			setRememberedSetOverflowState();
+		}
+	} else {
+		_rsCardOverflow->clearObjects();
+	}
+	_extensions->clearRememberedSetCardOverflowState();
+
+	uintptr_t batchSize = _extensions->scavengerRememberedSetBatchSize;
+	_rememberedSetCardObjectBatchCount = (_rsCardOverflow->getObjectCount() + batchSize - 1) / batchSize;
+	_rememberedSetCardObjectBatchNext = 0;
+}
+
+void
+MM_Scavenger::masterSetupRememberedSetBatches(MM_EnvironmentStandard *env)
+{
+	uintptr_t batchSize = _extensions->scavengerRememberedSetBatchSize;
+	uintptr_t batchCount = 0;
+	if (!_isRememberedSetInOverflowAtTheBeginning) {
+		MM_SublistPuddle *puddle = _extensions->rememberedSet.getPreviousList();
+		while (NULL != puddle) {
+			batchCount += (puddle->consumedElementCount() + batchSize - 1) / batchSize;
+			puddle = puddle->getNext();
+		}
+		if (0 == batchCount) {
+			/* nothing to scan, no thread would complete a batch and return the (empty) puddles */
+			_extensions->rememberedSet.returnPreviousPuddles();
+		}
+	}
+	_rememberedSetBatchCount = batchCount;
+	_rememberedSetBatchNext = 0;
+	_rememberedSetBatchDone = 0;
 }
 
 void
@@ -469,6 +642,20 @@ MM_Scavenger::workerSetupForGC(MM_EnvironmentStandard *env)
 	Assert_MM_true(NULL == env->_survivorTLHRemainderTop);
 }
 
+uintptr_t
+MM_Scavenger::calculateThreadCountForScavenge(MM_EnvironmentStandard *env, uintptr_t evacuateOccupancy)
+{
+	uintptr_t threadCount = UDATA_MAX;
+	uintptr_t workPerThread = _extensions->scavengerWorkPerThread;
+	if (0 != workPerThread) {
+		/* the objects expected to survive are copied and scanned, remembered objects are scanned */
+		uintptr_t expectedWork = (uintptr_t)((double)evacuateOccupancy * _expectedSurvivalRate);
+		expectedWork += _extensions->rememberedSet.countElements() * SCAVENGER_REMEMBERED_OBJECT_WORK;
+		threadCount = OMR_MAX((expectedWork + workPerThread - 1) / workPerThread, 1);
+	}
+	return threadCount;
+}
+
 /**
  * Run a scavenge.
  */
@@ -477,7 +664,22 @@ MM_Scavenger::scavenge(MM_EnvironmentBase *envBase)
 {
 	MM_EnvironmentStandard *env = MM_EnvironmentStandard::getEnvironment(envBase);
 	MM_ParallelScavengeTask scavengeTask(env, _dispatcher, this, env->_cycleState);
-	_dispatcher->run(env, &scavengeTask);
+	uintptr_t evacuateSize = _evacuateMemorySubSpace->getActiveMemorySize();
+	uintptr_t evacuateOccupancy = evacuateSize - OMR_MIN(evacuateSize, _evacuateMemorySubSpace->getApproximateFreeMemorySize());
+	_dispatcher->run(env, &scavengeTask, calculateThreadCountForScavenge(env, evacuateOccupancy));
+
+	MM_ScavengerStats *scavengerStats = &_extensions->incrementScavengerStats;
+	scavengerStats->_gcThreadCount = scavengeTask.getThreadCount();
+	scavengerStats->_gcThreadSpinUpTime = _dispatcher->getTaskSpinUpTime();
+	if (0 != evacuateOccupancy) {
+		_expectedSurvivalRate = OMR_MIN(1.0, (double)(scavengerStats->_flipBytes + scavengerStats->_tenureAggregateBytes) / (double)evacuateOccupancy);
+	}
+
+	if (NULL != _hotFieldProfile) {
+		/* digest the samples of this scavenge into the hot fields used by the next one */
+		_hotFieldProfile->update(env);
+		_extensions->incrementScavengerStats._hotFieldTypeCount = _hotFieldProfile->getHotTypeCount();
+	}
 
 	/* remove all scan caches temporary allocated in Heap */
 	_scavengeCacheFreeList.removeAllHeapAllocatedChunks(env);
@@ -683,6 +885,8 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 	finalGCStats->_releaseScanListCount += scavStats->_releaseScanListCount;
 	finalGCStats->_acquireListLockCount += scavStats->_acquireListLockCount;
 	finalGCStats->_aliasToCopyCacheCount += scavStats->_aliasToCopyCacheCount;
+	finalGCStats->_stealAttemptCount += scavStats->_stealAttemptCount;
+	finalGCStats->_stealCount += scavStats->_stealCount;
 	finalGCStats->_arraySplitCount += scavStats->_arraySplitCount;
 	finalGCStats->_arraySplitAmount += scavStats->_arraySplitAmount;
 	finalGCStats->_totalDeepStructures += scavStats->_totalDeepStructures;
@@ -692,6 +896,7 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 
 	finalGCStats->_flipDiscardBytes += scavStats->_flipDiscardBytes;
 	finalGCStats->_tenureDiscardBytes += scavStats->_tenureDiscardBytes;
+	finalGCStats->_tenureNonTemporalBytes += scavStats->_tenureNonTemporalBytes;
 
 	finalGCStats->_survivorTLHRemainderCount += scavStats->_survivorTLHRemainderCount;
 	finalGCStats->_tenureTLHRemainderCount += scavStats->_tenureTLHRemainderCount;
@@ -723,6 +928,13 @@ MM_Scavenger::mergeGCStatsBase(MM_EnvironmentBase *env, MM_ScavengerStats *final
 		finalGCStats->_copy_cachesize_counts[i] += scavStats->_copy_cachesize_counts[i];
 	}
 	finalGCStats->_leafObjectCount += scavStats->_leafObjectCount;
+	finalGCStats->_hotFieldSampleCount += scavStats->_hotFieldSampleCount;
+	finalGCStats->_hotFieldSampleColocatedCount += scavStats->_hotFieldSampleColocatedCount;
+	finalGCStats->_hotFieldCopyCount += scavStats->_hotFieldCopyCount;
+	finalGCStats->_hotFieldCopyColocatedCount += scavStats->_hotFieldCopyColocatedCount;
+	finalGCStats->_rememberedSetCardObjectCount += scavStats->_rememberedSetCardObjectCount;
+	finalGCStats->_numaLocalFlipBytes += scavStats->_numaLocalFlipBytes;
+	finalGCStats->_numaRemoteFlipBytes += scavStats->_numaRemoteFlipBytes;
 	finalGCStats->_copy_cachesize_sum += scavStats->_copy_cachesize_sum;
 	finalGCStats->_workStallTime += scavStats->_workStallTime;
 	finalGCStats->_completeStallTime += scavStats->_completeStallTime;
@@ -896,6 +1108,18 @@ MM_Scavenger::calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, u
 	return MM_Math::roundToCeiling(_extensions->getObjectAlignmentInBytes(), cacheSize);
 }
 
+bool
+MM_Scavenger::isNumaLocalSurvivorMemory(MM_EnvironmentStandard *env, void *addr)
+{
+	bool result = false;
+	void *sliceBase = NULL;
+	void *sliceTop = NULL;
+	if (_extensions->_numaManager.getAffinityLeaderSlice(env->getNumaNurseryNode(), _survivorSpaceBase, _survivorSpaceTop, _extensions->heap->getPageSize(), &sliceBase, &sliceTop)) {
+		result = (addr >= sliceBase) && (addr < sliceTop);
+	}
+	return result;
+}
+
 /**
  * Calculate optimum copyscancache size.
  *
@@ -908,13 +1132,13 @@ MM_Scavenger::calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env)
 	uintptr_t threadCount = _dispatcher->threadCount();
 	uintptr_t maxCacheSize = _extensions->scavengerScanCacheMaximumSize;
 	uintptr_t cacheSize = maxCacheSize;
-	uintptr_t waitingThreads = _waitingCount;
+	uintptr_t waitingThreads = getWaitingCount();
 	if (waitingThreads > 0) {
 		uintptr_t cacheSizeBasedOnWaitingCount = calculateCopyScanCacheSizeForWaitingThreads(maxCacheSize, threadCount, waitingThreads);
 		cacheSize = OMR_MIN(cacheSizeBasedOnWaitingCount, cacheSize);
 	}
 
-	env->approxScanCacheCount = _scavengeCacheScanList.getApproximateEntryCount();
+	env->approxScanCacheCount = getApproximateScanCacheCount();
 	if (env->approxScanCacheCount < threadCount) {
 		uintptr_t cacheSizeBasedOnScanCacheCount = calculateCopyScanCacheSizeForQueueLength(maxCacheSize, threadCount, env->approxScanCacheCount);
 		cacheSize = OMR_MIN(cacheSizeBasedOnScanCacheCount, cacheSize);
@@ -1002,6 +1226,9 @@ MM_Scavenger::reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, o
 				/* clear all flags except "allocated in heap" might be set already*/
 				copyCache->flags &= OMR_SCAVENGER_CACHE_TYPE_HEAP;
 				copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_SEMISPACE | OMR_SCAVENGER_CACHE_TYPE_COPY;
+				if (_extensions->numaAwareNursery && isNumaLocalSurvivorMemory(env, addrBase)) {
+					copyCache->flags |= OMR_SCAVENGER_CACHE_TYPE_NUMA_LOCAL;
+				}
 				reinitCache(copyCache, addrBase, addrTop);
 			} else {
 				/* can not allocate a copyCache header, release allocated memory */
@@ -1191,7 +1418,7 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, volatile omrobjectptr_
 					/* raise the alert and return (true - must look like a new object was handled) */
 					toReturn = true;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-					if (_extensions->concurrentScavenger) {
+					if (IS_CONCURRENT_ENABLED) {
 						/* We have no place to copy. We will return the original location of the object.
 						 * But we must prevent any other thread of making a copy of this object.
 						 * So we will attempt to atomically self forward it.  */
@@ -1265,18 +1492,118 @@ MM_Scavenger::copyAndForward(MM_EnvironmentStandard *env, GC_SlotObject *slotObj
 	return result;
 }
 
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+MMINLINE void
+MM_Scavenger::recordReadBarrierSlowPath(MM_EnvironmentStandard *env, uint64_t startTime, uintptr_t copyCountBefore)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	uint64_t endTime = omrtime_hires_clock();
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	uintptr_t copyCount = (env->_scavengerStats._flipCount + env->_scavengerStats._tenureAggregateCount) - copyCountBefore;
+
+	MM_AtomicOperations::addU64(&stats->_readObjectBarrierUpdate, 1);
+	if (0 != copyCount) {
+		MM_AtomicOperations::addU64(&stats->_readObjectBarrierCopy, copyCount);
+	}
+	if (endTime > startTime) {
+		MM_AtomicOperations::addU64(&stats->_readObjectBarrierTime, endTime - startTime);
+	}
+}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+/**
+ * Out of line entry point for the language read barrier and root scanners.  Calls made by mutator
+ * threads during the concurrent phase are the read barrier slow path, and are accounted for in the
+ * cycle stats (the cost model of concurrentScavengerAdaptive is fed from them).
+ */
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, volatile omrobjectptr_t *slotPtr)
 {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (isConcurrentInProgress() && (MUTATOR_THREAD == env->getThreadType())) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+		uintptr_t copyCountBefore = env->_scavengerStats._flipCount + env->_scavengerStats._tenureAggregateCount;
+		bool result = copyAndForward(env, slotPtr);
+		recordReadBarrierSlowPath(env, startTime, copyCountBefore);
+		return result;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	return copyAndForward(env, slotPtr);
 }
 
 bool
 MM_Scavenger::copyObjectSlot(MM_EnvironmentStandard *env, GC_SlotObject *slotObject)
 {
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (isConcurrentInProgress() && (MUTATOR_THREAD == env->getThreadType())) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		uint64_t startTime = omrtime_hires_clock();
+		uintptr_t copyCountBefore = env->_scavengerStats._flipCount + env->_scavengerStats._tenureAggregateCount;
+		bool result = copyAndForward(env, slotObject);
+		recordReadBarrierSlowPath(env, startTime, copyCountBefore);
+		return result;
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	return copyAndForward(env, slotObject);
 }
 
+MMINLINE void
+MM_Scavenger::copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t objectSize, uintptr_t hotFieldOffset)
+{
+	/* the profile is keyed by type, so the offset is a reference slot of the object; the bound check only guards against stale entries */
+	if ((hotFieldOffset + sizeof(fomrobject_t)) <= objectSize) {
+		GC_SlotObject hotSlot(env->getOmrVM(), (fomrobject_t *)((uintptr_t)objectPtr + hotFieldOffset));
+		copyAndForward(env, &hotSlot);
+		if (NULL != env->_effectiveCopyScanCache) {
+			env->_scavengerStats._hotFieldCopyCount += 1;
+			/* the child is copied after objectPtr, so it can only be ahead of the slot */
+			uintptr_t distance = (uintptr_t)hotSlot.readReferenceFromSlot() - (uintptr_t)hotSlot.readAddressFromSlot();
+			if (distance < _cacheLineAlignment) {
+				env->_scavengerStats._hotFieldCopyColocatedCount += 1;
+			}
+		}
+	}
+}
+
+MMINLINE void
+MM_Scavenger::sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_SlotObject *slotObject)
+{
+	if (0 == env->_hotFieldSampleCountdown) {
+		omrobjectptr_t childPtr = slotObject->readReferenceFromSlot();
+		if (NULL != childPtr) {
+			env->_hotFieldSampleCountdown = _extensions->scavengerHotFieldSampleRate - 1;
+			uintptr_t slotOffset = (uintptr_t)slotObject->readAddressFromSlot() - (uintptr_t)objectPtr;
+			_hotFieldProfile->sample(_extensions->objectModel.getObjectHeaderTypeKey(objectPtr), slotOffset);
+			env->_scavengerStats._hotFieldSampleCount += 1;
+			/* a reference is cheap for the mutator to follow when the child shares a cache line with the slot, in either direction
+			 * since the parent may be a root or remembered object, or may have been copied after the child
+			 */
+			intptr_t distance = (intptr_t)childPtr - (intptr_t)slotObject->readAddressFromSlot();
+			if ((distance > -(intptr_t)_cacheLineAlignment) && (distance < (intptr_t)_cacheLineAlignment)) {
+				env->_scavengerStats._hotFieldSampleColocatedCount += 1;
+			}
+		}
+	} else {
+		env->_hotFieldSampleCountdown -= 1;
+	}
+}
+
+MMINLINE void
+MM_Scavenger::copyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t childPtr)
+{
+	GC_ObjectModel *objectModel = &_extensions->objectModel;
+	uintptr_t hotFieldOffset1 = 0;
+	uintptr_t hotFieldOffset2 = 0;
+	if (_hotFieldProfile->getHotFieldOffsets(objectModel->getObjectHeaderTypeKey(childPtr), &hotFieldOffset1, &hotFieldOffset2)) {
+		uintptr_t childSize = objectModel->getConsumedSizeInBytesWithHeader(childPtr);
+		copyHotField(env, childPtr, childSize, hotFieldOffset1);
+		if (0 != hotFieldOffset2) {
+			copyHotField(env, childPtr, childSize, hotFieldOffset2);
+		}
+	}
+}
+
 omrobjectptr_t
 MM_Scavenger::copyObject(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHeader)
 {
@@ -1422,6 +1749,7 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 	newCacheAlloc = (void *) (((uint8_t *)destinationObjectPtr) + objectReserveSizeInBytes);
 
 	omrobjectptr_t originalDestinationObjectPtr = destinationObjectPtr;
+	bool copiedNonTemporal = false;
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uintptr_t remainingSizeToCopy = 0;
 	uintptr_t initialSizeToCopy = 0;
@@ -1481,7 +1809,9 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 		} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 		{
-			memcpy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes);
+			/* Large objects tenured through the cache would evict the objects this thread is about to scan */
+			bool nonTemporal = (0 != (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_TENURESPACE));
+			copiedNonTemporal = _objectCopy.copy((void *)destinationObjectPtr, forwardedHeader->getObject(), objectCopySizeInBytes, nonTemporal);
 
 			/* Copy the preserved fields from the forwarded header into the destination object */
 			forwardedHeader->fixupForwardedObject(destinationObjectPtr);
@@ -1530,6 +1860,9 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 		if(copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_TENURESPACE) {
 			scavStats->_tenureAggregateCount += 1;
 			scavStats->_tenureAggregateBytes += objectCopySizeInBytes;
+			if (copiedNonTemporal) {
+				scavStats->_tenureNonTemporalBytes += objectCopySizeInBytes;
+			}
 			scavStats->getFlipHistory(0)->_tenureBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
 #if defined(OMR_GC_LARGE_OBJECT_AREA)
 			if (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_LOA) {
@@ -1542,6 +1875,13 @@ MM_Scavenger::copy(MM_EnvironmentStandard *env, MM_ForwardedHeader* forwardedHea
 			scavStats->_flipCount += 1;
 			scavStats->_flipBytes += objectCopySizeInBytes;
 			scavStats->getFlipHistory(0)->_flipBytes[oldObjectAge + 1] += objectReserveSizeInBytes;
+			if (_extensions->numaAwareNursery) {
+				if (copyCache->flags & OMR_SCAVENGER_CACHE_TYPE_NUMA_LOCAL) {
+					scavStats->_numaLocalFlipBytes += objectCopySizeInBytes;
+				} else {
+					scavStats->_numaRemoteFlipBytes += objectCopySizeInBytes;
+				}
+			}
 		}
 	} else {
 		/* We have not used the reserved space now, but we will for subsequent allocations. If this space was reserved for an individual object,
@@ -1587,7 +1927,7 @@ MM_Scavenger::getArraySplitAmount(MM_EnvironmentStandard *env, uintptr_t sizeInE
 		 * the less busy we are, the smaller the split amount, while obeying specified minimum and maximum.
 		 * but for single-threaded backout, do not split arrays.
 		 */
-		scvArraySplitAmount = sizeInElements / (_dispatcher->activeThreadCount() + 2 * _waitingCount);
+		scvArraySplitAmount = sizeInElements / (_dispatcher->activeThreadCount() + 2 * getWaitingCount());
 		scvArraySplitAmount = OMR_MAX(scvArraySplitAmount, _extensions->scvArraySplitMinimumAmount);
 		scvArraySplitAmount = OMR_MIN(scvArraySplitAmount, _extensions->scvArraySplitMaximumAmount);
 	}
@@ -1646,9 +1986,9 @@ MM_Scavenger::updateCopyScanCounts(MM_EnvironmentBase* env, uint64_t slotsScanne
 {
 	env->_scavengerStats._slotsScanned += slotsScanned;
 	env->_scavengerStats._slotsCopied += slotsCopied;
-	uint64_t updateResult = _extensions->copyScanRatio.update(env, &(env->_scavengerStats._slotsScanned), &(env->_scavengerStats._slotsCopied), _waitingCount);
+	uint64_t updateResult = _extensions->copyScanRatio.update(env, &(env->_scavengerStats._slotsScanned), &(env->_scavengerStats._slotsCopied), getWaitingCount());
 	if (0 != updateResult) {
-		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, _scavengeCacheScanList.getApproximateEntryCount());
+		_extensions->copyScanRatio.majorUpdate(env, updateResult, _cachedEntryCount, getApproximateScanCacheCount());
 	}
 }
 
@@ -1697,12 +2037,19 @@ MM_Scavenger::scavengeObjectSlots(MM_EnvironmentStandard *env, MM_CopyScanCacheS
 	bool shouldRemember = false;
 	GC_SlotObject *slotObject = NULL;
 
+	bool profileHotFields = (NULL != _hotFieldProfile) && !objectScanner->isIndexableObject();
 	MM_CopyScanCacheStandard **copyCache = &(env->_effectiveCopyScanCache);
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		shouldRemember |= isSlotObjectInNewSpace;
+		if (profileHotFields) {
+			sampleHotField(env, objectPtr, slotObject);
+		}
 		if (NULL != *copyCache) {
 			slotsCopied += 1;
+			if (profileHotFields) {
+				copyHotFields(env, slotObject->readReferenceFromSlot());
+			}
 		}
 		slotsScanned += 1;
 	}
@@ -1831,12 +2178,16 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 	GC_SlotObject *slotObject;
 	uint64_t slotsCopied = 0;
 	uint64_t slotsScanned = 0;
+	bool profileHotFields = (NULL != _hotFieldProfile) && !objectScanner->isIndexableObject();
 
 	while (NULL != (slotObject = objectScanner->getNextSlot())) {
 		/* If the object should be remembered and it is in old space, remember it */
 		bool isSlotObjectInNewSpace = copyAndForward(env, slotObject);
 		scanCache->_shouldBeRemembered |= isSlotObjectInNewSpace;
 		slotsScanned += 1;
+		if (profileHotFields) {
+			sampleHotField(env, objectPtr, slotObject);
+		}
 
 		MM_CopyScanCacheStandard *copyCache = env->_effectiveCopyScanCache;
 		if (NULL != copyCache) {
@@ -1849,6 +2200,10 @@ MM_Scavenger::incrementalScavengeObjectSlots(MM_EnvironmentStandard *env, omrobj
 				updateCopyScanCounts(env, slotsScanned, slotsCopied);
 				return nextScanCache;
 			}
+			if (profileHotFields) {
+				/* only after aliasing was declined: copying the hot fields may move on to another copy cache */
+				copyHotFields(env, slotObject->readReferenceFromSlot());
+			}
 		}
 	}
 	updateCopyScanCounts(env, slotsScanned, slotsCopied);
@@ -1942,6 +2297,10 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	env->_scavengerStats._acquireScanListCount += 1;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
+	if (_extensions->scavengerWorkStealing) {
+		return getNextScanCacheWithStealing(env, doneIndex);
+	}
+
 #if defined(OMR_SCAVENGER_TRACE) || defined(J9MODRON_TGC_PARALLEL_STATISTICS)
 	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
 #endif /* OMR_SCAVENGER_TRACE || J9MODRON_TGC_PARALLEL_STATISTICS */
@@ -2011,6 +2370,172 @@ MM_Scavenger::getNextScanCache(MM_EnvironmentStandard *env)
 	return cache;
 }
 
+MM_CopyScanCacheStandard *
+MM_Scavenger::getNextScanCacheWithStealing(MM_EnvironmentStandard *env, uintptr_t doneIndex)
+{
+	MM_CopyScanCacheDeque *deque = _scanCacheDeques[env->getSlaveID()];
+	uintptr_t threadCount = env->_currentTask->getThreadCount();
+	uintptr_t scanState = STEALING_SCAN_STATE(doneIndex);
+	MM_CopyScanCacheStandard *cache = NULL;
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+	while (!shouldAbortScanLoop(env)) {
+		/* own work first (youngest caches, most likely still in this CPU's cache), then overflow, then other threads */
+		cache = deque->pop();
+		if (NULL != cache) {
+			return cache;
+		}
+		if (0 != _cachedEntryCount) {
+			cache = getNextScanCacheFromList(env);
+			if (NULL != cache) {
+				return cache;
+			}
+		}
+		cache = stealScanCache(env);
+		if (NULL != cache) {
+			return cache;
+		}
+
+		/* Out of work - flush buffers (as before waiting on the monitor in the default mode) and become idle.
+		 * An idle thread holds no scan work and never produces any, so once all threads of the task are idle
+		 * the scan loop is complete. The last thread to become idle moves the state to the next _doneIndex.
+		 */
+		flushBuffersForGetNextScanCache(env);
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		uint64_t idleStartTime = omrtime_hires_clock();
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		bool doneFlag = false;
+		uintptr_t oldState = _stealingScanState;
+		while (true) {
+			if (scanState != (oldState & ~STEALING_IDLE_COUNT_MASK)) {
+				doneFlag = true;
+				break;
+			}
+			bool lastThread = (threadCount == ((oldState & STEALING_IDLE_COUNT_MASK) + 1));
+			uintptr_t newState = lastThread ? STEALING_SCAN_STATE(doneIndex + 1) : (oldState + 1);
+			uintptr_t seenState = MM_AtomicOperations::lockCompareExchange(&_stealingScanState, oldState, newState);
+			if (seenState == oldState) {
+				if (lastThread) {
+					_extensions->copyScanRatio.reset(env, false);
+					MM_AtomicOperations::storeSync();
+					/* releases the other threads, which wait for the new _doneIndex before leaving the scan loop */
+					_doneIndex = doneIndex + 1;
+					doneFlag = true;
+				}
+				break;
+			}
+			oldState = seenState;
+		}
+
+		uintptr_t spinCount = 0;
+		while (!doneFlag) {
+			oldState = _stealingScanState;
+			if (scanState != (oldState & ~STEALING_IDLE_COUNT_MASK)) {
+				doneFlag = true;
+			} else if (isScanCacheAvailableToSteal() || shouldAbortScanLoop(env)) {
+				/* leave the idle state, unless the scan loop has completed in the meantime */
+				if (oldState == MM_AtomicOperations::lockCompareExchange(&_stealingScanState, oldState, oldState - 1)) {
+					break;
+				}
+			} else if (spinCount < STEALING_IDLE_SPIN_COUNT) {
+				spinCount += 1;
+				MM_AtomicOperations::yieldCPU();
+			} else {
+				omrthread_yield();
+			}
+		}
+
+		if (doneFlag) {
+			while (doneIndex == _doneIndex) {
+				MM_AtomicOperations::yieldCPU();
+			}
+			MM_AtomicOperations::loadSync();
+		}
+
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+		if (doneFlag) {
+			env->_scavengerStats.addToCompleteStallTime(idleStartTime, omrtime_hires_clock());
+		} else {
+			env->_scavengerStats.addToWorkStallTime(idleStartTime, omrtime_hires_clock());
+		}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+
+		if (doneFlag) {
+			return NULL;
+		}
+	}
+
+	return NULL;
+}
+
+MMINLINE MM_CopyScanCacheStandard *
+MM_Scavenger::stealScanCache(MM_EnvironmentStandard *env)
+{
+	MM_CopyScanCacheStandard *cache = NULL;
+	uintptr_t victim = env->getSlaveID();
+
+	for (uintptr_t i = 1; i < _scanCacheDequeCount; i++) {
+		victim += 1;
+		if (victim == _scanCacheDequeCount) {
+			victim = 0;
+		}
+		if (!_scanCacheDeques[victim]->isEmpty()) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+			env->_scavengerStats._stealAttemptCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+			cache = _scanCacheDeques[victim]->steal();
+			if (NULL != cache) {
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+				env->_scavengerStats._stealCount += 1;
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+				break;
+			}
+		}
+	}
+
+	return cache;
+}
+
+MMINLINE bool
+MM_Scavenger::isScanCacheAvailableToSteal()
+{
+	if (0 != _cachedEntryCount) {
+		return true;
+	}
+	for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+		if (!_scanCacheDeques[i]->isEmpty()) {
+			return true;
+		}
+	}
+	return false;
+}
+
+MMINLINE uintptr_t
+MM_Scavenger::getApproximateScanCacheCount()
+{
+	uintptr_t count = _scavengeCacheScanList.getApproximateEntryCount();
+	if (_extensions->scavengerWorkStealing) {
+		for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+			count += _scanCacheDeques[i]->getApproximateEntryCount();
+		}
+	}
+	return count;
+}
+
+MMINLINE uintptr_t
+MM_Scavenger::getWaitingCount()
+{
+	if (_extensions->scavengerWorkStealing) {
+		return _stealingScanState & STEALING_IDLE_COUNT_MASK;
+	}
+	return _waitingCount;
+}
+
 /**
  * Scans all the objects to scan in the scanCache, remembering objects as required,
  * and flushing the cache at the end.
@@ -2285,7 +2810,19 @@ MM_Scavenger::addToRememberedSetFragment(MM_EnvironmentStandard *env, omrobjectp
 
 	if(env->_scavengerRememberedSet.fragmentCurrent >= env->_scavengerRememberedSet.fragmentTop) {
 		/* There wasn't enough room in the current fragment - allocate a new one */
-		if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
+		if (NULL != _rsCardOverflow) {
+			/* Allocate without raising the overflow state, an object which does not fit is recorded by card instead */
+			MM_SublistFragment::flush((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+			MM_SublistFragment fragment((J9VMGC_SublistFragment*)&env->_scavengerRememberedSet);
+			if (!((MM_SublistPool *)env->_scavengerRememberedSet.parentList)->allocate(env, &fragment)) {
+				if(!isRememberedSetInOverflowState()) {
+					env->_scavengerStats._causedRememberedSetOverflow = 1;
+				}
+				_rsCardOverflow->addObject(objectPtr);
+				_extensions->setRememberedSetCardOverflowState();
+				return ;
+			}
+		} else if(allocateMemoryForSublistFragment(env->getOmrVMThread(), (J9VMGC_SublistFragment*)&env->_scavengerRememberedSet)) {
 			/* Failed to allocate a fragment - set the remembered set overflow state and exit */
 			if(!isRememberedSetInOverflowState()) {
 				env->_scavengerStats._causedRememberedSetOverflow = 1;
@@ -2489,10 +3026,14 @@ MM_Scavenger::flushRememberedSet(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::pruneRememberedSet(MM_EnvironmentStandard *env)
 {
-	if(isRememberedSetInOverflowState()) {
+	/* objects recorded by card (but not in full overflow) are pruned with the list */
+	if(_extensions->isRememberedSetInFullOverflowState()) {
 		pruneRememberedSetOverflow(env);
 	} else {
 		pruneRememberedSetList(env);
+		if (NULL != _rsCardOverflow) {
+			pruneRememberedSetCardObjects(env);
+		}
 	}
 }
 
@@ -2515,6 +3056,10 @@ MM_Scavenger::pruneRememberedSetOverflow(MM_EnvironmentStandard *env)
 		/* Clear the overflow state. Probability is high that we'll wind up re-overflowing. */
 		clearRememberedSetOverflowState();
 		clearRememberedSetLists(env);
+		if (NULL != _rsCardOverflow) {
+			/* all remembered objects are found by the walk below, some of them may be recorded by card again */
+			_rsCardOverflow->clear(env);
+		}
 
 		/* Walk the tenure memory subspace finding all tenured objects flagged as remembered */
 		MM_HeapRegionDescriptorStandard *region = NULL;
@@ -2645,6 +3190,43 @@ MM_Scavenger::pruneRememberedSetList(MM_EnvironmentStandard *env)
 #endif /* OMR_SCAVENGER_TRACE_REMEMBERED_SET */
 }
 
+void
+MM_Scavenger::pruneRememberedSetCardObjects(MM_EnvironmentStandard *env)
+{
+	uintptr_t batchSize = _extensions->scavengerRememberedSetBatchSize;
+	omrobjectptr_t *objects = _rsCardOverflow->getObjects();
+	uintptr_t objectCount = _rsCardOverflow->getObjectCount();
+
+	for (uintptr_t batch = 0; batch < _rememberedSetCardObjectBatchCount; batch++) {
+		if(J9MODRON_HANDLE_NEXT_WORK_UNIT(env)) {
+			omrobjectptr_t *slotPtr = objects + (batch * batchSize);
+			omrobjectptr_t *slotTop = objects + OMR_MIN((batch + 1) * batchSize, objectCount);
+			for (; slotPtr < slotTop; slotPtr++) {
+				omrobjectptr_t objectPtr = *slotPtr;
+				if((uintptr_t)objectPtr & DEFERRED_RS_REMOVE_FLAG) {
+					objectPtr = (omrobjectptr_t)((uintptr_t)objectPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+					/* A simple mask out can be used - we are guaranteed to be the only manipulator of the object */
+					_extensions->objectModel.clearRemembered(objectPtr);
+#if defined(OMR_GC_MODRON_CONCURRENT_MARK)
+					if (_extensions->shouldScavengeNotifyGlobalGCOfOldToOldReference()) {
+						/* Inform interested parties (Concurrent Marker) that an object has been removed from the remembered set */
+						oldToOldReferenceCreated(env, objectPtr);
+					}
+#endif /* OMR_GC_MODRON_CONCURRENT_MARK */
+				} else {
+					if (processRememberedThreadReference(env, objectPtr)) {
+						/* the object was tenured from the stack on a previous scavenge -- keep it around for a bit longer */
+						Trc_MM_ParallelScavenger_scavengeRememberedSet_keepingRememberedObject(env->getLanguageVMThread(), objectPtr, _extensions->objectModel.getRememberedBits(objectPtr));
+					}
+					/* Retained objects stay recorded by card, they are collected again by the next scavenge */
+					_rsCardOverflow->addObject(objectPtr);
+					_extensions->setRememberedSetCardOverflowState();
+				}
+			}
+		}
+	}
+}
+
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 void
 MM_Scavenger::scavengeRememberedSetListDirect(MM_EnvironmentStandard *env)
@@ -2720,6 +3302,30 @@ MM_Scavenger::scavengeRememberedSetListIndirect(MM_EnvironmentStandard *env)
 
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
+MMINLINE void
+MM_Scavenger::scavengeRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr)
+{
+	omrobjectptr_t objectPtr = *slotPtr;
+	Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+
+	/* First assume the object will not be remembered.
+	 * This is helpful for work completion ordering of split arrays.
+	 * Flag slot for later removal if we complete scavenge OK
+	 */
+	*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
+	bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
+	if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
+		shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
+	}
+
+	shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
+
+	if (shouldBeRemembered) {
+		/* We want to remember this object after all; clear the flag for removal. */
+		*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
+	}
+}
+
 void
 MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 {
@@ -2735,28 +3341,9 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 		GC_SublistSlotIterator remSetSlotIterator(puddle);
 		omrobjectptr_t *slotPtr;
 		while((slotPtr = (omrobjectptr_t *)remSetSlotIterator.nextSlot()) != NULL) {
-			omrobjectptr_t objectPtr = *slotPtr;
-
-			if(NULL != objectPtr) {
-				Assert_MM_true(_extensions->objectModel.isRemembered(objectPtr));
+			if(NULL != *slotPtr) {
 				numElements += 1;
-
-				/* First assume the object will not be remembered.
-				 * This is helpful for work completion ordering of split arrays.
-				 * Flag slot for later removal if we complete scavenge OK
-				 */
-				*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr | DEFERRED_RS_REMOVE_FLAG);
-				bool shouldBeRemembered = scavengeObjectSlots(env, NULL, objectPtr, GC_ObjectScanner::scanRoots, slotPtr);
-				if (_extensions->objectModel.hasIndirectObjectReferents((CLI_THREAD_TYPE*)env->getLanguageVMThread(), objectPtr)) {
-					shouldBeRemembered |= _delegate.scavengeIndirectObjectSlots(env, objectPtr);
-				}
-
-				shouldBeRemembered |= isRememberedThreadReference(env, objectPtr);
-
-				if (shouldBeRemembered) {
-					/* We want to remember this object after all; clear the flag for removal. */
-					*slotPtr = (omrobjectptr_t)((uintptr_t)*slotPtr & ~(uintptr_t)DEFERRED_RS_REMOVE_FLAG);
-				}
+				scavengeRememberedSetSlot(env, slotPtr);
 			} else {
 				remSetSlotIterator.removeSlot();
 			}
@@ -2768,6 +3355,89 @@ MM_Scavenger::scavengeRememberedSetList(MM_EnvironmentStandard *env)
 	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
 }
 
+void
+MM_Scavenger::scavengeRememberedSetListBatched(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Entry(env->getLanguageVMThread());
+
+	uintptr_t batchSize = _extensions->scavengerRememberedSetBatchSize;
+	/* Batch indices claimed by a thread only increase, so the puddle list is walked forward once per thread */
+	MM_SublistPuddle *puddle = _extensions->rememberedSet.getPreviousList();
+	uintptr_t puddleFirstBatch = 0;
+	uintptr_t puddleBatchCount = (NULL == puddle) ? 0 : ((puddle->consumedElementCount() + batchSize - 1) / batchSize);
+	uintptr_t batchesDone = 0;
+
+	while (_rememberedSetBatchNext < _rememberedSetBatchCount) {
+		uintptr_t batch = MM_AtomicOperations::add(&_rememberedSetBatchNext, 1) - 1;
+		if (batch >= _rememberedSetBatchCount) {
+			break;
+		}
+		while (batch >= (puddleFirstBatch + puddleBatchCount)) {
+			puddleFirstBatch += puddleBatchCount;
+			puddle = puddle->getNext();
+			puddleBatchCount = (puddle->consumedElementCount() + batchSize - 1) / batchSize;
+		}
+
+		/* The puddle is not allocated from while it is on the previous list, and slots are never removed
+		 * here (that would move entries across batches), NULL slots are left for pruneRememberedSetList()
+		 */
+		uintptr_t elementCount = puddle->consumedElementCount();
+		uintptr_t first = (batch - puddleFirstBatch) * batchSize;
+		omrobjectptr_t *slotPtr = (omrobjectptr_t *)puddle->getListBase() + first;
+		omrobjectptr_t *slotTop = slotPtr + OMR_MIN(batchSize, elementCount - first);
+		omrobjectptr_t *prefetchTop = (omrobjectptr_t *)puddle->getListBase() + elementCount;
+		for (; slotPtr < slotTop; slotPtr++) {
+			omrobjectptr_t *prefetchSlotPtr = slotPtr + SCAVENGER_REMEMBERED_SET_PREFETCH_DISTANCE;
+			if (prefetchSlotPtr < prefetchTop) {
+				OMR_PREFETCH_READ(*prefetchSlotPtr);
+			}
+			if (NULL != *slotPtr) {
+				scavengeRememberedSetSlot(env, slotPtr);
+			}
+		}
+		batchesDone += 1;
+	}
+
+	if (0 != batchesDone) {
+		if (_rememberedSetBatchCount == MM_AtomicOperations::add(&_rememberedSetBatchDone, batchesDone)) {
+			/* all batches have been scanned, hand the puddles back for pruning */
+			_extensions->rememberedSet.returnPreviousPuddles();
+		}
+	}
+
+	Trc_MM_ParallelScavenger_scavengeRememberedSetList_Exit(env->getLanguageVMThread());
+}
+
+void
+MM_Scavenger::scavengeRememberedSetCardObjects(MM_EnvironmentStandard *env)
+{
+	Assert_MM_false(IS_CONCURRENT_ENABLED);
+
+	uintptr_t batchSize = _extensions->scavengerRememberedSetBatchSize;
+	omrobjectptr_t *objects = _rsCardOverflow->getObjects();
+	uintptr_t objectCount = _rsCardOverflow->getObjectCount();
+
+	while (_rememberedSetCardObjectBatchNext < _rememberedSetCardObjectBatchCount) {
+		uintptr_t batch = MM_AtomicOperations::add(&_rememberedSetCardObjectBatchNext, 1) - 1;
+		if (batch >= _rememberedSetCardObjectBatchCount) {
+			break;
+		}
+		/* entries of the collected object array are treated exactly like remembered set slots */
+		omrobjectptr_t *slotPtr = objects + (batch * batchSize);
+		omrobjectptr_t *slotTop = objects + OMR_MIN((batch + 1) * batchSize, objectCount);
+		env->_scavengerStats._rememberedSetCardObjectCount += (uintptr_t)(slotTop - slotPtr);
+		for (; slotPtr < slotTop; slotPtr++) {
+			omrobjectptr_t *prefetchSlotPtr = slotPtr + SCAVENGER_REMEMBERED_SET_PREFETCH_DISTANCE;
+			if (prefetchSlotPtr < (objects + objectCount)) {
+				OMR_PREFETCH_READ(*prefetchSlotPtr);
+			}
+			scavengeRememberedSetSlot(env, slotPtr);
+		}
+	}
+}
+
 /* NOTE - only  scavengeRememberedSetOverflow ends with a sync point.
  * Callers of this function must not assume that there is a sync point
  */
@@ -2785,7 +3455,14 @@ MM_Scavenger::scavengeRememberedSet(MM_EnvironmentStandard *env)
 		}
 	} else {
 		if (!IS_CONCURRENT_ENABLED) {
-			scavengeRememberedSetList(env);
+			if (_extensions->scavengerRememberedSetBatching) {
+				scavengeRememberedSetListBatched(env);
+			} else {
+				scavengeRememberedSetList(env);
+			}
+			if (NULL != _rsCardOverflow) {
+				scavengeRememberedSetCardObjects(env);
+			}
 		}
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 		/* Indirect refs are dealt within the root scanning phase (first STW phase), while the direct references are dealt within the main scan phase (typically concurrent). */
@@ -3200,14 +3877,21 @@ MM_Scavenger::addCopyCachesToFreeList(MM_EnvironmentStandard *env)
 MMINLINE void
 MM_Scavenger::addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry)
 {
-	_scavengeCacheScanList.pushCache(env, newCacheEntry);
-	if (0 != _waitingCount) {
-		/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
-		if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
-			if (0 != _waitingCount) {
-				omrthread_monitor_notify(_scanCacheMonitor);
+	if (_extensions->scavengerWorkStealing) {
+		/* idle threads poll the deques, there is nobody to notify; a full deque overflows to the shared list */
+		if (!_scanCacheDeques[env->getSlaveID()]->push(newCacheEntry)) {
+			_scavengeCacheScanList.pushCache(env, newCacheEntry);
+		}
+	} else {
+		_scavengeCacheScanList.pushCache(env, newCacheEntry);
+		if (0 != _waitingCount) {
+			/* Added an entry to the list - notify any other threads that a new entry has appeared on the list */
+			if (0 == omrthread_monitor_try_enter(_scanCacheMonitor)) {
+				if (0 != _waitingCount) {
+					omrthread_monitor_notify(_scanCacheMonitor);
+				}
+				omrthread_monitor_exit(_scanCacheMonitor);
 			}
-			omrthread_monitor_exit(_scanCacheMonitor);
 		}
 	}
 }
@@ -3235,7 +3919,7 @@ MM_Scavenger::aliasToCopyCache(MM_EnvironmentStandard *env, GC_SlotObject *scann
 	 *
 	 * @NOTE See Github Issue 3089 (Investigate Scavenger's Aliasing Inhibiting Condition)
 	 */
-	if (_waitingCount <= _waitingCountAliasThreshold) {
+	if (getWaitingCount() <= _waitingCountAliasThreshold) {
 		/* Only alias if the scanCache != copyCache. IF the caches are the same there is no benefit
 		 * to aliasing. The checks afterwards will ensure that a very similar copy order will happen
 		 * if the copyCache changes from the currently aliased scan cache
@@ -3334,6 +4018,9 @@ MM_Scavenger::checkAndSetShouldYieldFlag(MM_EnvironmentStandard *env) {
 	 * is indeed being requested (hence scavenger_shouldYield() call too).
 	 */
 	if (!_shouldYield && env->isExclusiveAccessRequestWaiting() && _delegate.shouldYield()) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		/* racing threads may both set it, either time is a fair start of the yield */
+		_yieldStartTime = omrtime_hires_clock();
 		_shouldYield = true;
 	}
 	return _shouldYield;
@@ -3584,7 +4271,7 @@ MM_Scavenger::processRememberedSetInBackout(MM_EnvironmentStandard *env)
 	MM_SublistPuddle *puddle;
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	if (_extensions->concurrentScavenger) {
+	if (IS_CONCURRENT_ENABLED) {
 		GC_SublistIterator remSetIterator(&(_extensions->rememberedSet));
 		while((puddle = remSetIterator.nextList()) != NULL) {
 			GC_SublistSlotIterator remSetSlotIterator(puddle);
@@ -3692,6 +4379,14 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 			while (NULL != (cache = _scavengeCacheScanList.popCache(env))) {
 				flushCache(env, cache);
 			}
+			if (_extensions->scavengerWorkStealing) {
+				/* threads left the aborted scan loop with caches still in their deques */
+				for (uintptr_t i = 0; i < _scanCacheDequeCount; i++) {
+					while (NULL != (cache = _scanCacheDeques[i]->steal())) {
+						flushCache(env, cache);
+					}
+				}
+			}
 		}
 		Assert_MM_true(0 == _cachedEntryCount);
 
@@ -3703,6 +4398,12 @@ MM_Scavenger::completeBackOut(MM_EnvironmentStandard *env)
 		 */
 		_extensions->scavengerRsoScanUnsafe = true;
 
+		if ((NULL != _rsCardOverflow) && (isRememberedSetInOverflowState() || (0 != _rsCardOverflow->getObjectCount()))) {
+			/* Objects recorded by card (or collected from cards) are not in the list, back them out with the overflow walk */
+			_rsCardOverflow->clear(env);
+			setRememberedSetOverflowState();
+		}
+
 		if(isRememberedSetInOverflowState()) {
 			GC_MemorySubSpaceRegionIterator evacuateRegionIterator(_activeSubSpace);
 			MM_HeapRegionDescriptor* rootRegion;
@@ -3830,7 +4531,8 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 	_extensions->incrementScavengerStats._startTime = omrtime_hires_clock();
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	if (_extensions->concurrentScavenger) {
+	bool concurrentCycle = IS_CONCURRENT_ENABLED;
+	if (concurrentCycle) {
 		scavengeIncremental(env);
 	} else
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
@@ -3848,6 +4550,21 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 
 	/* merge stats from this increment/phase to aggregate cycle stats */
 	mergeIncrementGCStats(env, lastIncrement);
+
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (_extensions->incrementScavengerStats._endTime > _extensions->incrementScavengerStats._startTime) {
+		_extensions->scavengerStats._stopTheWorldTime += _extensions->incrementScavengerStats._endTime - _extensions->incrementScavengerStats._startTime;
+	}
+	if ((NULL != _modeController) && lastIncrement && scavengeCompletedSuccessfully(env)) {
+		_modeController->update(env, concurrentCycle);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
+
+	if ((NULL != _pauseController) && lastIncrement && scavengeCompletedSuccessfully(env)) {
+		/* decide on the nursery resize ahead of the report, it is applied by the semispace once the spaces are flipped */
+		_pauseController->update(env, _activeSubSpace->getMemorySubSpaceAllocate()->getActiveMemorySize(), _activeSubSpace->getCurrentSize());
+	}
+
 	reportScavengeEnd(env, lastIncrement);
 
 	if (lastIncrement) {
@@ -3865,6 +4582,11 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 			/* Merge sublists in the remembered set (if necessary) */
 			_extensions->rememberedSet.compact(env);
 
+			if (NULL != _extensions->allocationSiteSampler) {
+				/* while the forwarding headers are still in the evacuate space */
+				_extensions->allocationSiteSampler->scavengeComplete(env, this);
+			}
+
 			/* If -Xgc:fvtest=forcePoisonEvacuate has been specified, poison(fill poison pattern) evacuate space */
 			if(_extensions->fvtest_forcePoisonEvacuate) {
 				_activeSubSpace->poisonEvacuateSpace();
@@ -3876,7 +4598,7 @@ MM_Scavenger::masterThreadGarbageCollect(MM_EnvironmentBase *envBase, MM_Allocat
 			/* Defer to collector language interface */
 			_delegate.masterThreadGarbageCollect_scavengeSuccess(env);
 
-			if(_extensions->scvTenureStrategyAdaptive) {
+			if(_extensions->scvTenureStrategyAdaptive && (NULL == _pauseController)) {
 				/* Adjust the tenure age based on the percentage of new space used.  Also, avoid / by 0 */
 				uintptr_t newSpaceTotalSize = _activeSubSpace->getMemorySubSpaceAllocate()->getActiveMemorySize();
 				uintptr_t newSpaceConsumedSize = _extensions->scavengerStats._flipBytes;
@@ -4051,6 +4773,34 @@ MM_Scavenger::heapRemoveRange(
 	return true;
 }
 
+bool
+MM_Scavenger::rememberedSetHeapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress)
+{
+	bool result = true;
+	if (NULL != _rsCardOverflow) {
+		result = _rsCardOverflow->heapAddRange(env, size, lowAddress, highAddress);
+	}
+	return result;
+}
+
+bool
+MM_Scavenger::rememberedSetHeapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress)
+{
+	bool result = true;
+	if (NULL != _rsCardOverflow) {
+		result = _rsCardOverflow->heapRemoveRange(env, size, lowAddress, highAddress, lowValidAddress, highValidAddress);
+	}
+	return result;
+}
+
+void
+MM_Scavenger::retainMarkedRememberedSetCardObjects(MM_EnvironmentBase *env, MM_MarkMap *markMap)
+{
+	if (NULL != _rsCardOverflow) {
+		_rsCardOverflow->retainMarkedObjects(env, markMap);
+	}
+}
+
 /**
  * Report API for when an expansion has occurred during a collection.
  * @seealso MM_Collector::collectorExpanded(MM_EnvironmentBase *, MM_MemorySubSpace *, uintptr_t)
@@ -4209,7 +4959,7 @@ MM_Scavenger::internalGarbageCollect(MM_EnvironmentBase *envBase, MM_MemorySubSp
 	}
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	if (_extensions->concurrentScavenger && isBackOutFlagRaised()) {
+	if (IS_CONCURRENT_ENABLED && isBackOutFlagRaised()) {
 		bool result = percolateGarbageCollect(env, subSpace, NULL, ABORTED_SCAVENGE, J9MMCONSTANT_IMPLICIT_GC_PERCOLATE_ABORTED_SCAVENGE);
 
 		Assert_MM_true(result);
@@ -4339,8 +5089,8 @@ MM_Scavenger::internalGarbageCollect(MM_EnvironmentBase *envBase, MM_MemorySubSp
 		}
 	}
 
-	/* Check if there is an RSO and the heap is not safely walkable */
-	if(isRememberedSetInOverflowState() && _extensions->scavengerRsoScanUnsafe) {
+	/* Check if there is an RSO and the heap is not safely walkable (objects recorded by card are collected without a walk) */
+	if(_extensions->isRememberedSetInFullOverflowState() && _extensions->scavengerRsoScanUnsafe) {
 		/* NOTE: No need to set that the collect was unsuccessful - we will actually execute
 		 * the scavenger after percolation.
 		 */
@@ -4358,7 +5108,11 @@ MM_Scavenger::internalGarbageCollect(MM_EnvironmentBase *envBase, MM_MemorySubSp
 	_collectorExpandedSize = 0;
 
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
-	if (_extensions->concurrentScavenger) {
+	if ((NULL != _modeController) && !isConcurrentInProgress()) {
+		/* the mode is picked per cycle, and holds until the cycle completes */
+		_extensions->concurrentScavengerStopTheWorldCycle = !_modeController->scavengeConcurrently(env);
+	}
+	if (IS_CONCURRENT_ENABLED) {
 		/* this may trigger either start or end of Concurrent Scavenge cycle */
 		triggerConcurrentScavengerTransition(env, allocDescription);
 	}
@@ -4394,7 +5148,7 @@ MM_Scavenger::percolateGarbageCollect(MM_EnvironmentBase *env,  MM_MemorySubSpac
 {
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	/* before doing percolate global, we have to complete potentially ongoing concurrent Scavenge cycle */
-	if (_extensions->concurrentScavenger && isConcurrentInProgress()) {
+	if (IS_CONCURRENT_ENABLED && isConcurrentInProgress()) {
 		triggerConcurrentScavengerTransition(env, allocDescription);
 	}
 #endif
@@ -5056,7 +5810,7 @@ MM_Scavenger::workThreadScan(MM_EnvironmentStandard *env)
 void
 MM_Scavenger::workThreadComplete(MM_EnvironmentStandard *env)
 {
-	Assert_MM_true(_extensions->concurrentScavenger);
+	Assert_MM_true(IS_CONCURRENT_ENABLED);
 
 	clearThreadGCStats(env, false);
 
@@ -5110,11 +5864,27 @@ uintptr_t
 MM_Scavenger::masterThreadConcurrentCollect(MM_EnvironmentBase *env)
 {
 	if (concurrent_state_scan == _concurrentState) {
+		OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+		MM_ScavengerStats *stats = &_extensions->scavengerStats;
 		clearIncrementGCStats(env, false);
 
 		MM_ConcurrentScavengeTask scavengeTask(env, _dispatcher, this, MM_ConcurrentScavengeTask::SCAVENGE_SCAN, UDATA_MAX, env->_cycleState);
+		uint64_t startTime = omrtime_hires_clock();
 		/* Concurrent background task will run with different (typically lower) number of threads. */
 		_dispatcher->run(env, &scavengeTask, _extensions->concurrentScavengerBackgroundThreads);
+		uint64_t endTime = omrtime_hires_clock();
+
+		if (endTime > startTime) {
+			stats->_concurrentPhaseTime += endTime - startTime;
+		}
+		stats->_concurrentPhaseBytesScanned += scavengeTask.getBytesScanned();
+		if (_shouldYield) {
+			/* all GC threads have left the task once the dispatcher returns */
+			stats->_concurrentYieldCount += 1;
+			if (endTime > _yieldStartTime) {
+				stats->_concurrentYieldLatency = OMR_MAX(stats->_concurrentYieldLatency, endTime - _yieldStartTime);
+			}
+		}
 
 		/* Now that we are done with concurrent scanning in this cycle (where we could possibly
 		 * be interested in its value), record shouldYield Flag for reporting purposes and reset it. */
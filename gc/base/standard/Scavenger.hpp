@@ -34,22 +34,29 @@
 #include "CollectionStatisticsStandard.hpp"
 #include "Collector.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
+#include "CopyScanCacheDeque.hpp"
 #include "CopyScanCacheList.hpp"
 #include "CopyScanCacheStandard.hpp"
 #include "CycleState.hpp"
 #include "GCExtensionsBase.hpp"
+#include "ObjectCopy.hpp"
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 #include "MasterGCThread.hpp"
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 #include "ScavengerDelegate.hpp"
+#include "ScavengerHotFieldProfile.hpp"
 
 struct J9HookInterface;
 class GC_ObjectScanner;
 class MM_AllocateDescription;
+class MM_RSCardOverflow;
+class MM_ScavengerPauseController;
+class MM_ConcurrentScavengerModeController;
 class MM_CollectorLanguageInterface;
 class MM_Dispatcher;
 class MM_EnvironmentBase;
 class MM_HeapRegionManager;
+class MM_MarkMap;
 class MM_MemoryPool;
 class MM_MemorySubSpace;
 class MM_MemorySubSpaceSemiSpace;
@@ -110,6 +117,19 @@ private:
 	omrthread_monitor_t _freeCacheMonitor; /**< monitor to synchronize threads on free list */
 	uintptr_t _waitingCountAliasThreshold; /**< Only alias a copy cache IF the number of threads waiting hasn't reached the threshold*/
 	volatile uintptr_t _waitingCount; /**< count of threads waiting  on scan cache queues (blocked via _scanCacheMonitor); threads never wait on _freeCacheMonitor */
+	MM_CopyScanCacheDeque **_scanCacheDeques; /**< per GC thread (indexed by slave ID) scan cache deques, allocated only if scavengerWorkStealing is enabled */
+	uintptr_t _scanCacheDequeCount; /**< number of entries in _scanCacheDeques */
+	volatile uintptr_t _stealingScanState; /**< work stealing termination state: _doneIndex of the current scan loop in the high bits, count of idle threads in the low bits */
+	MM_ScavengerHotFieldProfile *_hotFieldProfile; /**< per type hot field samples, allocated only if scavengerHotFieldProfiling is enabled */
+	MM_RSCardOverflow *_rsCardOverflow; /**< card granular remembered set overflow, allocated only if scavengerRememberedSetCardOverflow is enabled */
+	MM_ScavengerPauseController *_pauseController; /**< nursery sizing controller, allocated only if a scavengerPauseTarget is set */
+	uintptr_t _rememberedSetBatchCount; /**< number of batches of the remembered set puddles being scanned, if scavengerRememberedSetBatching is enabled */
+	volatile uintptr_t _rememberedSetBatchNext; /**< count of remembered set batches claimed so far */
+	volatile uintptr_t _rememberedSetBatchDone; /**< count of remembered set batches scanned so far */
+	uintptr_t _rememberedSetCardObjectBatchCount; /**< number of batches of the objects collected from the card overflow */
+	volatile uintptr_t _rememberedSetCardObjectBatchNext; /**< count of card overflow object batches claimed so far */
+	double _expectedSurvivalRate; /**< fraction of the evacuate space which survived the last scavenge, used to estimate the work of the next one */
+	MM_ObjectCopy _objectCopy; /**< copies object bodies, with a strategy picked by object size and destination space */
 	uintptr_t _cacheLineAlignment; /**< The number of bytes per cache line which is used to determine which boundaries in memory represent the beginning of a cache line */
 	volatile bool _rescanThreadsForRememberedObjects; /**< Indicates that thread-referenced objects were tenured and threads must be rescanned */
 
@@ -132,11 +152,13 @@ private:
 	
 	uint64_t _concurrentScavengerSwitchCount; /**< global counter of cycle start and cycle end transitions */
 	volatile bool _shouldYield; /**< Set by the first GC thread that observes that a criteria for yielding is met. Reset only when the concurrent phase is finished. */
+	uint64_t _yieldStartTime; /**< hi-res time _shouldYield was set at, the yield latency is measured from it */
+	MM_ConcurrentScavengerModeController *_modeController; /**< per cycle stop-the-world/concurrent mode selection, allocated only if concurrentScavengerAdaptive is enabled */
 
 	MM_ConcurrentPhaseStatsBase _concurrentPhaseStats;
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
-#define IS_CONCURRENT_ENABLED _extensions->isConcurrentScavengerEnabled()
+#define IS_CONCURRENT_ENABLED _extensions->isConcurrentScavengeCycle()
 
 protected:
 
@@ -236,6 +258,13 @@ public:
 	uintptr_t calculateCopyScanCacheSizeForWaitingThreads(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t waitingThreads);
 	uintptr_t calculateCopyScanCacheSizeForQueueLength(uintptr_t maxCacheSize, uintptr_t threadCount, uintptr_t scanCacheCount);
 	MMINLINE uintptr_t calculateOptimumCopyScanCacheSize(MM_EnvironmentStandard *env);
+	/**
+	 * Determine whether survivor memory lies in the survivor slice of the thread's NUMA node (numaAwareNursery only).
+	 * @param env current thread environment
+	 * @param addr base of the survivor memory
+	 * @return true if the memory is node local to the thread
+	 */
+	bool isNumaLocalSurvivorMemory(MM_EnvironmentStandard *env, void *addr);
 	MMINLINE MM_CopyScanCacheStandard *reserveMemoryForAllocateInSemiSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 	MM_CopyScanCacheStandard *reserveMemoryForAllocateInTenureSpace(MM_EnvironmentStandard *env, omrobjectptr_t objectToEvacuate, uintptr_t objectReserveSizeInBytes);
 
@@ -302,8 +331,77 @@ public:
 	
 	void deepScanOutline(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t priorityFieldOffset1, uintptr_t priorityFieldOffset2);
 
+	/**
+	 * Hot field profiling, called for each scanned reference slot of a non-indexable object, whether or not it caused a copy.
+	 * Samples the (object type, slot offset) pair every scavengerHotFieldSampleRate non-null slots and counts whether
+	 * the child shares a cache line with the slot.
+	 * @param env The environment.
+	 * @param objectPtr The object being scanned
+	 * @param slotObject The (already forwarded) slot of objectPtr
+	 */
+	MMINLINE void sampleHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, GC_SlotObject *slotObject);
+
+	/**
+	 * Copy the hot fields of a just copied child, so that they are placed right behind it.
+	 * @param env The environment.
+	 * @param childPtr The just copied child (in its new location)
+	 */
+	MMINLINE void copyHotFields(MM_EnvironmentStandard *env, omrobjectptr_t childPtr);
+
+	/**
+	 * Copy the child referred to from the hot field at the given offset of an object.
+	 * @param env The environment.
+	 * @param objectPtr The object (in its new location)
+	 * @param objectSize The consumed size of the object
+	 * @param hotFieldOffset The offset of the hot field in the object
+	 */
+	MMINLINE void copyHotField(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr, uintptr_t objectSize, uintptr_t hotFieldOffset);
+
 	MMINLINE bool scavengeRememberedObject(MM_EnvironmentStandard *env, omrobjectptr_t objectPtr);
+
+	/**
+	 * Scavenge the object in a (non-NULL) remembered set slot. The slot is flagged for deferred removal,
+	 * unless the object has to stay remembered.
+	 * @param env The environment.
+	 * @param slotPtr The remembered set slot
+	 */
+	MMINLINE void scavengeRememberedSetSlot(MM_EnvironmentStandard *env, omrobjectptr_t *slotPtr);
 	void scavengeRememberedSetList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Scavenge the remembered set puddles in batches of scavengerRememberedSetBatchSize entries, claimed atomically.
+	 * The puddles are walked in place and returned to the remembered set by the thread which completes the last batch.
+	 * @param env The environment.
+	 */
+	void scavengeRememberedSetListBatched(MM_EnvironmentStandard *env);
+
+	/**
+	 * Scavenge the objects collected from the remembered set card overflow at the beginning of the scavenge.
+	 * @param env The environment.
+	 */
+	void scavengeRememberedSetCardObjects(MM_EnvironmentStandard *env);
+
+	/**
+	 * Prune the objects collected from the remembered set card overflow: objects which are still remembered
+	 * are recorded by card again, the others are unremembered.
+	 * @param env The environment.
+	 */
+	void pruneRememberedSetCardObjects(MM_EnvironmentStandard *env);
+
+	/**
+	 * Collect the objects recorded by the remembered set card overflow, or fall back to the (full) remembered set
+	 * overflow if they can not be collected. Must be called by the master thread, before the remembered set overflow
+	 * state is cached for the scavenge.
+	 * @param env The environment.
+	 */
+	void masterSetupRememberedSetCardOverflow(MM_EnvironmentStandard *env);
+
+	/**
+	 * Partition the remembered set puddles being processed into batches for #scavengeRememberedSetListBatched().
+	 * Must be called by the master thread, after MM_SublistPool::startProcessingSublist().
+	 * @param env The environment.
+	 */
+	void masterSetupRememberedSetBatches(MM_EnvironmentStandard *env);
 	void scavengeRememberedSetOverflow(MM_EnvironmentStandard *env);
 	MMINLINE void flushRememberedSet(MM_EnvironmentStandard *env);
 	void pruneRememberedSetList(MM_EnvironmentStandard *env);
@@ -366,6 +464,39 @@ public:
 	MMINLINE uintptr_t copyCacheDistanceMetric(MM_CopyScanCacheStandard* cache);
 
 	MMINLINE MM_CopyScanCacheStandard *getNextScanCacheFromList(MM_EnvironmentStandard *env);
+
+	/**
+	 * Work stealing variant of the tail of getNextScanCache(): take a scan cache from the thread's own deque,
+	 * the shared overflow list or another thread's deque, and detect the end of the scan loop once all threads are idle.
+	 * @param env - current thread environment
+	 * @param doneIndex - _doneIndex of the current scan loop
+	 * @return a scan cache, or NULL if the scan loop is complete or aborted
+	 */
+	MM_CopyScanCacheStandard *getNextScanCacheWithStealing(MM_EnvironmentStandard *env, uintptr_t doneIndex);
+
+	/**
+	 * Try to steal a scan cache from the deques of other GC threads, starting after the current thread's own deque.
+	 * @param env - current thread environment
+	 * @return a stolen scan cache or NULL
+	 */
+	MMINLINE MM_CopyScanCacheStandard *stealScanCache(MM_EnvironmentStandard *env);
+
+	/**
+	 * Racy check, used by idle threads in work stealing mode, for scan caches on the shared list or any deque.
+	 * @return true if there appears to be a scan cache available
+	 */
+	MMINLINE bool isScanCacheAvailableToSteal();
+
+	/**
+	 * Approximate number of scan caches queued for scanning, on the shared list and (in work stealing mode) in all deques.
+	 */
+	MMINLINE uintptr_t getApproximateScanCacheCount();
+
+	/**
+	 * Number of threads currently out of scan work: blocked on _scanCacheMonitor, or idle in work stealing mode.
+	 * Used by heuristics (copy cache aliasing and sizing, array splitting), never for termination decisions.
+	 */
+	MMINLINE uintptr_t getWaitingCount();
 	void addCopyCachesToFreeList(MM_EnvironmentStandard *env);
 	MMINLINE void addCacheEntryToScanListAndNotify(MM_EnvironmentStandard *env, MM_CopyScanCacheStandard *newCacheEntry);
 
@@ -527,6 +658,13 @@ public:
 	void calcGCStats(MM_EnvironmentStandard *env);
 
 	void scavenge(MM_EnvironmentBase *env);
+	/**
+	 * Decide how many GC threads the scavenge should be dispatched to, from the bytes expected to survive
+	 * in the evacuate space and the size of the remembered set (see MM_GCExtensionsBase::scavengerWorkPerThread).
+	 * @param evacuateOccupancy bytes in use in the evacuate space
+	 * @return the thread count for the scavenge task, UDATA_MAX to use all available threads
+	 */
+	uintptr_t calculateThreadCountForScavenge(MM_EnvironmentStandard *env, uintptr_t evacuateOccupancy);
 	bool scavengeCompletedSuccessfully(MM_EnvironmentStandard *env);
 	virtual	void masterThreadGarbageCollect(MM_EnvironmentBase *env, MM_AllocateDescription *allocDescription, bool initMarkMap = false, bool rebuildMarkBits = false);
 
@@ -683,6 +821,13 @@ public:
 	bool isConcurrentInProgress() {
 		return concurrent_state_idle != _concurrentState;
 	}
+
+	/**
+	 * Account for a read barrier slow path call (copyObjectSlot() by a mutator thread during the concurrent phase) in the cycle stats.
+	 * @param startTime[in] hi-res time the call started at
+	 * @param copyCountBefore[in] objects copied by the thread (flipped and tenured) before the call
+	 */
+	void recordReadBarrierSlowPath(MM_EnvironmentStandard *env, uint64_t startTime, uintptr_t copyCountBefore);
 	
 	bool isMutatorThreadInSyncWithCycle(MM_EnvironmentBase *env) {
 		return (env->_concurrentScavengerSwitchCount == _concurrentScavengerSwitchCount);
@@ -811,6 +956,19 @@ public:
 	virtual bool heapAddRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress);
 	virtual bool heapRemoveRange(MM_EnvironmentBase *env, MM_MemorySubSpace *subspace, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
 
+	/**
+	 * Follow a range added to or removed from the heap with the remembered set card overflow (if enabled).
+	 * Called by the global collector for every range of the heap, since objects are recorded by card in tenure space.
+	 */
+	bool rememberedSetHeapAddRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress);
+	bool rememberedSetHeapRemoveRange(MM_EnvironmentBase *env, uintptr_t size, void *lowAddress, void *highAddress, void *lowValidAddress, void *highValidAddress);
+
+	/**
+	 * Drop the objects recorded by card which did not survive a global collect.
+	 * @param markMap[in] the mark map of the global collect, valid for the whole heap
+	 */
+	void retainMarkedRememberedSetCardObjects(MM_EnvironmentBase *env, MM_MarkMap *markMap);
+
 	virtual void collectorExpanded(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, uintptr_t expandSize);
 	virtual bool canCollectorExpand(MM_EnvironmentBase *env, MM_MemorySubSpace *subSpace, uintptr_t expandSize);
 	virtual uintptr_t getCollectorExpandSize(MM_EnvironmentBase *env);
@@ -848,6 +1006,19 @@ public:
 		, _freeCacheMonitor(NULL)
 		, _waitingCountAliasThreshold(0)
 		, _waitingCount(0)
+		, _scanCacheDeques(NULL)
+		, _scanCacheDequeCount(0)
+		, _stealingScanState(0)
+		, _hotFieldProfile(NULL)
+		, _rsCardOverflow(NULL)
+		, _pauseController(NULL)
+		, _rememberedSetBatchCount(0)
+		, _rememberedSetBatchNext(0)
+		, _rememberedSetBatchDone(0)
+		, _rememberedSetCardObjectBatchCount(0)
+		, _rememberedSetCardObjectBatchNext(0)
+		, _expectedSurvivalRate(1.0)
+		, _objectCopy()
 		, _cacheLineAlignment(0)
 #if !defined(OMR_GC_CONCURRENT_SCAVENGER)
 		, _rescanThreadsForRememberedObjects(false)
@@ -861,6 +1032,8 @@ public:
 		, _concurrentState(concurrent_state_idle)
 		, _concurrentScavengerSwitchCount(0)
 		, _shouldYield(false)
+		, _yieldStartTime(0)
+		, _modeController(NULL)
 #endif /* #if defined(OMR_GC_CONCURRENT_SCAVENGER) */
 
 		, _omrVM(env->getOmrVM())
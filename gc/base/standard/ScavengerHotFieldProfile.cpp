@@ -0,0 +1,168 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrport.h"
+
+#include "ModronAssertions.h"
+#include "ScavengerHotFieldProfile.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* a slot has to be sampled at least this many times (decayed) before it is considered hot */
+#define HOT_FIELD_MINIMUM_SAMPLE_COUNT 16
+/* a slot has to account for at least 1/HOT_FIELD_MINIMUM_SHARE_DIVISOR of the samples of its type to be considered hot */
+#define HOT_FIELD_MINIMUM_SHARE_DIVISOR 4
+
+MM_ScavengerHotFieldProfile *
+MM_ScavengerHotFieldProfile::newInstance(MM_EnvironmentBase *env, uintptr_t tableSize)
+{
+	MM_ScavengerHotFieldProfile *profile = (MM_ScavengerHotFieldProfile *)env->getForge()->allocate(sizeof(MM_ScavengerHotFieldProfile), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != profile) {
+		new(profile) MM_ScavengerHotFieldProfile();
+		if (!profile->initialize(env, tableSize)) {
+			profile->kill(env);
+			profile = NULL;
+		}
+	}
+	return profile;
+}
+
+void
+MM_ScavengerHotFieldProfile::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerHotFieldProfile::initialize(MM_EnvironmentBase *env, uintptr_t tableSize)
+{
+	Assert_MM_true((0 != tableSize) && (0 == (tableSize & (tableSize - 1))));
+
+	_table = (TypeEntry *)env->getForge()->allocate(sizeof(TypeEntry) * tableSize, OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL == _table) {
+		return false;
+	}
+	memset((void *)_table, 0, sizeof(TypeEntry) * tableSize);
+	_tableMask = tableSize - 1;
+
+	return true;
+}
+
+void
+MM_ScavengerHotFieldProfile::tearDown(MM_EnvironmentBase *env)
+{
+	if (NULL != _table) {
+		env->getForge()->free(_table);
+		_table = NULL;
+	}
+}
+
+void
+MM_ScavengerHotFieldProfile::sample(uintptr_t typeKey, uintptr_t slotOffset)
+{
+	if (0 == typeKey) {
+		/* 0 marks unused table entries */
+		return;
+	}
+
+	TypeEntry *entry = findEntry(typeKey, true);
+	if (NULL != entry) {
+		uintptr_t replaceIndex = 0;
+		for (uintptr_t i = 0; i < HOT_FIELD_CANDIDATE_COUNT; i++) {
+			if (slotOffset == entry->_candidateOffset[i]) {
+				entry->_candidateCount[i] += 1;
+				return;
+			}
+			if (entry->_candidateCount[i] < entry->_candidateCount[replaceIndex]) {
+				replaceIndex = i;
+			}
+		}
+		/* Space saving: the least sampled candidate makes room for the new offset, which inherits its count.
+		 * Counts stay an upper bound of the real frequency and a truly hot slot can not be pushed out.
+		 */
+		entry->_candidateOffset[replaceIndex] = slotOffset;
+		entry->_candidateCount[replaceIndex] += 1;
+	}
+}
+
+void
+MM_ScavengerHotFieldProfile::update(MM_EnvironmentBase *env)
+{
+	uintptr_t usedEntries = 0;
+	uintptr_t hotTypeCount = 0;
+
+	for (uintptr_t index = 0; index <= _tableMask; index++) {
+		TypeEntry *entry = &_table[index];
+		if (0 == entry->_typeKey) {
+			continue;
+		}
+		usedEntries += 1;
+
+		uintptr_t totalCount = 0;
+		uintptr_t first = HOT_FIELD_CANDIDATE_COUNT;
+		uintptr_t second = HOT_FIELD_CANDIDATE_COUNT;
+		for (uintptr_t i = 0; i < HOT_FIELD_CANDIDATE_COUNT; i++) {
+			uintptr_t count = entry->_candidateCount[i];
+			totalCount += count;
+			if ((HOT_FIELD_CANDIDATE_COUNT == first) || (count > entry->_candidateCount[first])) {
+				second = first;
+				first = i;
+			} else if ((HOT_FIELD_CANDIDATE_COUNT == second) || (count > entry->_candidateCount[second])) {
+				second = i;
+			}
+		}
+
+		uintptr_t hotFieldOffset1 = 0;
+		uintptr_t hotFieldOffset2 = 0;
+		uintptr_t minimumCount = OMR_MAX(HOT_FIELD_MINIMUM_SAMPLE_COUNT, totalCount / HOT_FIELD_MINIMUM_SHARE_DIVISOR);
+		if (entry->_candidateCount[first] >= minimumCount) {
+			hotFieldOffset1 = entry->_candidateOffset[first];
+			if (entry->_candidateCount[second] >= minimumCount) {
+				hotFieldOffset2 = entry->_candidateOffset[second];
+			}
+			hotTypeCount += 1;
+		}
+		entry->_hotFieldOffset1 = hotFieldOffset1;
+		entry->_hotFieldOffset2 = hotFieldOffset2;
+
+		/* decay, so that the profile follows phase changes of the application */
+		for (uintptr_t i = 0; i < HOT_FIELD_CANDIDATE_COUNT; i++) {
+			entry->_candidateCount[i] >>= 1;
+		}
+	}
+
+	if (usedEntries > ((_tableMask + 1) / 4 * 3)) {
+		/* Entries are never removed (that would break probe sequences), so start over once the table gets
+		 * crowded and new types can no longer find a slot. Hot fields are rediscovered within a few scavenges.
+		 */
+		memset((void *)_table, 0, sizeof(TypeEntry) * (_tableMask + 1));
+		hotTypeCount = 0;
+	}
+
+	_hotTypeCount = hotTypeCount;
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
@@ -0,0 +1,173 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERHOTFIELDPROFILE_HPP_)
+#define SCAVENGERHOTFIELDPROFILE_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "AtomicOperations.hpp"
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+#define HOT_FIELD_CANDIDATE_COUNT 4
+
+/**
+ * Language neutral hot field profiler for the Scavenger.
+ * GC threads sample (parent type, reference slot offset) pairs of copied references into a fixed size
+ * side table keyed by MM_ObjectModelBase::getObjectHeaderTypeKey(). At the end of each scavenge the
+ * table is digested into (up to) two hot field offsets per type, which the Scavenger uses to copy the
+ * hot children of an object right after the object itself. Updates are racy: lost samples only make
+ * the profile slightly less accurate.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerHotFieldProfile : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	struct TypeEntry {
+		volatile uintptr_t _typeKey; /**< type key of the entry, 0 if the entry is unused */
+		uintptr_t _hotFieldOffset1; /**< offset of the hottest reference slot, 0 if none */
+		uintptr_t _hotFieldOffset2; /**< offset of the second hottest reference slot, 0 if none */
+		uintptr_t _candidateOffset[HOT_FIELD_CANDIDATE_COUNT]; /**< slot offsets being counted for this type */
+		uintptr_t _candidateCount[HOT_FIELD_CANDIDATE_COUNT]; /**< (decayed) sample counts of the candidate offsets */
+	};
+
+	TypeEntry *_table; /**< open addressing hash table of types */
+	uintptr_t _tableMask; /**< number of table entries - 1 */
+	uintptr_t _hotTypeCount; /**< number of types with at least one hot field after the last update */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	MMINLINE uintptr_t
+	hash(uintptr_t typeKey)
+	{
+		/* type keys are mostly aligned pointers or small shifted integers, mix the bits before masking */
+		uintptr_t hash = typeKey ^ (typeKey >> 7) ^ (typeKey >> 17);
+		return hash & _tableMask;
+	}
+
+	/**
+	 * Find the entry for the type, optionally claiming a free one.
+	 * @return the entry, or NULL if the type is not in the table (or no entry could be claimed)
+	 */
+	MMINLINE TypeEntry *
+	findEntry(uintptr_t typeKey, bool claim)
+	{
+		uintptr_t index = hash(typeKey);
+		for (uintptr_t probe = 0; probe < 8; probe++) {
+			TypeEntry *entry = &_table[(index + probe) & _tableMask];
+			uintptr_t entryKey = entry->_typeKey;
+			if (typeKey == entryKey) {
+				return entry;
+			}
+			if (0 == entryKey) {
+				if (!claim) {
+					break;
+				}
+				entryKey = MM_AtomicOperations::lockCompareExchange(&entry->_typeKey, 0, typeKey);
+				if ((0 == entryKey) || (typeKey == entryKey)) {
+					return entry;
+				}
+			}
+		}
+		return NULL;
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env, uintptr_t tableSize);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerHotFieldProfile *newInstance(MM_EnvironmentBase *env, uintptr_t tableSize);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Record that a reference stored at the given offset in an object of the given type was followed.
+	 * @param typeKey[in] type key of the parent object
+	 * @param slotOffset[in] offset of the reference slot from the start of the parent object
+	 */
+	void sample(uintptr_t typeKey, uintptr_t slotOffset);
+
+	/**
+	 * Get the hot field offsets of a type, as found by the last update().
+	 * @param typeKey[in] type key of the object
+	 * @param hotFieldOffset1[out] offset of the hottest reference slot
+	 * @param hotFieldOffset2[out] offset of the second hottest reference slot, or 0
+	 * @return true if the type has at least one hot field
+	 */
+	MMINLINE bool
+	getHotFieldOffsets(uintptr_t typeKey, uintptr_t *hotFieldOffset1, uintptr_t *hotFieldOffset2)
+	{
+		TypeEntry *entry = findEntry(typeKey, false);
+		if ((NULL != entry) && (0 != entry->_hotFieldOffset1)) {
+			*hotFieldOffset1 = entry->_hotFieldOffset1;
+			*hotFieldOffset2 = entry->_hotFieldOffset2;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+	 * Recalculate the hot fields of all types from the samples collected so far and decay the sample counts.
+	 * Must be called by a single thread, while no GC thread is sampling.
+	 * @param env[in] the master thread
+	 */
+	void update(MM_EnvironmentBase *env);
+
+	/**
+	 * @return number of types with at least one hot field after the last update
+	 */
+	MMINLINE uintptr_t getHotTypeCount() { return _hotTypeCount; }
+
+	/**
+	 * Create a ScavengerHotFieldProfile object.
+	 */
+	MM_ScavengerHotFieldProfile()
+		: MM_BaseVirtual()
+		, _table(NULL)
+		, _tableMask(0)
+		, _hotTypeCount(0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* SCAVENGERHOTFIELDPROFILE_HPP_ */
@@ -0,0 +1,198 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+#include <string.h>
+
+#include "omrcfg.h"
+#include "omrgcconsts.h"
+#include "omrport.h"
+
+#include "ScavengerPauseController.hpp"
+#include "ScavengerStats.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* fraction of the pause target the projected pauses are sized for, leaving room for pauses above the average */
+#define PAUSE_TARGET_HEADROOM 0.9
+/* survivor space to reserve, relative to the expected bytes flipped */
+#define SURVIVOR_SPACE_HEADROOM 1.1
+
+MM_ScavengerPauseController *
+MM_ScavengerPauseController::newInstance(MM_EnvironmentBase *env)
+{
+	MM_ScavengerPauseController *controller = (MM_ScavengerPauseController *)env->getForge()->allocate(sizeof(MM_ScavengerPauseController), OMR::GC::AllocationCategory::FIXED, OMR_GET_CALLSITE());
+	if (NULL != controller) {
+		new(controller) MM_ScavengerPauseController(env);
+		if (!controller->initialize(env)) {
+			controller->kill(env);
+			controller = NULL;
+		}
+	}
+	return controller;
+}
+
+void
+MM_ScavengerPauseController::kill(MM_EnvironmentBase *env)
+{
+	tearDown(env);
+	env->getForge()->free(this);
+}
+
+bool
+MM_ScavengerPauseController::initialize(MM_EnvironmentBase *env)
+{
+	memset(_pauseHistory, 0, sizeof(_pauseHistory));
+	return true;
+}
+
+void
+MM_ScavengerPauseController::tearDown(MM_EnvironmentBase *env)
+{
+}
+
+void
+MM_ScavengerPauseController::recordPause(uint64_t pauseTime)
+{
+	_pauseHistory[_pauseHistoryNext] = pauseTime;
+	_pauseHistoryNext = (_pauseHistoryNext + 1) % SCAVENGER_PAUSE_HISTORY_SIZE;
+	if (_pauseHistoryCount < SCAVENGER_PAUSE_HISTORY_SIZE) {
+		_pauseHistoryCount += 1;
+	}
+}
+
+uint64_t
+MM_ScavengerPauseController::getPausePercentile99()
+{
+	uint64_t sorted[SCAVENGER_PAUSE_HISTORY_SIZE];
+	uintptr_t count = _pauseHistoryCount;
+
+	/* insertion sort, the history is small */
+	for (uintptr_t i = 0; i < count; i++) {
+		uint64_t pause = _pauseHistory[i];
+		uintptr_t j = i;
+		while ((j > 0) && (sorted[j - 1] > pause)) {
+			sorted[j] = sorted[j - 1];
+			j -= 1;
+		}
+		sorted[j] = pause;
+	}
+
+	/* nearest rank */
+	uintptr_t rank = ((count * 99) + 99) / 100;
+	return (0 == rank) ? 0 : sorted[rank - 1];
+}
+
+void
+MM_ScavengerPauseController::update(MM_EnvironmentBase *env, uintptr_t allocateSpaceSize, uintptr_t nurserySize)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(env->getPortLibrary());
+	MM_ScavengerStats *incrementStats = &_extensions->incrementScavengerStats;
+	MM_ScavengerStats *stats = &_extensions->scavengerStats;
+	bool firstSample = (0 == _pauseHistoryCount);
+
+	/* the wall clock might be shifted backwards externally, such a scavenge gives no usable sample */
+	if (incrementStats->_endTime < incrementStats->_startTime) {
+		_lastScavengeEndTime = 0;
+		return;
+	}
+
+	uint64_t pauseTime = omrtime_hires_delta(incrementStats->_startTime, incrementStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+	recordPause(pauseTime);
+
+	uintptr_t copiedBytes = stats->_flipBytes + stats->_tenureAggregateBytes;
+	if (0 != pauseTime) {
+		_averageCopyRate = average(_averageCopyRate, (double)copiedBytes * 1000.0 / (double)pauseTime, firstSample);
+	}
+	if (0 != allocateSpaceSize) {
+		_averageSurvivorRate = average(_averageSurvivorRate, (double)copiedBytes / (double)allocateSpaceSize, firstSample);
+	}
+	_averageFlipBytes = average(_averageFlipBytes, (double)(stats->_flipBytes + stats->_failedFlipBytes), firstSample);
+
+	if ((0 != _lastScavengeEndTime) && (incrementStats->_startTime >= _lastScavengeEndTime)) {
+		uint64_t intervalTime = omrtime_hires_delta(_lastScavengeEndTime, incrementStats->_endTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		if (0 != intervalTime) {
+			_averageGCTimeRatio = average(_averageGCTimeRatio, (double)pauseTime / (double)intervalTime, (0.0 == _averageGCTimeRatio));
+		}
+	}
+	_lastScavengeEndTime = incrementStats->_endTime;
+
+	uint64_t pauseTarget = (uint64_t)_extensions->scavengerPauseTarget * 1000;
+	uint64_t pausePercentile99 = getPausePercentile99();
+	double gcTimeBudget = 1.0 - _extensions->scavengerThroughputGoal;
+	double nurseryFactor = 1.0;
+
+	if (pausePercentile99 > pauseTarget) {
+		/* copy no more than the target allows at the observed copy rate, from an allocate space sized by the survivor rate */
+		double contraction = _extensions->dnssMaximumContraction;
+		if ((_averageCopyRate > 0.0) && (_averageSurvivorRate > 0.0) && (0 != allocateSpaceSize)) {
+			double desiredCopiedBytes = _averageCopyRate * (double)_extensions->scavengerPauseTarget * PAUSE_TARGET_HEADROOM;
+			double desiredAllocateSpaceSize = desiredCopiedBytes / _averageSurvivorRate;
+			contraction = 1.0 - (desiredAllocateSpaceSize / (double)allocateSpaceSize);
+		}
+		contraction = OMR_MIN(contraction, _extensions->dnssMaximumContraction);
+		contraction = OMR_MAX(contraction, _extensions->dnssMinimumContraction);
+		if (contraction > 0.0) {
+			stats->_pauseTargetContractSize = (uintptr_t)((double)nurserySize * contraction);
+			nurseryFactor -= contraction;
+		}
+	} else if ((gcTimeBudget > 0.0) && (_averageGCTimeRatio > gcTimeBudget)) {
+		/* the bytes copied by a scavenge hardly depend on the nursery size, so fewer scavenges cut the time spent scavenging */
+		double expansion = (_averageGCTimeRatio / gcTimeBudget) - 1.0;
+		/* but assume the survivors grow with the allocate space, and keep the pauses within the target */
+		if (0 != pausePercentile99) {
+			expansion = OMR_MIN(expansion, ((double)pauseTarget * PAUSE_TARGET_HEADROOM / (double)pausePercentile99) - 1.0);
+		}
+		expansion = OMR_MIN(expansion, _extensions->dnssMaximumExpansion);
+		if ((expansion > 0.0) && (expansion >= _extensions->dnssMinimumExpansion)) {
+			stats->_pauseTargetExpandSize = (uintptr_t)((double)nurserySize * expansion);
+			nurseryFactor += expansion;
+		}
+	}
+
+	/* survivors are expected to scale with the allocate space */
+	double expectedFlipBytes = OMR_MAX(_averageFlipBytes, (double)(stats->_flipBytes + stats->_failedFlipBytes)) * nurseryFactor;
+	stats->_pauseTargetSurvivorSize = (uintptr_t)(expectedFlipBytes * SURVIVOR_SPACE_HEADROOM);
+
+	if (_extensions->scvTenureStrategyAdaptive) {
+		uintptr_t tenureAge = _extensions->scvTenureAdaptiveTenureAge;
+		if ((pausePercentile99 > pauseTarget) && (stats->_flipBytes > stats->_tenureAggregateBytes)) {
+			/* objects copied back and forth between the semispaces dominate the pause, tenure them sooner */
+			if (tenureAge > OBJECT_HEADER_AGE_MIN) {
+				tenureAge -= 1;
+			}
+		} else if ((pausePercentile99 < (pauseTarget / 2)) && (stats->_tenureAggregateBytes > stats->_flipBytes)) {
+			/* the pauses leave room to keep objects in the nursery longer, and tenure fewer of them */
+			if (tenureAge < OBJECT_HEADER_AGE_MAX) {
+				tenureAge += 1;
+			}
+		}
+		_extensions->scvTenureAdaptiveTenureAge = tenureAge;
+		stats->_pauseTargetTenureAge = tenureAge;
+	}
+
+	stats->_pauseTargetP99Time = pausePercentile99;
+	stats->_pauseTargetCopyRate = (uintptr_t)_averageCopyRate;
+	stats->_pauseTargetSurvivorRate = (uintptr_t)(_averageSurvivorRate * 100.0);
+	stats->_pauseTargetGCTimeRatio = (uintptr_t)(_averageGCTimeRatio * 100.0);
+}
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
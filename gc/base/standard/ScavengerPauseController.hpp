@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/**
+ * @file
+ * @ingroup GC_Modron_Standard
+ */
+
+#if !defined(SCAVENGERPAUSECONTROLLER_HPP_)
+#define SCAVENGERPAUSECONTROLLER_HPP_
+
+#include "omrcfg.h"
+#include "modronopt.h"
+
+#include "BaseVirtual.hpp"
+#include "EnvironmentBase.hpp"
+#include "GCExtensionsBase.hpp"
+
+#if defined(OMR_GC_MODRON_SCAVENGER)
+
+/* number of recent scavenge pauses the 99th percentile is taken from, enough for it to leave out the two longest */
+#define SCAVENGER_PAUSE_HISTORY_SIZE 200
+
+/**
+ * Nursery sizing feedback controller driven by a scavenge pause target (scavengerPauseTarget).
+ * After each successful scavenge the controller compares the 99th percentile of the recent pauses against
+ * the target, and the time spent scavenging against scavengerThroughputGoal.  From the observed copy rate
+ * and survivor rate it projects how large the nursery can be for the pauses to stay within the target, and
+ * asks for the nursery to be contracted when the target is exceeded, or expanded when the throughput goal
+ * is missed and the pauses leave room for it.  It also sizes the survivor space (tilt) from the bytes flipped
+ * and moves the adaptive tenure age by one step at a time.
+ * The decisions are recorded in the cycle scavenger stats, where they are picked up by verbose GC and
+ * applied by MM_MemorySubSpaceSemiSpace::checkResize() in place of the dnss and tilt heuristics.
+ * @ingroup GC_Modron_Standard
+ */
+class MM_ScavengerPauseController : public MM_BaseVirtual
+{
+	/*
+	 * Data members
+	 */
+private:
+	MM_GCExtensionsBase *_extensions;
+	uint64_t _pauseHistory[SCAVENGER_PAUSE_HISTORY_SIZE]; /**< ring buffer of the recent scavenge pauses, in microseconds */
+	uintptr_t _pauseHistoryCount; /**< number of valid entries in _pauseHistory */
+	uintptr_t _pauseHistoryNext; /**< index of the entry the next pause is recorded in */
+	uint64_t _lastScavengeEndTime; /**< hi-res time the previous scavenge ended at, 0 before the first scavenge */
+	double _averageCopyRate; /**< weighted average of the bytes copied per millisecond of pause */
+	double _averageSurvivorRate; /**< weighted average of the fraction of the allocate space copied by a scavenge */
+	double _averageGCTimeRatio; /**< weighted average of the fraction of time spent scavenging */
+	double _averageFlipBytes; /**< weighted average of the bytes flipped into the survivor space */
+
+protected:
+public:
+
+	/*
+	 * Function members
+	 */
+private:
+	void recordPause(uint64_t pauseTime);
+
+	/**
+	 * @return the 99th percentile of the recorded pauses, in microseconds (the longest pause until 100 are recorded)
+	 */
+	uint64_t getPausePercentile99();
+
+	/**
+	 * Fold a new sample into a weighted average, the first sample becomes the average.
+	 */
+	MMINLINE double
+	average(double currentAverage, double sample, bool firstSample)
+	{
+		return firstSample ? sample : ((currentAverage * 0.7) + (sample * 0.3));
+	}
+
+protected:
+	bool initialize(MM_EnvironmentBase *env);
+	virtual void tearDown(MM_EnvironmentBase *env);
+
+public:
+	static MM_ScavengerPauseController *newInstance(MM_EnvironmentBase *env);
+	virtual void kill(MM_EnvironmentBase *env);
+
+	/**
+	 * Feed the controller with the statistics of a successful scavenge, and record its decisions for the
+	 * nursery size, the survivor space size and the tenure age in the cycle scavenger stats.
+	 * Must be called by the master thread, after the scavenge stats have been merged.
+	 * @param env[in] the master thread
+	 * @param allocateSpaceSize[in] size of the allocate space that was evacuated by the scavenge
+	 * @param nurserySize[in] current size of the nursery (allocate and survivor space)
+	 */
+	void update(MM_EnvironmentBase *env, uintptr_t allocateSpaceSize, uintptr_t nurserySize);
+
+	/**
+	 * Create a ScavengerPauseController object.
+	 */
+	MM_ScavengerPauseController(MM_EnvironmentBase *env)
+		: MM_BaseVirtual()
+		, _extensions(env->getExtensions())
+		, _pauseHistoryCount(0)
+		, _pauseHistoryNext(0)
+		, _lastScavengeEndTime(0)
+		, _averageCopyRate(0.0)
+		, _averageSurvivorRate(0.0)
+		, _averageGCTimeRatio(0.0)
+		, _averageFlipBytes(0.0)
+	{
+		_typeId = __FUNCTION__;
+	}
+};
+
+#endif /* OMR_GC_MODRON_SCAVENGER */
+
+#endif /* SCAVENGERPAUSECONTROLLER_HPP_ */
@@ -31,6 +31,9 @@
 #include "ObjectModel.hpp"
 #include "Scavenger.hpp"
 #include "SlotObject.hpp"
+#if defined(OMR_GC_SEGREGATED_HEAP)
+#include "SegregatedGC.hpp"
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 
 struct OMR_VMThread;
 
@@ -38,8 +41,8 @@ struct OMR_VMThread;
  * Out-of-line write barrier. In the absence of other (equivalent inline) write barrier, this method must
  * be called whenever a child reference is assigned to a parent slot.
  *
- * To support OMR concurrent marking and/or generational collectors, this method calls the necessary
- * concurrent and generational write barriers.
+ * To support OMR concurrent marking and/or generational collectors (including the generational mode of
+ * the segregated heap), this method calls the necessary concurrent and generational write barriers.
  *
  * @param omrThread The thread making the assignment of child reference into parent slot
  * @param parentObject the parent object
@@ -48,7 +51,7 @@ struct OMR_VMThread;
 MMINLINE void
 standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrobjectptr_t childObject)
 {
-#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK)
+#if defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP)
 	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
 	MM_GCExtensionsBase *extensions = env->getExtensions();
 #if defined(OMR_GC_MODRON_SCAVENGER)
@@ -66,7 +69,40 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
 		extensions->cardTable->dirtyCard(env, parentObject);
 	}
 #endif /* defined(OMR_GC_MODRON_CONCURRENT_MARK) */
-#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) */
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	if (extensions->isSegregatedHeap() && extensions->segregatedGenerational) {
+		((MM_SegregatedGC *)extensions->getGlobalCollector())->getMarkingScheme()->rememberObject(env, parentObject, childObject);
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
+#endif /* defined(OMR_GC_MODRON_SCAVENGER) || defined(OMR_GC_MODRON_CONCURRENT_MARK) || defined(OMR_GC_SEGREGATED_HEAP) */
+}
+
+/**
+ * Out-of-line pre-write barrier. In the absence of other (equivalent inline) barrier, this method must be
+ * called before a child reference is assigned to a parent slot, while the slot still holds the reference
+ * that is about to be overwritten.
+ *
+ * To support the snapshot-at-the-beginning incremental mark of the segregated heap, this method records
+ * the overwritten reference while the mark is active.
+ *
+ * @param omrThread The thread making the assignment of child reference into parent slot
+ * @param parentObject the parent object
+ * @param parentSlot Points to the slot in the parent object that will receive the child reference
+ */
+MMINLINE void
+standardPreWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot)
+{
+#if defined(OMR_GC_SEGREGATED_HEAP)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if (extensions->isSegregatedHeap() && extensions->segregatedIncremental) {
+		MM_SegregatedMarkingScheme *markingScheme = ((MM_SegregatedGC *)extensions->getGlobalCollector())->getMarkingScheme();
+		if (markingScheme->isIncrementalMarkActive()) {
+			GC_SlotObject slotObject(omrThread->_vm, parentSlot);
+			markingScheme->snapshotObject(env, slotObject.readReferenceFromSlot());
+		}
+	}
+#endif /* defined(OMR_GC_SEGREGATED_HEAP) */
 }
 
 /**
@@ -77,11 +113,14 @@ standardWriteBarrier(OMR_VMThread *omrThread, omrobjectptr_t parentObject, omrob
  * @param parentObject the parent object
  * @param parentSlot Points to the slot in the parent object that will receive the child reference
  * @param childObject THe child object reference
+ * @see standardPreWriteBarrier(OMR_VMThread *, omrobjectptr_t, fomrobject_t *)
  * @see standardWriteBarrier(OMR_VMThread *, omrobjectptr_t, omrobjectptr_t)
  */
 MMINLINE void
 standardWriteBarrierStore(OMR_VMThread *omrThread, omrobjectptr_t parentObject, fomrobject_t *parentSlot, omrobjectptr_t childObject)
 {
+	standardPreWriteBarrier(omrThread, parentObject, parentSlot);
+
 	GC_SlotObject slotObject(omrThread->_vm, parentSlot);
 	slotObject.writeReferenceToSlot(childObject);
 
@@ -66,6 +66,7 @@ typedef struct MM_CommonGCStartData {
 	uintptr_t tlhAllocCount; /**&lt; number of TLHs allocated since the last GC */
 	uintptr_t tlhAllocBytes; /**&lt; number of bytes allocated for TLHs since the last GC */
 	uintptr_t tlhRequestedBytes; /**&lt; number of bytes requested for TLHs since the last GC */
+	uintptr_t tlhAbandonedBytes; /**&lt; number of bytes in TLH remainders given back to the heap without being allocated since the last GC */
 	uintptr_t nonTlhAllocCount; /**&lt; number of non-TLH allocates since the last GC */
 	uintptr_t nonTlhAllocBytes; /**&lt; number of bytes allocated for other than for TLHs since the last GC */
 } MM_CommonGCStartData;
@@ -32,6 +32,25 @@
 #include "omrcomp.h"
 #include "j9nongenerated.h"
 
+/* Orders for OMR_GC_GetAllocationSites() */
+#define OMR_GC_ALLOCATION_SITES_BY_BYTES 0 /* by estimated bytes allocated */
+#define OMR_GC_ALLOCATION_SITES_BY_SURVIVAL 1 /* by estimated bytes surviving their first collection */
+
+/* An allocation site profiled by the allocation site sampler (-Xgc:allocationSiteSampleInterval) */
+typedef struct OMR_GC_AllocationSite {
+	uintptr_t site; /* identifier of the site returned by the language */
+	uintptr_t sampleCount; /* number of allocations sampled at the site */
+	uintptr_t sampledBytes; /* total size of the allocations sampled at the site */
+	uintptr_t survivorCount; /* number of sampled allocations which survived their first collection */
+	uintptr_t survivorBytes; /* total size of the sampled allocations which survived their first collection */
+	uint64_t estimatedBytes; /* estimated bytes allocated at the site (sampleCount x sample interval) */
+	uint64_t estimatedSurvivorBytes; /* estimated bytes allocated at the site which survived their first collection */
+} OMR_GC_AllocationSite;
+
+/* Called by OMR_GC_ParallelIterateObjects() for each live object, on the GC thread walking the object.
+ * threadContext is the context of the calling thread, threadContexts[threadIndex] */
+typedef void (*OMR_GC_IterateObjectFunction)(OMR_VMThread *omrVMThread, omrobjectptr_t object, uintptr_t threadIndex, void *threadContext);
+
 /* Runtime API (C) */
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +61,16 @@ omrobjectptr_t OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, uintptr_t alloc
 
 omr_error_t OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode);
 
+/* Copy the top allocation sites in the given order into sites, highest first. Returns OMR_ERROR_NOT_AVAILABLE if sampling is not enabled */
+omr_error_t OMR_GC_GetAllocationSites(OMR_VMThread* omrVMThread, uint32_t order, OMR_GC_AllocationSite *sites, uintptr_t count, uintptr_t *written);
+
+/* Walk the live objects of the heap in parallel on the GC threads, calling function for each of them with the context of the
+ * calling thread. At most threadContextCount threads are used, the number used is stored in threadsUsed. The heap is split in
+ * chunks dealt round robin to the threads in address order, so that each thread walks the same objects from one walk to the next
+ * of an unchanged heap. Exclusive VM access is acquired for the walk. Returns OMR_ERROR_NOT_AVAILABLE if the collector does not
+ * support parallel walks */
+omr_error_t OMR_GC_ParallelIterateObjects(OMR_VMThread* omrVMThread, OMR_GC_IterateObjectFunction function, void **threadContexts, uintptr_t threadContextCount, uintptr_t *threadsUsed);
+
 #ifdef __cplusplus
 } /* extern "C" { */
 #endif
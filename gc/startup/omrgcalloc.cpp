@@ -25,11 +25,35 @@
 #include "objectdescription.h"
 
 #include "AllocateInitialization.hpp"
+#include "AllocationSiteSampler.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
 #include "Heap.hpp"
 #include "omrgcstartup.hpp"
 #include "ModronAssertions.h"
+#if defined(OMR_GC_MODRON_STANDARD)
+#include "ParallelGlobalGC.hpp"
+#include "ParallelHeapWalker.hpp"
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+
+#if defined(OMR_GC_MODRON_STANDARD)
+/**
+ * Arguments of an OMR_GC_ParallelIterateObjects() walk, shared by the walking threads.
+ */
+typedef struct ParallelIterateObjectsData {
+	OMR_GC_IterateObjectFunction function;
+	void **threadContexts;
+} ParallelIterateObjectsData;
+
+static void
+parallelIterateObjectsDo(OMR_VMThread *omrVMThread, MM_HeapRegionDescriptor *region, omrobjectptr_t object, void *userData)
+{
+	ParallelIterateObjectsData *data = (ParallelIterateObjectsData *)userData;
+	/* the walking threads are the slave threads 0 to the number of threads used - 1 */
+	uintptr_t threadIndex = MM_EnvironmentBase::getEnvironment(omrVMThread)->getSlaveID();
+	data->function(omrVMThread, object, threadIndex, data->threadContexts[threadIndex]);
+}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
 
 omrobjectptr_t
 OMR_GC_AllocateObject(OMR_VMThread * omrVMThread, MM_AllocateInitialization *allocator)
@@ -60,3 +84,49 @@ OMR_GC_SystemCollect(OMR_VMThread* omrVMThread, uint32_t gcCode)
 	}
 	return result;
 }
+
+omr_error_t
+OMR_GC_GetAllocationSites(OMR_VMThread* omrVMThread, uint32_t order, OMR_GC_AllocationSite *sites, uintptr_t count, uintptr_t *written)
+{
+	omr_error_t result = OMR_ERROR_NONE;
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_AllocationSiteSampler *sampler = env->getExtensions()->allocationSiteSampler;
+	if (NULL == sampler) {
+		result = OMR_ERROR_NOT_AVAILABLE;
+	} else if ((OMR_GC_ALLOCATION_SITES_BY_BYTES != order) && (OMR_GC_ALLOCATION_SITES_BY_SURVIVAL != order)) {
+		result = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if ((NULL == written) || ((0 != count) && (NULL == sites))) {
+		result = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else {
+		*written = sampler->getSites(order, sites, count);
+	}
+	return result;
+}
+
+omr_error_t
+OMR_GC_ParallelIterateObjects(OMR_VMThread* omrVMThread, OMR_GC_IterateObjectFunction function, void **threadContexts, uintptr_t threadContextCount, uintptr_t *threadsUsed)
+{
+	omr_error_t result = OMR_ERROR_NOT_AVAILABLE;
+#if defined(OMR_GC_MODRON_STANDARD)
+	MM_EnvironmentBase *env = MM_EnvironmentBase::getEnvironment(omrVMThread);
+	MM_GCExtensionsBase *extensions = env->getExtensions();
+	if ((NULL == function) || (NULL == threadContexts) || (0 == threadContextCount) || (NULL == threadsUsed)) {
+		result = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else if (extensions->isStandardGC()) {
+		result = OMR_ERROR_NONE;
+		if (NULL == extensions->getGlobalCollector()) {
+			result = OMR_GC_InitializeCollector(omrVMThread);
+		}
+		if (OMR_ERROR_NONE == result) {
+			MM_ParallelGlobalGC *globalCollector = (MM_ParallelGlobalGC *)extensions->getGlobalCollector();
+			MM_ParallelHeapWalker *heapWalker = (MM_ParallelHeapWalker *)globalCollector->getHeapWalker();
+			ParallelIterateObjectsData data = { function, threadContexts };
+
+			env->acquireExclusiveVMAccessForGC(globalCollector);
+			*threadsUsed = heapWalker->liveObjectsDoParallel(env, parallelIterateObjectsDo, &data, threadContextCount);
+			env->releaseExclusiveVMAccessForGC();
+		}
+	}
+#endif /* defined(OMR_GC_MODRON_STANDARD) */
+	return result;
+}
@@ -38,10 +38,14 @@ MM_CompactStats::clear()
 	
 	_movedObjects = 0;
 	_movedBytes = 0;
+	_pinnedObjects = 0;
+	_pinnedBytes = 0;
 	
 	_fixupObjects = 0;
 	_setupStartTime = 0;
 	_setupEndTime = 0;
+	_summaryStartTime = 0;
+	_summaryEndTime = 0;
 	_moveStartTime = 0;
 	_moveEndTime = 0;
 	_fixupStartTime = 0;
@@ -55,10 +59,14 @@ MM_CompactStats::merge(MM_CompactStats *statsToMerge)
 {
 	_movedObjects += statsToMerge->_movedObjects;
 	_movedBytes += statsToMerge->_movedBytes;
+	_pinnedObjects += statsToMerge->_pinnedObjects;
+	_pinnedBytes += statsToMerge->_pinnedBytes;
 	_fixupObjects += statsToMerge->_fixupObjects;
 	/* merging time intervals is a little different than just creating a total since the sum of two time intervals, for our uses, is their union (as opposed to the sum of two time spans, which is their sum) */
 	_setupStartTime = (0 == _setupStartTime) ? statsToMerge->_setupStartTime : OMR_MIN(_setupStartTime, statsToMerge->_setupStartTime);
 	_setupEndTime = OMR_MAX(_setupEndTime, statsToMerge->_setupEndTime);
+	_summaryStartTime = (0 == _summaryStartTime) ? statsToMerge->_summaryStartTime : OMR_MIN(_summaryStartTime, statsToMerge->_summaryStartTime);
+	_summaryEndTime = OMR_MAX(_summaryEndTime, statsToMerge->_summaryEndTime);
 	_moveStartTime = (0 == _moveStartTime) ? statsToMerge->_moveStartTime : OMR_MIN(_moveStartTime, statsToMerge->_moveStartTime);
 	_moveEndTime = OMR_MAX(_moveEndTime, statsToMerge->_moveEndTime);
 	_fixupStartTime = (0 == _fixupStartTime) ? statsToMerge->_fixupStartTime : OMR_MIN(_fixupStartTime, statsToMerge->_fixupStartTime);
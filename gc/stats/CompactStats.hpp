@@ -49,9 +49,13 @@ public:
 
 	uintptr_t _movedObjects;
 	uintptr_t _movedBytes;
+	uintptr_t _pinnedObjects; /**< large objects left in place (see largeObjectPinnedSize) */
+	uintptr_t _pinnedBytes;
 	uintptr_t _fixupObjects;
 	uint64_t _setupStartTime;
 	uint64_t _setupEndTime;
+	uint64_t _summaryStartTime; /**< start of the live data summary of planned moves (0 when moves are not planned) */
+	uint64_t _summaryEndTime;
 	uint64_t _moveStartTime;
 	uint64_t _moveEndTime;
 	uint64_t _fixupStartTime;
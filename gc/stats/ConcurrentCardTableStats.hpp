@@ -49,6 +49,8 @@ public:
 	volatile uintptr_t finalCleanedCardsPhase2;
 	
 	volatile uintptr_t concurrentCleanedCardsPhase3;
+
+	volatile uintptr_t cleanCardGroupsSkipped; /**< groups of cards skipped by card cleaning because the card summary showed them to be clean */
 	
 	MMINLINE void setCount(volatile uintptr_t &counter, uintptr_t count) 
 	{ 
@@ -75,6 +77,9 @@ public:
 		/* Final card cleaning counts */
 		setCount(finalCleanedCardsPhase1, 0);
 		setCount(finalCleanedCardsPhase2, 0);
+
+		/* Card summary counts */
+		setCount(cleanCardGroupsSkipped, 0);
 	}
 	
 	MMINLINE void setCardCleaningPhase1Kickoff(uintptr_t kickoff) { _cardCleaningPhase1Kickoff = kickoff; };
@@ -118,6 +123,12 @@ public:
 	{
 		incrementCount(finalCleanedCardsPhase2, numCards);	
 	};
+
+	MMINLINE uintptr_t getCleanCardGroupsSkipped() { return cleanCardGroupsSkipped; };
+	MMINLINE void incCleanCardGroupsSkipped(uintptr_t numGroups)
+	{
+		incrementCount(cleanCardGroupsSkipped, numGroups);
+	};
 	
 	/**
 	 * Create a CardTableStats object.
@@ -129,7 +140,8 @@ public:
 		finalCleanedCardsPhase1(0),
 		concurrentCleanedCardsPhase2(0),
 		finalCleanedCardsPhase2(0),
-		concurrentCleanedCardsPhase3(0)
+		concurrentCleanedCardsPhase3(0),
+		cleanCardGroupsSkipped(0)
 	{};
 };
 
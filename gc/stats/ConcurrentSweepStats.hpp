@@ -57,6 +57,8 @@ public:
 
 	uintptr_t _totalChunkCount;  /**< Total number of chunks included in the concurrent sweep calculation */
 	volatile uintptr_t _totalChunkSweptCount;  /**< Total number of chunks that have been swept through concurrent sweep */
+	volatile uintptr_t _allocationBytesSwept;  /**< Bytes swept by allocating threads (replenishing a pool or paying allocation tax) */
+	uintptr_t _backgroundBytesSwept;  /**< Bytes swept by background GC threads */
 	/**
 	 * @}
 	 */
@@ -143,6 +145,8 @@ public:
 	MMINLINE void clear() {
 		_totalChunkCount = 0;
 		_totalChunkSweptCount = 0;
+		_allocationBytesSwept = 0;
+		_backgroundBytesSwept = 0;
 		_minimumFreeEntryBytesSwept = 0;
 		_minimumFreeEntryBytesConnected = 0;
 		_concurrentCompleteSweepTimeStart = 0;
@@ -161,6 +165,8 @@ public:
 		_mode(concurrentsweep_mode_off),
 		_totalChunkCount(0),
 		_totalChunkSweptCount(0),
+		_allocationBytesSwept(0),
+		_backgroundBytesSwept(0),
 		_minimumFreeEntryBytesSwept(0),
 		_minimumFreeEntryBytesConnected(0),
 		_concurrentCompleteSweepTimeStart(0),
@@ -63,6 +63,8 @@ private:
 
 	MM_LightweightNonReentrantLock _lock;  /**< lock used during merge of thread local stats */
 	bool guarantyEnoughPoolSizeForVeryLargeEntry; /**< true for all memory pool, false for thread base */
+#define FREE_ENTRY_SEARCH_LENGTH_BUCKETS 8
+	uintptr_t _searchLengthCount[FREE_ENTRY_SEARCH_LENGTH_BUCKETS]; /**< allocate searches of the free list, by number of entries skipped: 0, 1, 2-3, 4-7, ... , 64 and more */
 private:
 	/**
 	 * Take a snapshot of this structure stats. 
@@ -120,6 +122,34 @@ public:
 		stats->resetCounts();
 	}
 
+	/**
+	 * Count an allocate search of the free list.  The search lengths are not part of the free entry counts
+	 * (they are neither reset with them nor merged), they are reset by the pool once they are reported.
+	 * @param searchLength number of free entries skipped before the one that satisfied (or failed) the allocate
+	 */
+	MMINLINE void
+	recordSearchLength(uintptr_t searchLength)
+	{
+		uintptr_t bucket = 0;
+		while ((searchLength > 0) && (bucket < (FREE_ENTRY_SEARCH_LENGTH_BUCKETS - 1))) {
+			bucket += 1;
+			searchLength >>= 1;
+		}
+		_searchLengthCount[bucket] += 1;
+	}
+
+	/* return count of allocate searches in the given search length bucket */
+	uintptr_t getSearchLengthCount(uintptr_t bucket) { return _searchLengthCount[bucket]; }
+
+	/**< Reset the counts of allocate searches */
+	void
+	resetSearchLengthCounts()
+	{
+		for (uintptr_t bucket = 0; bucket < FREE_ENTRY_SEARCH_LENGTH_BUCKETS; bucket++) {
+			_searchLengthCount[bucket] = 0;
+		}
+	}
+
 	/**< build the list of frequent allocation exact sizes for each size class */
 	void initializeFrequentAllocation(MM_LargeObjectAllocateStats *largeObjectAllocateStats);
 	/**< initialize veryLargeEntryPool -- link free veryLargeEntries in _freeHeadVeryLargeEntry list */
@@ -139,6 +169,7 @@ public:
 		_veryLargeEntrySizeClass(0),
 		_frequentAllocateSizeCounters(0)
 	{
+		resetSearchLengthCounts();
 	}
 };
 
@@ -47,6 +47,15 @@ public:
 	uint64_t nonDeterministicSweepDelay;
 
 	uint64_t _microsToStopMutators; /**< The number of microseconds the master thread had to wait for the mutator threads to stop, at the beginning of this increment */
+
+	/* Increments of the current cycle (not reset by clearStart, since a cycle spans many increments) */
+	uintptr_t _incrementCount; /**< count of increments (quanta) run in the current cycle */
+	uintptr_t _incrementsOverBudgetCount; /**< count of increments in the current cycle which ran longer than the quantum budget */
+	uint64_t _lastIncrementMicros; /**< duration of the last increment, in microseconds */
+	uint64_t _maxIncrementMicros; /**< duration of the longest increment of the current cycle, in microseconds */
+	uint64_t _totalIncrementMicros; /**< total duration of the increments of the current cycle, in microseconds */
+	uintptr_t _lastIncrementBytesScanned; /**< bytes scanned by the last increment */
+	uintptr_t _cycleBytesScanned; /**< bytes scanned by the increments of the current cycle */
 protected:
 private:
 public:
@@ -74,6 +83,41 @@ public:
 		_microsToStopMutators = 0;
 	}
 
+	/**
+	 * To be called at the beginning of a GC cycle which is run in increments (quanta).
+	 */
+	void clearCycle()
+	{
+		_incrementCount = 0;
+		_incrementsOverBudgetCount = 0;
+		_lastIncrementMicros = 0;
+		_maxIncrementMicros = 0;
+		_totalIncrementMicros = 0;
+		_lastIncrementBytesScanned = 0;
+		_cycleBytesScanned = 0;
+	}
+
+	/**
+	 * Record the end of an increment (quantum) of the current cycle.
+	 * @param incrementMicros duration of the increment, in microseconds
+	 * @param budgetMicros the quantum budget the increment was run with
+	 * @param bytesScanned bytes scanned by the increment
+	 */
+	void recordIncrement(uint64_t incrementMicros, uint64_t budgetMicros, uintptr_t bytesScanned)
+	{
+		_incrementCount += 1;
+		if (incrementMicros > budgetMicros) {
+			_incrementsOverBudgetCount += 1;
+		}
+		_lastIncrementMicros = incrementMicros;
+		if (incrementMicros > _maxIncrementMicros) {
+			_maxIncrementMicros = incrementMicros;
+		}
+		_totalIncrementMicros += incrementMicros;
+		_lastIncrementBytesScanned = bytesScanned;
+		_cycleBytesScanned += bytesScanned;
+	}
+
 	MMINLINE void incrementWorkPacketOverflowCount()
 	{
 		MM_AtomicOperations::add(&_workPacketOverflowCount, 1);
@@ -111,6 +155,13 @@ public:
 		, nonDeterministicSweepConsecutive(0)
 		, nonDeterministicSweepDelay(0)
 		, _microsToStopMutators(0)
+		, _incrementCount(0)
+		, _incrementsOverBudgetCount(0)
+		, _lastIncrementMicros(0)
+		, _maxIncrementMicros(0)
+		, _totalIncrementMicros(0)
+		, _lastIncrementBytesScanned(0)
+		, _cycleBytesScanned(0)
 	{
 	}
 
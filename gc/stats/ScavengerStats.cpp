@@ -53,6 +53,8 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_acquireScanListCount(0)
 	,_acquireListLockCount(0)
 	,_aliasToCopyCacheCount(0)
+	,_stealAttemptCount(0)
+	,_stealCount(0)
 	,_arraySplitCount(0)
 	,_arraySplitAmount(0)
 	,_workStallCount(0)
@@ -75,6 +77,7 @@ MM_ScavengerStats::MM_ScavengerStats()
 #endif /* OMR_GC_LARGE_OBJECT_AREA */
 	,_flipDiscardBytes(0)
 	,_tenureDiscardBytes(0)
+	,_tenureNonTemporalBytes(0)
 	,_survivorTLHRemainderCount(0)
 	,_tenureTLHRemainderCount(0)
 	,_semiSpaceAllocBytesAcumulation(0)
@@ -87,12 +90,38 @@ MM_ScavengerStats::MM_ScavengerStats()
 	,_tenureExpandedCount(0)
 	,_tenureExpandedTime(0)
 	,_leafObjectCount(0)
+	,_hotFieldSampleCount(0)
+	,_hotFieldSampleColocatedCount(0)
+	,_hotFieldCopyCount(0)
+	,_hotFieldCopyColocatedCount(0)
+	,_hotFieldTypeCount(0)
+	,_rememberedSetCardObjectCount(0)
+	,_numaLocalFlipBytes(0)
+	,_numaRemoteFlipBytes(0)
+	,_pauseTargetP99Time(0)
+	,_pauseTargetCopyRate(0)
+	,_pauseTargetSurvivorRate(0)
+	,_pauseTargetGCTimeRatio(0)
+	,_pauseTargetExpandSize(0)
+	,_pauseTargetContractSize(0)
+	,_pauseTargetSurvivorSize(0)
+	,_pauseTargetTenureAge(0)
+	,_gcThreadCount(0)
+	,_gcThreadSpinUpTime(0)
 	,_copy_cachesize_sum(0)
 	,_slotsCopied(0)
 	,_slotsScanned(0)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	,_readObjectBarrierCopy(0)
 	,_readObjectBarrierUpdate(0)
+	,_readObjectBarrierTime(0)
+	,_concurrentYieldCount(0)
+	,_concurrentYieldLatency(0)
+	,_concurrentPhaseTime(0)
+	,_concurrentPhaseBytesScanned(0)
+	,_stopTheWorldTime(0)
+	,_adaptivePredictedPauseTime(0)
+	,_adaptivePredictedConcurrentCost(0)
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 	,_flipHistoryNewIndex(0)
 {
@@ -160,6 +189,8 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	_acquireScanListCount = 0;
 	_acquireListLockCount = 0;
 	_aliasToCopyCacheCount = 0;
+	_stealAttemptCount = 0;
+	_stealCount = 0;
 	_workStallCount = 0;
 	_completeStallCount = 0;
 	_syncStallCount = 0;
@@ -175,6 +206,7 @@ MM_ScavengerStats::clear(bool firstIncrement)
 	 */
 	_flipDiscardBytes = 0;
 	_tenureDiscardBytes = 0;
+	_tenureNonTemporalBytes = 0;
 
 	_survivorTLHRemainderCount = 0;
 	_tenureTLHRemainderCount = 0;
@@ -194,9 +226,35 @@ MM_ScavengerStats::clear(bool firstIncrement)
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	_readObjectBarrierCopy = 0;
 	_readObjectBarrierUpdate = 0;
+	_readObjectBarrierTime = 0;
+	_concurrentYieldCount = 0;
+	_concurrentYieldLatency = 0;
+	_concurrentPhaseTime = 0;
+	_concurrentPhaseBytesScanned = 0;
+	_stopTheWorldTime = 0;
+	_adaptivePredictedPauseTime = 0;
+	_adaptivePredictedConcurrentCost = 0;
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	_leafObjectCount = 0;
+	_hotFieldSampleCount = 0;
+	_hotFieldSampleColocatedCount = 0;
+	_hotFieldCopyCount = 0;
+	_hotFieldCopyColocatedCount = 0;
+	_hotFieldTypeCount = 0;
+	_rememberedSetCardObjectCount = 0;
+	_numaLocalFlipBytes = 0;
+	_numaRemoteFlipBytes = 0;
+	_pauseTargetP99Time = 0;
+	_pauseTargetCopyRate = 0;
+	_pauseTargetSurvivorRate = 0;
+	_pauseTargetGCTimeRatio = 0;
+	_pauseTargetExpandSize = 0;
+	_pauseTargetContractSize = 0;
+	_pauseTargetSurvivorSize = 0;
+	_pauseTargetTenureAge = 0;
+	_gcThreadCount = 0;
+	_gcThreadSpinUpTime = 0;
 	_copy_cachesize_sum = 0;
 	memset(_copy_distance_counts, 0, sizeof(_copy_distance_counts));
 	memset(_copy_cachesize_counts, 0, sizeof(_copy_cachesize_counts));
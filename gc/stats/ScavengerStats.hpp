@@ -84,6 +84,8 @@ public:
 	uintptr_t _acquireScanListCount;
 	uintptr_t _acquireListLockCount;  /**< cumulative (for scan&free list) lock count. if this number is much larger than cumulative acquire list count, it indicates over-splitting */
 	uintptr_t _aliasToCopyCacheCount;
+	uintptr_t _stealAttemptCount; /**< The number of times the thread tried to steal a scan cache from another thread's deque (work stealing mode only) */
+	uintptr_t _stealCount; /**< The number of scan caches successfully stolen from other threads' deques (work stealing mode only) */
 	uintptr_t _arraySplitCount;
 	uintptr_t _arraySplitAmount;
 	uintptr_t _workStallCount; /**< The number of times the thread stalled, and subsequently received more work */
@@ -115,6 +117,7 @@ public:
 
 	uintptr_t _flipDiscardBytes;		/**< Bytes of survivor discarded by copy scan cache */
 	uintptr_t _tenureDiscardBytes;		/**< Bytes of tenure discarded by copy scan cache */
+	uintptr_t _tenureNonTemporalBytes;	/**< Bytes tenured with the non-temporal copy kernel (see scavengerNonTemporalCopyThreshold) */
 
 	uintptr_t _survivorTLHRemainderCount;
 	uintptr_t _tenureTLHRemainderCount;
@@ -132,6 +135,24 @@ public:
 	uint64_t _tenureExpandedTime; /**< Time taken expanding the heap in order to complete the collection, in hi-res ticks */
 
 	uint64_t _leafObjectCount;
+	uintptr_t _hotFieldSampleCount; /**< The number of parent to child references sampled by the hot field profiler */
+	uintptr_t _hotFieldSampleColocatedCount; /**< The number of sampled references whose child is less than a cache line away from the referring slot */
+	uintptr_t _hotFieldCopyCount; /**< The number of objects copied right behind their parent because they are referred to from a hot field */
+	uintptr_t _hotFieldCopyColocatedCount; /**< The number of hot field copies that landed less than a cache line away from the referring hot field */
+	uintptr_t _hotFieldTypeCount; /**< The number of types with hot fields after the scavenge */
+	uintptr_t _rememberedSetCardObjectCount; /**< The number of remembered objects collected from the cards they were recorded by on remembered set overflow (scavengerRememberedSetCardOverflow only) */
+	uintptr_t _numaLocalFlipBytes; /**< The number of bytes flipped into the survivor slice of the copying thread's NUMA node (numaAwareNursery only) */
+	uintptr_t _numaRemoteFlipBytes; /**< The number of bytes flipped into survivor memory outside the slice of the copying thread's NUMA node (numaAwareNursery only) */
+	uint64_t _pauseTargetP99Time; /**< The 99th percentile of the recent scavenge pauses in microseconds (scavengerPauseTarget only) */
+	uintptr_t _pauseTargetCopyRate; /**< The average number of bytes copied per millisecond of scavenge pause (scavengerPauseTarget only) */
+	uintptr_t _pauseTargetSurvivorRate; /**< The average percentage of the allocate space surviving a scavenge (scavengerPauseTarget only) */
+	uintptr_t _pauseTargetGCTimeRatio; /**< The average percentage of time spent scavenging (scavengerPauseTarget only) */
+	uintptr_t _pauseTargetExpandSize; /**< The number of bytes by which the pause target controller asks to expand the nursery */
+	uintptr_t _pauseTargetContractSize; /**< The number of bytes by which the pause target controller asks to contract the nursery */
+	uintptr_t _pauseTargetSurvivorSize; /**< The survivor space size asked for by the pause target controller, zero to leave the tilt unchanged */
+	uintptr_t _pauseTargetTenureAge; /**< The adaptive tenure age asked for by the pause target controller */
+	uintptr_t _gcThreadCount; /**< The number of GC threads the scavenge was dispatched to */
+	uint64_t _gcThreadSpinUpTime; /**< Time from dispatching the scavenge until the last GC thread started on it, in microseconds */
 	uint64_t _copy_distance_counts[OMR_SCAVENGER_DISTANCE_BINS];
 	uint64_t _copy_cachesize_counts[OMR_SCAVENGER_CACHESIZE_BINS];
 	uint64_t _copy_cachesize_sum;
@@ -142,6 +163,14 @@ public:
 #if defined(OMR_GC_CONCURRENT_SCAVENGER)
 	uint64_t _readObjectBarrierCopy; /**< Number of objects copied by read barrier */
 	uint64_t _readObjectBarrierUpdate; /**< Number of reference slots updates, which may be (often is) preceded by object copy */ 
+	uint64_t _readObjectBarrierTime; /**< Time mutator threads spent in the read barrier slow path, in hi-res ticks */
+	uintptr_t _concurrentYieldCount; /**< Number of times the concurrent phase yielded to an exclusive access request */
+	uint64_t _concurrentYieldLatency; /**< Longest time from a GC thread deciding to yield until all GC threads stopped, in hi-res ticks */
+	uint64_t _concurrentPhaseTime; /**< Time spent in the concurrent phase, in hi-res ticks */
+	uintptr_t _concurrentPhaseBytesScanned; /**< Number of bytes scanned by the GC threads during the concurrent phase */
+	uint64_t _stopTheWorldTime; /**< Total time of the stop-the-world increments of the cycle, in hi-res ticks */
+	uint64_t _adaptivePredictedPauseTime; /**< Predicted pause of a stop-the-world cycle in microseconds (concurrentScavengerAdaptive only) */
+	uint64_t _adaptivePredictedConcurrentCost; /**< Predicted pauses and read barrier time of a concurrent cycle in microseconds (concurrentScavengerAdaptive only) */
 #endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 protected:
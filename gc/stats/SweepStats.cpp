@@ -37,6 +37,8 @@ MM_SweepStats::clear()
 {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal = 0;
+	concurrentSweepBytes = 0;
+	allocationSweepBytes = 0;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -51,6 +53,8 @@ MM_SweepStats::merge(MM_SweepStats *statsToMerge)
 {
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	sweepHeapBytesTotal += statsToMerge->sweepHeapBytesTotal;
+	concurrentSweepBytes += statsToMerge->concurrentSweepBytes;
+	allocationSweepBytes += statsToMerge->allocationSweepBytes;
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
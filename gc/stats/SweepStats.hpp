@@ -42,6 +42,8 @@ public:
 	
 #if defined(OMR_GC_CONCURRENT_SWEEP)
 	uintptr_t sweepHeapBytesTotal;  /**< Number of heap bytes processed during the sweep phase */
+	uintptr_t concurrentSweepBytes;  /**< Number of heap bytes swept by background GC threads after the collection */
+	uintptr_t allocationSweepBytes;  /**< Number of heap bytes swept on demand by allocating threads after the collection */
 #endif /* OMR_GC_CONCURRENT_SWEEP */
 
 #if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
@@ -51,6 +51,11 @@ public:
 	uintptr_t _completeStallCount; /**< The number of times the thread stalled, and waited for all other threads to complete working */
 	uint64_t _workStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting to receive more work */
 	uint64_t _completeStallTime; /**< The time, in hi-res ticks, the thread spent stalled waiting for all other threads to complete working */
+	uintptr_t _packetAcquireCount; /**< The number of packets the thread took from the shared packet lists, without waiting for work */
+	uint64_t _packetAcquireTime; /**< The time, in hi-res ticks, the thread spent taking packets from the shared packet lists */
+	uint64_t _packetAcquireMaxTime; /**< The longest time, in hi-res ticks, the thread spent taking a single packet from the shared packet lists */
+	uintptr_t _packetMagazineHits; /**< The number of packets the thread took from its own packet magazines */
+	uintptr_t workPacketsSpilled; /**< The number of full packets the thread copied out to the spill rather than to overflow */
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 protected:
@@ -73,6 +78,11 @@ public:
 		workPacketsAcquired = 0;
 		workPacketsReleased = 0;
 		workPacketsExchanged = 0;
+		_packetAcquireCount = 0;
+		_packetAcquireTime = 0;
+		_packetAcquireMaxTime = 0;
+		_packetMagazineHits = 0;
+		workPacketsSpilled = 0;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -91,6 +101,11 @@ public:
 		workPacketsAcquired += statsToMerge->workPacketsAcquired;
 		workPacketsReleased += statsToMerge->workPacketsReleased;
 		workPacketsExchanged += statsToMerge->workPacketsExchanged;
+		_packetAcquireCount += statsToMerge->_packetAcquireCount;
+		_packetAcquireTime += statsToMerge->_packetAcquireTime;
+		_packetAcquireMaxTime = OMR_MAX(_packetAcquireMaxTime, statsToMerge->_packetAcquireMaxTime);
+		_packetMagazineHits += statsToMerge->_packetMagazineHits;
+		workPacketsSpilled += statsToMerge->workPacketsSpilled;
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 	}
 
@@ -130,6 +145,19 @@ public:
 	{
 		return _workStallTime + _completeStallTime;
 	}
+
+	/**
+	 * Add the time taken to get a packet from the shared packet lists.
+	 * Time is stored in raw format, converted to resolution at time of output
+	 */
+	MMINLINE void
+	addToPacketAcquireTime(uint64_t startTime, uint64_t endTime)
+	{
+		uint64_t time = endTime - startTime;
+		_packetAcquireCount += 1;
+		_packetAcquireTime += time;
+		_packetAcquireMaxTime = OMR_MAX(_packetAcquireMaxTime, time);
+	}
 #endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
 
 	MMINLINE bool getSTWWorkStackOverflowOccured()	{ return _stwWorkStackOverflowOccured; };
@@ -151,6 +179,11 @@ public:
 		,_completeStallCount(0)
 		,_workStallTime(0)
 		,_completeStallTime(0)
+		,_packetAcquireCount(0)
+		,_packetAcquireTime(0)
+		,_packetAcquireMaxTime(0)
+		,_packetMagazineHits(0)
+		,workPacketsSpilled(0)
 		,_stwWorkStackOverflowCount(0)
 		,_stwWorkStackOverflowOccured(false)
 		,_stwWorkpacketCountAtOverflow(0)
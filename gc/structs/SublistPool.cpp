@@ -452,3 +452,26 @@ MM_SublistPool::popPreviousPuddle(MM_SublistPuddle * returnedPuddle)
 	
 	return result;
 }
+
+void
+MM_SublistPool::returnPreviousPuddles()
+{
+	omrthread_monitor_enter(_mutex);
+
+	MM_SublistPuddle *puddle = _previousList;
+	while (NULL != puddle) {
+		MM_SublistPuddle *next = puddle->getNext();
+		puddle->setNext(_list);
+		_list = puddle;
+
+		/* It's illegal to have a non-empty list without an _allocPuddle (see #popPreviousPuddle()) */
+		if (NULL == _allocPuddle) {
+			_allocPuddle = puddle;
+			Assert_MM_true(NULL == _allocPuddle->getNext());
+		}
+		puddle = next;
+	}
+	_previousList = NULL;
+
+	omrthread_monitor_exit(_mutex);
+}
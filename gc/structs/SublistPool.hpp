@@ -125,6 +125,22 @@ public:
 	 * @return a puddle to process, or NULL if the list is empty
 	 */
 	MM_SublistPuddle *popPreviousPuddle(MM_SublistPuddle * returnedPuddle);
+
+	/**
+	 * Return the list of puddles which were active when #startProcessingSublist() was called.
+	 * The puddles remain on the previous list; they may be walked (but not modified structurally)
+	 * until #returnPreviousPuddles() is called.
+	 * @return the first previous puddle, or NULL
+	 */
+	MMINLINE MM_SublistPuddle *getPreviousList() { return _previousList; }
+
+	/**
+	 * Return all puddles which were active when #startProcessingSublist() was called to the list
+	 * of puddles in one step. Used when the previous puddles have been processed in place
+	 * rather than popped one by one with #popPreviousPuddle().
+	 * This is protected by a lock, so may safely be called while other threads allocate.
+	 */
+	void returnPreviousPuddles();
 	
 	MM_SublistPool() 
 		: _list(NULL)
@@ -86,6 +86,13 @@ public:
 	MMINLINE uintptr_t consumedSize() { return ((uintptr_t)_listCurrent) - ((uintptr_t)_listBase); }
 	MMINLINE uintptr_t freeSize() { return ((uintptr_t)_listTop) - ((uintptr_t)_listCurrent); }
 	MMINLINE uintptr_t totalSize() { return ((uintptr_t)_listTop) - ((uintptr_t)_listBase); }
+	MMINLINE uintptr_t consumedElementCount() { return (uintptr_t)(_listCurrent - _listBase); }
+
+	/**
+	 * Return the first element of the puddle. Elements [base, base + consumedElementCount()) are in use.
+	 * Used to partition a puddle which is not being allocated from into fixed-size batches.
+	 */
+	MMINLINE uintptr_t *getListBase() { return _listBase; }
 
 	MMINLINE MM_SublistPool *getParent() {return _parent; }
 
@@ -26,6 +26,7 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "MemoryManager.hpp"
 #include "CollectionStatistics.hpp"
 #include "ConcurrentPhaseStatsBase.hpp"
 #include "ObjectAllocationInterface.hpp"
@@ -300,6 +301,12 @@ MM_VerboseHandlerOutput::handleInitialized(J9HookInterface** hook, uintptr_t eve
 	writer->formatAndOutput(env, 1, "<attribute name=\"cacheListSplit\" value=\"%zu\" />", _extensions->cacheListSplit);
 	writer->formatAndOutput(env, 1, "<attribute name=\"splitFreeListSplitAmount\" value=\"%zu\" />", _extensions->splitFreeListSplitAmount);
 	writer->formatAndOutput(env, 1, "<attribute name=\"numaNodes\" value=\"%zu\" />", event->numaNodes);
+	if (_extensions->transparentHugePageLayout) {
+		MM_MemoryManager *memoryManager = _extensions->memoryManager;
+		writer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePageSize\" value=\"0x%zx\" />", _extensions->transparentHugePageSize);
+		writer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePageAlignedBytes\" value=\"0x%zx\" />", memoryManager->getTransparentHugePageAlignedBytes());
+		writer->formatAndOutput(env, 1, "<attribute name=\"transparentHugePageAlignedPercent\" value=\"%zu\" />", memoryManager->getTransparentHugePageAlignedPercent());
+	}
 
 	handleInitializedInnerStanzas(hook, eventNum, eventData);
 
@@ -763,7 +770,9 @@ MM_VerboseHandlerOutput::printAllocationStats(MM_EnvironmentBase* env)
 #endif /* OMR_GC_VLHGC */
 	} else if (_extensions->isStandardGC()) {
 #if defined(OMR_GC_MODRON_STANDARD)
-		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" />", systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated());
+		writer->formatAndOutput(env, 1, "<allocated-bytes non-tlh=\"%zu\" tlh=\"%zu\" tlh-abandoned=\"%zu\" tlh-refreshes=\"%zu\" tlh-requested=\"%zu\" />",
+				systemStats->nontlhBytesAllocated(), systemStats->tlhBytesAllocated(), systemStats->_tlhAbandonedBytes,
+				systemStats->_tlhRefreshCountFresh, systemStats->_tlhRequestedBytes);
 #endif /* OMR_GC_MODRON_STANDARD */
 	} else {
 		/* for now, not covered the case of specs that do not have TLHs, but have arraylets */
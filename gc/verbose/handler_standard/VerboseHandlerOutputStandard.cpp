@@ -29,6 +29,7 @@
 #include "CycleState.hpp"
 #include "EnvironmentBase.hpp"
 #include "GCExtensionsBase.hpp"
+#include "ObjectCopy.hpp"
 #include "VerboseHandlerOutputStandard.hpp"
 #include "VerboseManager.hpp"
 #include "VerboseWriterChain.hpp"
@@ -50,6 +51,10 @@ static void verboseHandlerMarkEnd(J9HookInterface** hook, uintptr_t eventNum, vo
 static void verboseHandlerSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerExcessiveGCRaised(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+static void verboseHandlerConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 #if defined(OMR_GC_MODRON_COMPACTION)
 static void verboseHandlerCompactStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
 static void verboseHandlerCompactEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData);
@@ -131,6 +136,9 @@ MM_VerboseHandlerOutputStandard::enableVerbose()
 	/* GCOps */
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseHandlerMarkEnd, OMR_GET_CALLSITE(), (void *)this);
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseHandlerSweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerConcurrentSweepEnd, OMR_GET_CALLSITE(), (void *)this);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 	(*_mmPrivateHooks)->J9HookRegisterWithCallSite(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPACT_START, verboseHandlerCompactStart, OMR_GET_CALLSITE(), (void *)this);
@@ -189,6 +197,9 @@ MM_VerboseHandlerOutputStandard::disableVerbose()
 	/* GCOps */
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_MARK_END, verboseHandlerMarkEnd, NULL);
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_SWEEP_END, verboseHandlerSweepEnd, NULL);
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPLETED_CONCURRENT_SWEEP, verboseHandlerConcurrentSweepEnd, NULL);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 	(*_mmPrivateHooks)->J9HookUnregister(_mmPrivateHooks, J9HOOK_MM_PRIVATE_COMPACT_START, verboseHandlerCompactStart, NULL);
@@ -304,6 +315,17 @@ MM_VerboseHandlerOutputStandard::handleMarkEnd(J9HookInterface** hook, uintptr_t
 
 	writer->formatAndOutput(env, 1, "<trace-info objectcount=\"%zu\" scancount=\"%zu\" scanbytes=\"%zu\" />",
 			markStats->_objectsMarked, markStats->_objectsScanned, markStats->_bytesScanned);
+#if defined(J9MODRON_TGC_PARALLEL_STATISTICS)
+	if ((0 != extensions->workPacketMagazineSize) || (0 != extensions->workPacketSpillMaximum)) {
+		MM_WorkPacketStats *workPacketStats = &extensions->globalGCStats.workPacketStats;
+		writer->formatAndOutput(env, 1, "<work-packets acquired=\"%zu\" magazinehits=\"%zu\" spilled=\"%zu\" />",
+				workPacketStats->workPacketsAcquired, workPacketStats->_packetMagazineHits, workPacketStats->workPacketsSpilled);
+	}
+#endif /* J9MODRON_TGC_PARALLEL_STATISTICS */
+	if (0 != extensions->markingPrefetchDepth) {
+		writer->formatAndOutput(env, 1, "<mark-prefetch depth=\"%zu\" queuescans=\"%zu\" />",
+				extensions->markingPrefetchDepth, markStats->_prefetchQueueScans);
+	}
 
 	handleMarkEndInternal(env, eventData);
 
@@ -341,6 +363,27 @@ MM_VerboseHandlerOutputStandard::handleSweepEndInternal(MM_EnvironmentBase* env,
 	/* Empty stub */
 }
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+MM_VerboseHandlerOutputStandard::handleConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData)
+{
+	MM_CompletedConcurrentSweep* event = (MM_CompletedConcurrentSweep*)eventData;
+	MM_VerboseManager* manager = getManager();
+	MM_VerboseWriterChain* writer = manager->getWriterChain();
+	MM_EnvironmentBase* env = MM_EnvironmentBase::getEnvironment(event->currentThread);
+	OMRPORT_ACCESS_FROM_ENVIRONMENT(env);
+	char tagTemplate[200];
+	enterAtomicReportingBlock();
+	getTagTemplate(tagTemplate, sizeof(tagTemplate), manager->getIdAndIncrement(), omrtime_current_time_millis());
+	/* background and allocation bytes were swept after the previous collection, complete bytes were left for this point */
+	writer->formatAndOutput(env, 0, "<concurrent-sweep-end %s backgroundbytes=\"%zu\" allocationbytes=\"%zu\" completebytes=\"%zu\" connectbytes=\"%zu\" completeus=\"%llu\" connectus=\"%llu\" />",
+			tagTemplate, event->backgroundBytesSwept, event->allocationBytesSwept, event->bytesSwept, event->bytesConnected,
+			event->timeElapsedSweep, event->timeElapsedConnect);
+	writer->flush(env);
+	exitAtomicReportingBlock();
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 void
@@ -379,6 +422,24 @@ MM_VerboseHandlerOutputStandard::handleCompactEnd(J9HookInterface** hook, uintpt
 	if(COMPACT_PREVENTED_NONE == compactStats->_compactPreventedReason) {
 		writer->formatAndOutput(env, 1, "<compact-info movecount=\"%zu\" movebytes=\"%zu\" reason=\"%s\" />",
 				compactStats->_movedObjects, compactStats->_movedBytes, getCompactionReasonAsString(compactStats->_compactReason));
+		if (0 != compactStats->_pinnedObjects) {
+			writer->formatAndOutput(env, 1, "<compact-pinned count=\"%zu\" bytes=\"%zu\" />", compactStats->_pinnedObjects, compactStats->_pinnedBytes);
+		}
+
+		uint64_t setupTime = 0;
+		uint64_t summaryTime = 0;
+		uint64_t moveTime = 0;
+		uint64_t fixupTime = 0;
+		uint64_t rootFixupTime = 0;
+		getTimeDeltaInMicroSeconds(&setupTime, compactStats->_setupStartTime, compactStats->_setupEndTime);
+		getTimeDeltaInMicroSeconds(&summaryTime, compactStats->_summaryStartTime, compactStats->_summaryEndTime);
+		getTimeDeltaInMicroSeconds(&moveTime, compactStats->_moveStartTime, compactStats->_moveEndTime);
+		getTimeDeltaInMicroSeconds(&fixupTime, compactStats->_fixupStartTime, compactStats->_fixupEndTime);
+		getTimeDeltaInMicroSeconds(&rootFixupTime, compactStats->_rootFixupStartTime, compactStats->_rootFixupEndTime);
+		writer->formatAndOutput(env, 1, "<compact-phases planned=\"%s\" setupms=\"%llu.%03.3llu\" summaryms=\"%llu.%03.3llu\" movems=\"%llu.%03.3llu\" fixupms=\"%llu.%03.3llu\" rootfixupms=\"%llu.%03.3llu\" />",
+				(0 != compactStats->_summaryStartTime) ? "true" : "false",
+				setupTime / 1000, setupTime % 1000, summaryTime / 1000, summaryTime % 1000, moveTime / 1000, moveTime % 1000,
+				fixupTime / 1000, fixupTime % 1000, rootFixupTime / 1000, rootFixupTime % 1000);
 	} else {
 		writer->formatAndOutput(env, 1, "<compact-info reason=\"%s\" />", getCompactionReasonAsString(compactStats->_compactReason));
 		writer->formatAndOutput(env, 1, "<warning details=\"compaction prevented due to %s\" />", getCompactionPreventedReasonAsString(compactStats->_compactPreventedReason));
@@ -426,8 +487,15 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 				scavengerStats->_flipCount, scavengerStats->_flipBytes, scavengerStats->_flipDiscardBytes);
 	}
 	if (0 != scavengerStats->_tenureAggregateCount) {
-		writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
-				scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
+		if ((0 != _extensions->scavengerNonTemporalCopyThreshold) && (MM_ObjectCopy::kernel_memcpy != MM_ObjectCopy::getNonTemporalKernel())) {
+			/* the scavenger copies large tenured objects with the non-temporal kernel of the processor */
+			writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" nontemporalbytes=\"%zu\" />",
+					scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes,
+					scavengerStats->_tenureNonTemporalBytes);
+		} else {
+			writer->formatAndOutput(env, 1, "<memory-copied type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" bytesdiscarded=\"%zu\" />",
+					scavengerStats->_tenureAggregateCount, scavengerStats->_tenureAggregateBytes, scavengerStats->_tenureDiscardBytes);
+		}
 	}
 	if (0 != scavengerStats->_failedFlipCount) {
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"nursery\" objects=\"%zu\" bytes=\"%zu\" />",
@@ -437,6 +505,48 @@ MM_VerboseHandlerOutputStandard::handleScavengeEndNoLock(J9HookInterface** hook,
 		writer->formatAndOutput(env, 1, "<copy-failed type=\"tenure\" objects=\"%zu\" bytes=\"%zu\" />",
 				scavengerStats->_failedTenureCount, scavengerStats->_failedTenureBytes);
 	}
+	if (0 != scavengerStats->_stealAttemptCount) {
+		writer->formatAndOutput(env, 1, "<work-stealing attempts=\"%zu\" steals=\"%zu\" />",
+				scavengerStats->_stealAttemptCount, scavengerStats->_stealCount);
+	}
+	if (0 != scavengerStats->_hotFieldSampleCount) {
+		writer->formatAndOutput(env, 1, "<hot-field-info sampledpairs=\"%zu\" colocatedpairs=\"%zu\" hotcopies=\"%zu\" hotcopiescolocated=\"%zu\" hottypes=\"%zu\" />",
+				scavengerStats->_hotFieldSampleCount, scavengerStats->_hotFieldSampleColocatedCount,
+				scavengerStats->_hotFieldCopyCount, scavengerStats->_hotFieldCopyColocatedCount, scavengerStats->_hotFieldTypeCount);
+	}
+	if (0 != scavengerStats->_rememberedSetCardObjectCount) {
+		writer->formatAndOutput(env, 1, "<remembered-set-card-overflow objects=\"%zu\" />", scavengerStats->_rememberedSetCardObjectCount);
+	}
+	if (0 != scavengerStats->_gcThreadCount) {
+		writer->formatAndOutput(env, 1, "<gc-threads count=\"%zu\" spinupus=\"%llu\" />",
+				scavengerStats->_gcThreadCount, scavengerStats->_gcThreadSpinUpTime);
+	}
+	if (0 != (scavengerStats->_numaLocalFlipBytes + scavengerStats->_numaRemoteFlipBytes)) {
+		writer->formatAndOutput(env, 1, "<numa-copy type=\"nursery\" localbytes=\"%zu\" remotebytes=\"%zu\" />",
+				scavengerStats->_numaLocalFlipBytes, scavengerStats->_numaRemoteFlipBytes);
+	}
+	if (event->cycleEnd && (0 != extensions->scavengerPauseTarget) && (0 != cycleScavengerStats->_pauseTargetP99Time)) {
+		writer->formatAndOutput(env, 1, "<pause-target targetms=\"%zu\" p99us=\"%llu\" copyrate=\"%zu\" survivorrate=\"%zu\" gctimeratio=\"%zu\" expandbytes=\"%zu\" contractbytes=\"%zu\" survivorbytes=\"%zu\" tenureage=\"%zu\" />",
+				extensions->scavengerPauseTarget, cycleScavengerStats->_pauseTargetP99Time, cycleScavengerStats->_pauseTargetCopyRate,
+				cycleScavengerStats->_pauseTargetSurvivorRate, cycleScavengerStats->_pauseTargetGCTimeRatio,
+				cycleScavengerStats->_pauseTargetExpandSize, cycleScavengerStats->_pauseTargetContractSize,
+				cycleScavengerStats->_pauseTargetSurvivorSize, cycleScavengerStats->_pauseTargetTenureAge);
+	}
+#if defined(OMR_GC_CONCURRENT_SCAVENGER)
+	if (event->cycleEnd && extensions->concurrentScavenger) {
+		uint64_t readBarrierMicros = omrtime_hires_delta(0, cycleScavengerStats->_readObjectBarrierTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t yieldLatencyMicros = omrtime_hires_delta(0, cycleScavengerStats->_concurrentYieldLatency, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t concurrentMicros = omrtime_hires_delta(0, cycleScavengerStats->_concurrentPhaseTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t pauseMicros = omrtime_hires_delta(0, cycleScavengerStats->_stopTheWorldTime, OMRPORT_TIME_DELTA_IN_MICROSECONDS);
+		uint64_t concurrentThroughput = (0 == concurrentMicros) ? 0 : ((uint64_t)cycleScavengerStats->_concurrentPhaseBytesScanned / concurrentMicros);
+		writer->formatAndOutput(env, 1, "<concurrent-scavenger mode=\"%s\" barrierhits=\"%llu\" barriercopies=\"%llu\" barrierus=\"%llu\" yields=\"%zu\" maxyieldus=\"%llu\" concurrentus=\"%llu\" concurrentbytes=\"%zu\" bytesperus=\"%llu\" pauseus=\"%llu\" predictedpauseus=\"%llu\" predictedcostus=\"%llu\" />",
+				extensions->concurrentScavengerStopTheWorldCycle ? "stw" : "concurrent",
+				cycleScavengerStats->_readObjectBarrierUpdate, cycleScavengerStats->_readObjectBarrierCopy, readBarrierMicros,
+				cycleScavengerStats->_concurrentYieldCount, yieldLatencyMicros,
+				concurrentMicros, cycleScavengerStats->_concurrentPhaseBytesScanned, concurrentThroughput, pauseMicros,
+				cycleScavengerStats->_adaptivePredictedPauseTime, cycleScavengerStats->_adaptivePredictedConcurrentCost);
+	}
+#endif /* OMR_GC_CONCURRENT_SCAVENGER */
 
 	handleScavengeEndInternal(env, eventData);
 	
@@ -567,6 +677,9 @@ MM_VerboseHandlerOutputStandard::handleConcurrentCardCleaningEnd(J9HookInterface
 	writer->formatAndOutput(
 			env, 1, "<card-cleaning cardsCleaned=\"%zu\" bytesTraced=\"%zu\" workStackOverflowCount=\"%zu\" />",
 			event->finalcleanedCards, event->bytesTraced, event->workStackOverflowCount);
+	if (env->getExtensions()->concurrentCardSummary) {
+		writer->formatAndOutput(env, 1, "<card-summary cleanGroupsSkipped=\"%zu\" />", event->cleanCardGroupsSkipped);
+	}
 
 	handleConcurrentCardCleaningEndInternal(env, eventData);
 
@@ -1029,6 +1142,14 @@ verboseHandlerSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventDa
 	((MM_VerboseHandlerOutputStandard *)userData)->handleSweepEnd(hook, eventNum, eventData);
 }
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+void
+verboseHandlerConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
+{
+	((MM_VerboseHandlerOutputStandard *)userData)->handleConcurrentSweepEnd(hook, eventNum, eventData);
+}
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 #if defined(OMR_GC_MODRON_COMPACTION)
 void
 verboseHandlerCompactStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData, void* userData)
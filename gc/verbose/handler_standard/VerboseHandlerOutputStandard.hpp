@@ -109,6 +109,17 @@ public:
 	 */
 	void handleSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
 
+#if defined(OMR_GC_CONCURRENT_SWEEP)
+	/**
+	 * Write verbose stanza for the completion of a concurrent sweep, including the
+	 * heap bytes swept by background GC threads and by allocating threads.
+	 * @param hook Hook interface used by the JVM.
+	 * @param eventNum The hook event number.
+	 * @param eventData hook specific event data.
+	 */
+	void handleConcurrentSweepEnd(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
+#endif /* defined(OMR_GC_CONCURRENT_SWEEP) */
+
 #if defined(OMR_GC_MODRON_COMPACTION)
 
 	void handleCompactStart(J9HookInterface** hook, uintptr_t eventNum, void* eventData);
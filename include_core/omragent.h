@@ -43,6 +43,11 @@ extern "C" {
 
 typedef struct OMR_TI_MemoryCategory OMR_TI_MemoryCategory;
 typedef struct OMR_SampledMethodDescription OMR_SampledMethodDescription;
+typedef struct OMR_TI_AllocationSite OMR_TI_AllocationSite;
+
+/* Orders for the GetAllocationSites API */
+#define OMR_TI_ALLOCATION_SITES_BY_BYTES 0
+#define OMR_TI_ALLOCATION_SITES_BY_SURVIVAL 1
 
 typedef struct OMR_TI {
 	int32_t version;
@@ -302,6 +307,29 @@ typedef struct OMR_TI {
 	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT A NULL pointer was passed in for an output parameter.
 	 */
 	omr_error_t (*GetMethodProperties)(OMR_VMThread *vmThread, size_t *numProperties, const char *const **propertyNames, size_t *sizeofSampledMethodDesc);
+
+	/**
+	 * Retrieve the top allocation sites profiled by the GC allocation site sampler.
+	 *
+	 * Allocations are sampled once every -Xgc:allocationSiteSampleInterval bytes on average, and the
+	 * site of each sampled allocation is identified by the language. The number of samples taken at a
+	 * site is proportional to the bytes allocated there. Depending on the collector, sampled objects are
+	 * also checked at the first collection that follows their allocation, to rank sites by survival.
+	 *
+	 * @param[in] vmThread The current OMR VM thread.
+	 * @param[in] order OMR_TI_ALLOCATION_SITES_BY_BYTES or OMR_TI_ALLOCATION_SITES_BY_SURVIVAL.
+	 * @param[out] sites A buffer where the top sites are written, highest first. Must not be NULL if count is non-zero.
+	 * @param[in] count The number of entries in sites.
+	 * @param[out] written The number of sites written. Must be non-NULL.
+	 *
+	 * @return An OMR error code.
+	 * @retval OMR_ERROR_NONE Success.
+	 * @retval OMR_THREAD_NOT_ATTACHED vmThread is NULL.
+	 * @retval OMR_ERROR_NOT_AVAILABLE Allocation site sampling is not enabled.
+	 * @retval OMR_ERROR_ILLEGAL_ARGUMENT An unknown order, or a NULL pointer was passed in for an output parameter.
+	 * @retval OMR_ERROR_OUT_OF_NATIVE_MEMORY Memory could not be allocated for the sites.
+	 */
+	omr_error_t (*GetAllocationSites)(OMR_VMThread *vmThread, uint32_t order, OMR_TI_AllocationSite *sites, size_t count, size_t *written);
 } OMR_TI;
 
 /*
@@ -353,6 +381,32 @@ struct OMR_SampledMethodDescription {
 	const char *propertyValues[];
 };
 
+/*
+ * Return data for the GetAllocationSites API
+ */
+struct OMR_TI_AllocationSite {
+	/* Identifier of the site, provided by the language */
+	uintptr_t site;
+
+	/* Number of allocations sampled at the site */
+	uint64_t sampleCount;
+
+	/* Total size of the allocations sampled at the site */
+	uint64_t sampledBytes;
+
+	/* Number of sampled allocations which survived the first collection after they were allocated */
+	uint64_t survivorCount;
+
+	/* Total size of the sampled allocations which survived the first collection after they were allocated */
+	uint64_t survivorBytes;
+
+	/* Estimated bytes allocated at the site */
+	uint64_t estimatedBytes;
+
+	/* Estimated bytes allocated at the site which survived the first collection after they were allocated */
+	uint64_t estimatedSurvivorBytes;
+};
+
 typedef struct OMR_AgentCallbacks {
 	uint32_t version; /* version counter, initially 0 */
 	omr_error_t (*onPreFork)(void);
@@ -570,6 +570,15 @@ typedef struct U_128 {
 #define J9_UNEXPECTED(e) (e)
 #endif
 
+/* Software prefetch hints; the address is never dereferenced, so any value may be passed */
+#if defined(__GNUC__) && !defined(TYPESTUBS_H)
+#define OMR_PREFETCH_READ(address) __builtin_prefetch((const void *)(address), 0, 3)
+#define OMR_PREFETCH_WRITE(address) __builtin_prefetch((const void *)(address), 1, 3)
+#else /* defined(__GNUC__) && !defined(TYPESTUBS_H) */
+#define OMR_PREFETCH_READ(address)
+#define OMR_PREFETCH_WRITE(address)
+#endif /* defined(__GNUC__) && !defined(TYPESTUBS_H) */
+
 #define OMR_MAX(a,b) (((a) > (b)) ? (a) : (b))
 #define OMR_MIN(a,b) (((a) < (b)) ? (a) : (b))
 
@@ -400,7 +400,8 @@ typedef enum {
 	SCAV_RATIO_TOO_LOW,
 	HEAP_RESIZE,
 	SATISFY_EXPAND,
-	FORCED_NURSERY_CONTRACT
+	FORCED_NURSERY_CONTRACT,
+	SCAV_PAUSE_TARGET_EXCEEDED
 } ContractReason;
 
 typedef enum {
@@ -411,7 +412,8 @@ typedef enum {
 	SATISFY_COLLECTOR,
 	EXPAND_DESPERATE,
 	FORCED_NURSERY_EXPAND,
-	HINT_PREVIOUS_RUNS
+	HINT_PREVIOUS_RUNS,
+	SCAV_THROUGHPUT_GOAL_MISSED
 } ExpandReason;
 
 typedef enum {
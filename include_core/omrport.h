@@ -382,6 +382,10 @@ typedef struct J9PortVmemParams {
 	 *		- If set, return whatever mmap gives us (only one allocation attempt)
 	 *		- this option is based on the observation that mmap would take the given address as a hint about where to place the mapping
 	 *		- this option does not apply to large page allocations as the allocation is done with shmat instead of mmap
+	 * \arg OMRPORT_VMEM_NO_HUGEPAGE
+	 *		- enabled for Linux and default page allocations only
+	 *		- If set, the memory is advised with MADV_NOHUGEPAGE rather than MADV_HUGEPAGE, so that sparsely
+	 *		  touched memory is not backed by Transparent HugePages
 	 */
 	uintptr_t options;
 
@@ -440,6 +444,7 @@ typedef struct OMRCgroupMetricIteratorState {
 #define OMRPORT_VMEM_ALLOC_QUICK 		32
 #define OMRPORT_VMEM_ZTPF_USE_31BIT_MALLOC 64
 #define OMRPORT_VMEM_ADDRESS_HINT 128
+#define OMRPORT_VMEM_NO_HUGEPAGE 256
 
 /**
  * @name Virtual Memory Address
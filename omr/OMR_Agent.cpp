@@ -61,7 +61,8 @@ OMR_TI const OMR_Agent::theOmrTI = {
 	omrtiGetProcessPrivateMemorySize,
 	omrtiGetProcessPhysicalMemorySize,
 	omrtiGetMethodDescriptions,
-	omrtiGetMethodProperties
+	omrtiGetMethodProperties,
+	omrtiGetAllocationSites
 };
 
 extern "C" OMR_Agent *
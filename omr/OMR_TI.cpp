@@ -30,6 +30,9 @@
 
 #include "OMR_MethodDictionary.hpp"
 #include "OMR_VM.hpp"
+#if defined(OMR_GC)
+#include "omrgc.h"
+#endif /* OMR_GC */
 
 #define MINIMUM_CPU_LOAD_INTERVAL J9CONST_I64(1000000)
 #define MAXIMUM_NEGATIVE_ELAPSED_TIME_COUNT 3
@@ -871,3 +874,52 @@ omrtiGetMethodProperties(OMR_VMThread *vmThread, size_t *numProperties, const ch
 	}
 	return rc;
 }
+
+omr_error_t
+omrtiGetAllocationSites(OMR_VMThread *vmThread, uint32_t order, OMR_TI_AllocationSite *sites, size_t count, size_t *written)
+{
+	omr_error_t rc = OMR_ERROR_NONE;
+
+	OMR_TI_ENTER_FROM_VM_THREAD(vmThread);
+
+	if (NULL == vmThread) {
+		rc = OMR_THREAD_NOT_ATTACHED;
+	} else if ((NULL == written) || ((0 != count) && (NULL == sites))) {
+		rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+	} else {
+#if defined(OMR_GC)
+		OMRPORT_ACCESS_FROM_OMRVMTHREAD(vmThread);
+		uint32_t gcOrder = (OMR_TI_ALLOCATION_SITES_BY_SURVIVAL == order) ? OMR_GC_ALLOCATION_SITES_BY_SURVIVAL : OMR_GC_ALLOCATION_SITES_BY_BYTES;
+		OMR_GC_AllocationSite *gcSites = NULL;
+		uintptr_t gcWritten = 0;
+
+		if ((OMR_TI_ALLOCATION_SITES_BY_BYTES != order) && (OMR_TI_ALLOCATION_SITES_BY_SURVIVAL != order)) {
+			rc = OMR_ERROR_ILLEGAL_ARGUMENT;
+		} else if (0 != count) {
+			gcSites = (OMR_GC_AllocationSite *)omrmem_allocate_memory(count * sizeof(OMR_GC_AllocationSite), OMRMEM_CATEGORY_OMRTI);
+			if (NULL == gcSites) {
+				rc = OMR_ERROR_OUT_OF_NATIVE_MEMORY;
+			}
+		}
+		if (OMR_ERROR_NONE == rc) {
+			rc = OMR_GC_GetAllocationSites(vmThread, gcOrder, gcSites, count, &gcWritten);
+		}
+		if (OMR_ERROR_NONE == rc) {
+			for (uintptr_t i = 0; i < gcWritten; i++) {
+				sites[i].site = gcSites[i].site;
+				sites[i].sampleCount = gcSites[i].sampleCount;
+				sites[i].sampledBytes = gcSites[i].sampledBytes;
+				sites[i].survivorCount = gcSites[i].survivorCount;
+				sites[i].survivorBytes = gcSites[i].survivorBytes;
+				sites[i].estimatedBytes = gcSites[i].estimatedBytes;
+				sites[i].estimatedSurvivorBytes = gcSites[i].estimatedSurvivorBytes;
+			}
+			*written = gcWritten;
+		}
+		omrmem_free_memory(gcSites);
+#else /* OMR_GC */
+		rc = OMR_ERROR_NOT_AVAILABLE;
+#endif /* OMR_GC */
+	}
+	OMR_TI_RETURN(vmThread, rc);
+}
@@ -118,6 +118,8 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	double maxMark = 0;
 	double minMark = 0;
 	double avgMark = 0;
+	double markBytes = 0;
+	double markRate = 0;
 
 	double maxSweep = 0;
 	double minSweep = 0;
@@ -147,6 +149,7 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	    pugi::xpath_node node = *it;
 	    double value = node.node().attribute("timems").as_double();
 	    mark_values.push_back(value);
+	    markBytes += node.node().child("trace-info").attribute("scanbytes").as_double();
 	}
 
 	sweepTimes = doc.select_nodes(XPATH_GET_ALL_SWEEP_TIME);
@@ -174,6 +177,11 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 		maxMark = *std::max_element(mark_values.begin(), mark_values.end());
 		minMark = *std::min_element(mark_values.begin(), mark_values.end());
 		avgMark = getAvg(mark_values);
+		double totalMark = std::accumulate(mark_values.begin(), mark_values.end(), 0.0);
+		if (0 < totalMark) {
+			/* bytes scanned per millisecond of mark time, reported in MB/s */
+			markRate = (markBytes / totalMark) * 1000 / (1024 * 1024);
+		}
 	}
 
 	if (!sweep_values.empty()) {
@@ -202,6 +210,8 @@ analyze(char* fileName, OMRPortLibrary portLibrary)
 	omrtty_printf("Min     : %f        %f        %f        %f\n",
 								minMark, minSweep, minExpand, minGCDuration);
 
-	omrtty_printf("Average : %f        %f        %f        %f\n\n",
+	omrtty_printf("Average : %f        %f        %f        %f\n",
 								avgMark, avgSweep, avgExpand, avgGCDuration);
+
+	omrtty_printf("Mark rate : %f MB/s\n\n", markRate);
 }
@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Microbenchmark for the heap map scan kernels (see gc/base/HeapMapScan.hpp).
+ * A synthetic heap map is populated for a range of heap occupancies and every kernel supported by
+ * the processor is timed skipping empty map slots (as sweep does) and extracting the marked objects
+ * (as object iteration does).  Results are reported as heap map bits scanned per second.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "HeapMapScan.hpp"
+
+#define HEAP_MAP_SLOTS ((uintptr_t)1 << 20)
+#define ITERATIONS 20
+#define EXTRACT_BUFFER_COUNT 256
+
+static const double OCCUPANCIES[] = { 0.0, 0.001, 0.01, 0.05, 0.25, 0.5, 1.0 };
+
+static const MM_HeapMapScan::Kernel KERNELS[] = {
+	MM_HeapMapScan::kernel_scalar,
+	MM_HeapMapScan::kernel_avx2,
+	MM_HeapMapScan::kernel_avx512,
+	MM_HeapMapScan::kernel_neon
+};
+
+/**
+ * Populate the heap map for the given occupancy.  Live objects are clustered, as they are in a
+ * heap with survivors from the same allocation phase: a slot is either empty or has a few bits set.
+ */
+static void
+populateHeapMap(uintptr_t *heapMap, uintptr_t slotCount, double occupancy)
+{
+	srand(1);
+	for (uintptr_t i = 0; i < slotCount; i++) {
+		uintptr_t value = 0;
+		if (((double)rand() / RAND_MAX) < occupancy) {
+			/* one to eight objects in a slot, at least one of them near the start */
+			uintptr_t objects = 1 + (rand() % 8);
+			value = 1;
+			for (uintptr_t object = 1; object < objects; object++) {
+				value |= (uintptr_t)1 << (rand() % (sizeof(uintptr_t) * 8));
+			}
+		}
+		heapMap[i] = value;
+	}
+}
+
+static uintptr_t
+skipAll(MM_HeapMapScan *scan, uintptr_t *heapMap, uintptr_t slotCount)
+{
+	uintptr_t nonEmptySlots = 0;
+	uintptr_t *slot = heapMap;
+	uintptr_t *slotTop = heapMap + slotCount;
+	while (slot < slotTop) {
+		slot = scan->skipEmptySlots(slot, slotTop);
+		if (slot < slotTop) {
+			nonEmptySlots += 1;
+			slot += 1;
+		}
+	}
+	return nonEmptySlots;
+}
+
+static uintptr_t
+extractAll(MM_HeapMapScan *scan, uintptr_t *heapMap, uintptr_t slotCount)
+{
+	omrobjectptr_t buffer[EXTRACT_BUFFER_COUNT];
+	uintptr_t objects = 0;
+	uintptr_t *slot = heapMap;
+	uintptr_t *slotTop = heapMap + slotCount;
+	/* the addresses are never dereferenced - any base will do */
+	uintptr_t *heapSlot = NULL;
+	while (slot < slotTop) {
+		objects += scan->extractMarkedObjects(slot, slotTop, heapSlot, buffer, EXTRACT_BUFFER_COUNT);
+	}
+	return objects;
+}
+
+int
+main(void)
+{
+	OMRPortLibrary portLibrary;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t *heapMap = (uintptr_t *)omrmem_allocate_memory(HEAP_MAP_SLOTS * sizeof(uintptr_t), OMRMEM_CATEGORY_MM);
+	if (NULL == heapMap) {
+		omrtty_printf("Failed to allocate the heap map\n");
+		return -1;
+	}
+
+	double bitsPerIteration = (double)HEAP_MAP_SLOTS * sizeof(uintptr_t) * 8;
+	double ticksPerSecond = (double)omrtime_hires_frequency();
+
+	omrtty_printf("%10s %8s %22s %22s\n", "occupancy", "kernel", "skip (Gbits/s)", "extract (Gbits/s)");
+	for (uintptr_t o = 0; o < sizeof(OCCUPANCIES) / sizeof(OCCUPANCIES[0]); o++) {
+		populateHeapMap(heapMap, HEAP_MAP_SLOTS, OCCUPANCIES[o]);
+		uintptr_t expectedSlots = 0;
+		uintptr_t expectedObjects = 0;
+
+		for (uintptr_t k = 0; k < sizeof(KERNELS) / sizeof(KERNELS[0]); k++) {
+			MM_HeapMapScan::Kernel kernel = KERNELS[k];
+			MM_HeapMapScan scan;
+			if (!scan.selectKernel(kernel)) {
+				continue;
+			}
+
+			uintptr_t nonEmptySlots = 0;
+			uint64_t start = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < ITERATIONS; i++) {
+				nonEmptySlots = skipAll(&scan, heapMap, HEAP_MAP_SLOTS);
+			}
+			uint64_t skipTicks = omrtime_hires_clock() - start;
+
+			uintptr_t objects = 0;
+			start = omrtime_hires_clock();
+			for (uintptr_t i = 0; i < ITERATIONS; i++) {
+				objects = extractAll(&scan, heapMap, HEAP_MAP_SLOTS);
+			}
+			uint64_t extractTicks = omrtime_hires_clock() - start;
+
+			if (MM_HeapMapScan::kernel_scalar == kernel) {
+				expectedSlots = nonEmptySlots;
+				expectedObjects = objects;
+			} else if ((expectedSlots != nonEmptySlots) || (expectedObjects != objects)) {
+				omrtty_printf("Kernel %s disagrees with the scalar kernel\n", MM_HeapMapScan::getKernelName(kernel));
+				rc = -1;
+			}
+
+			double skipRate = (bitsPerIteration * ITERATIONS) / ((double)OMR_MAX(skipTicks, 1) / ticksPerSecond) / 1e9;
+			double extractRate = (bitsPerIteration * ITERATIONS) / ((double)OMR_MAX(extractTicks, 1) / ticksPerSecond) / 1e9;
+			omrtty_printf("%10.3f %8s %22.2f %22.2f\n", OCCUPANCIES[o], MM_HeapMapScan::getKernelName(kernel), skipRate, extractRate);
+		}
+	}
+
+	omrmem_free_memory(heapMap);
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return (int)rc;
+}
@@ -0,0 +1,208 @@
+/*******************************************************************************
+ * Copyright (c) 2019, 2019 IBM Corp. and others
+ *
+ * This program and the accompanying materials are made available under
+ * the terms of the Eclipse Public License 2.0 which accompanies this
+ * distribution and is available at https://www.eclipse.org/legal/epl-2.0/
+ * or the Apache License, Version 2.0 which accompanies this distribution and
+ * is available at https://www.apache.org/licenses/LICENSE-2.0.
+ *
+ * This Source Code may also be made available under the following
+ * Secondary Licenses when the conditions for such availability set
+ * forth in the Eclipse Public License, v. 2.0 are satisfied: GNU
+ * General Public License, version 2 with the GNU Classpath
+ * Exception [1] and GNU General Public License, version 2 with the
+ * OpenJDK Assembly Exception [2].
+ *
+ * [1] https://www.gnu.org/software/classpath/license.html
+ * [2] http://openjdk.java.net/legal/assembly-exception.html
+ *
+ * SPDX-License-Identifier: EPL-2.0 OR Apache-2.0 OR GPL-2.0 WITH Classpath-exception-2.0 OR LicenseRef-GPL-2.0 WITH Assembly-exception
+ *******************************************************************************/
+
+/*
+ * Microbenchmark for the object copy strategies (see gc/base/ObjectCopy.hpp).
+ * Each thread copies objects of a given size back to back from a source region to a destination region,
+ * both larger than the last level cache of most processors, as the Scavenger does when it fills a copy cache.
+ * Every strategy is timed for a range of object sizes, with one thread and with one thread per processor
+ * (up to MAX_THREADS), and results are reported as bytes copied per second per thread.
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "omrport.h"
+#include "omrthread.h"
+
+#include "ObjectCopy.hpp"
+
+#define REGION_SIZE ((uintptr_t)32 * 1024 * 1024)
+#define ITERATIONS 4
+#define MAX_THREADS 8
+
+static const uintptr_t OBJECT_SIZES[] = { 32, 256, 4 * 1024, 64 * 1024, 1024 * 1024 };
+
+/* the kernels used for large objects, timed after the strategies used for small and medium ones */
+static const MM_ObjectCopy::Kernel KERNELS[] = {
+	MM_ObjectCopy::kernel_sse2
+};
+
+#define KERNEL_COUNT (sizeof(KERNELS) / sizeof(KERNELS[0]))
+
+typedef struct Strategy {
+	const char *name;
+	MM_ObjectCopy::CopyFunction function;
+} Strategy;
+
+typedef struct CopyThreadData {
+	OMRPortLibrary *portLibrary;
+	MM_ObjectCopy::CopyFunction function;
+	uintptr_t objectSize;
+	uint8_t *source;
+	uint8_t *destination;
+	uint64_t ticks;
+	uintptr_t bytes;
+	bool verified;
+} CopyThreadData;
+
+static void
+copyWords(void *destination, const void *source, uintptr_t size)
+{
+	MM_ObjectCopy::copyWords(destination, source, size);
+}
+
+static int J9THREAD_PROC
+copyThread(void *entryArg)
+{
+	CopyThreadData *data = (CopyThreadData *)entryArg;
+	OMRPORT_ACCESS_FROM_OMRPORT(data->portLibrary);
+	uintptr_t objectSize = data->objectSize;
+	uintptr_t regionTop = REGION_SIZE - (REGION_SIZE % objectSize);
+
+	memset(data->destination, 0, REGION_SIZE);
+	uint64_t start = omrtime_hires_clock();
+	for (uintptr_t i = 0; i < ITERATIONS; i++) {
+		for (uintptr_t offset = 0; offset < regionTop; offset += objectSize) {
+			data->function(data->destination + offset, data->source + offset, objectSize);
+		}
+	}
+	data->ticks = omrtime_hires_clock() - start;
+	data->bytes = ITERATIONS * regionTop;
+	data->verified = (0 == memcmp(data->destination, data->source, regionTop));
+	return 0;
+}
+
+/**
+ * Run a strategy on threadCount threads at once.
+ * @return the mean rate per thread in bytes per second, or a negative value if a copy was incorrect
+ */
+static double
+runStrategy(OMRPortLibrary *portLibrary, CopyThreadData *threadData, uintptr_t threadCount)
+{
+	OMRPORT_ACCESS_FROM_OMRPORT(portLibrary);
+	omrthread_t threads[MAX_THREADS];
+	double ticksPerSecond = (double)omrtime_hires_frequency();
+	double rate = 0.0;
+
+	omrthread_attr_t attr = NULL;
+	omrthread_attr_init(&attr);
+	omrthread_attr_set_detachstate(&attr, J9THREAD_CREATE_JOINABLE);
+	for (uintptr_t t = 0; t < threadCount; t++) {
+		if (0 != omrthread_create_ex(&threads[t], &attr, 0, copyThread, &threadData[t])) {
+			threads[t] = NULL;
+			copyThread(&threadData[t]);
+		}
+	}
+	omrthread_attr_destroy(&attr);
+
+	bool verified = true;
+	for (uintptr_t t = 0; t < threadCount; t++) {
+		if (NULL != threads[t]) {
+			omrthread_join(threads[t]);
+		}
+		verified = verified && threadData[t].verified;
+		rate += (double)threadData[t].bytes / ((double)OMR_MAX(threadData[t].ticks, 1) / ticksPerSecond);
+	}
+	return verified ? (rate / threadCount) : -1.0;
+}
+
+int
+main(void)
+{
+	OMRPortLibrary portLibrary;
+
+	intptr_t rc = omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT);
+	if (0 != rc) {
+		fprintf(stderr, "omrthread_attach_ex(NULL, J9THREAD_ATTR_DEFAULT) failed, rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	rc = omrport_init_library(&portLibrary, sizeof(OMRPortLibrary));
+	if (0 != rc) {
+		fprintf(stderr, "omrport_init_library(&portLibrary, sizeof(OMRPortLibrary)), rc=%d\n", (int)rc);
+		return -1;
+	}
+
+	OMRPORT_ACCESS_FROM_OMRPORT(&portLibrary);
+
+	uintptr_t maxThreadCount = OMR_MIN(OMR_MAX(omrsysinfo_get_number_CPUs_by_type(OMRPORT_CPU_ONLINE), 1), MAX_THREADS);
+	CopyThreadData threadData[MAX_THREADS];
+	for (uintptr_t t = 0; t < maxThreadCount; t++) {
+		memset(&threadData[t], 0, sizeof(CopyThreadData));
+		threadData[t].portLibrary = &portLibrary;
+		threadData[t].source = (uint8_t *)omrmem_allocate_memory(REGION_SIZE, OMRMEM_CATEGORY_MM);
+		threadData[t].destination = (uint8_t *)omrmem_allocate_memory(REGION_SIZE, OMRMEM_CATEGORY_MM);
+		if ((NULL == threadData[t].source) || (NULL == threadData[t].destination)) {
+			omrtty_printf("Failed to allocate the copy regions\n");
+			return -1;
+		}
+		for (uintptr_t i = 0; i < REGION_SIZE; i++) {
+			threadData[t].source[i] = (uint8_t)(i + t);
+		}
+	}
+
+	Strategy strategies[2 + KERNEL_COUNT];
+	uintptr_t strategyCount = 0;
+	strategies[strategyCount].name = "words";
+	strategies[strategyCount++].function = copyWords;
+	strategies[strategyCount].name = "memcpy";
+	strategies[strategyCount++].function = MM_ObjectCopy::copyMemcpy;
+	for (uintptr_t k = 0; k < KERNEL_COUNT; k++) {
+		if (MM_ObjectCopy::isKernelSupported(KERNELS[k])) {
+			strategies[strategyCount].name = MM_ObjectCopy::getKernelName(KERNELS[k]);
+			strategies[strategyCount++].function = MM_ObjectCopy::getKernelFunction(KERNELS[k]);
+		}
+	}
+
+	/* one thread, then one thread per processor */
+	uintptr_t threadCounts[] = { 1, maxThreadCount };
+	uintptr_t threadCountCount = (1 < maxThreadCount) ? 2 : 1;
+
+	omrtty_printf("%12s %8s %8s %26s\n", "object size", "threads", "strategy", "copy rate (MB/s/thread)");
+	for (uintptr_t o = 0; o < sizeof(OBJECT_SIZES) / sizeof(OBJECT_SIZES[0]); o++) {
+		for (uintptr_t c = 0; c < threadCountCount; c++) {
+			uintptr_t threadCount = threadCounts[c];
+			for (uintptr_t s = 0; s < strategyCount; s++) {
+				for (uintptr_t t = 0; t < threadCount; t++) {
+					threadData[t].function = strategies[s].function;
+					threadData[t].objectSize = OBJECT_SIZES[o];
+				}
+				double rate = runStrategy(&portLibrary, threadData, threadCount);
+				if (rate < 0.0) {
+					omrtty_printf("Strategy %s copied %zu byte objects incorrectly\n", strategies[s].name, OBJECT_SIZES[o]);
+					rc = -1;
+				} else {
+					omrtty_printf("%12zu %8zu %8s %26.0f\n", OBJECT_SIZES[o], threadCount, strategies[s].name, rate / (1024 * 1024));
+				}
+			}
+		}
+	}
+
+	for (uintptr_t t = 0; t < maxThreadCount; t++) {
+		omrmem_free_memory(threadData[t].source);
+		omrmem_free_memory(threadData[t].destination);
+	}
+	portLibrary.port_shutdown_library(&portLibrary);
+	omrthread_detach(NULL);
+	return (int)rc;
+}
@@ -46,4 +46,10 @@ omr_perfgctest:
 	./omrgctest --gtest_filter="perfTest*" -keepVerboseLog
 	./omrperfgctest
 
-.PHONY: all test omr_perfgctest 
+omr_heapmapscanperftest:
+	./omrheapmapscanperftest
+
+omr_objectcopyperftest:
+	./omrobjectcopyperftest
+
+.PHONY: all test omr_perfgctest omr_heapmapscanperftest omr_objectcopyperftest
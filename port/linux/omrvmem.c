@@ -55,6 +55,9 @@
 #if !defined(MADV_HUGEPAGE)
 #define MADV_HUGEPAGE 14
 #endif /* MADV_HUGEPAGE */
+#if !defined(MADV_NOHUGEPAGE)
+#define MADV_NOHUGEPAGE 15
+#endif /* MADV_NOHUGEPAGE */
 
 #if defined(OMR_PORT_NUMA_SUPPORT)
 #include <numaif.h>
@@ -133,6 +136,7 @@ static BOOLEAN isStrictAndOutOfRange(void *memoryPointer, void *startAddress, vo
 static BOOLEAN rangeIsValid(struct J9PortVmemIdentifier *identifier, void *address, uintptr_t byteAmount);
 static void *reserveLargePages(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier, OMRMemCategory *category, uintptr_t byteAmount, void *startAddress, void *endAddress, uintptr_t pageSize, uintptr_t alignmentInBytes, uintptr_t vmemOptions, uintptr_t mode);
 static uintptr_t adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount);
+static uintptr_t adviseNoHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount);
 
 static void *default_pageSize_reserve_memory(struct OMRPortLibrary *portLibrary, void *address, uintptr_t byteAmount, struct J9PortVmemIdentifier *identifier, uintptr_t mode, uintptr_t pageSize, OMRMemCategory *category);
 #if defined(OMR_PORT_NUMA_SUPPORT)
@@ -927,6 +931,41 @@ adviseHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byte
 #endif /* defined(MAP_ANON) || defined(MAP_ANONYMOUS) */
 }
 
+/**
+ * Advise memory to disable use of Transparent HugePages (THP) (Linux Only)
+ *
+ * Notify kernel that the virtual memory region specified by address and byteAmount should be labelled
+ * with MADV_NOHUGEPAGE, so that sparsely touched memory is not promoted to THP even if THP is set to always.
+ *
+ * @param[in] portLibrary The port library.
+ * @param[in] address The starting virtual address.
+ * @param[in] byteAmount The amount of bytes after address to exclude from hugepages.
+ *
+ * @return 0 on success, OMRPORT_ERROR_VMEM_OPFAILED if an error occurred, or OMRPORT_ERROR_VMEM_NOT_SUPPORTED.
+ */
+static uintptr_t
+adviseNoHugepage(struct OMRPortLibrary *portLibrary, void* address, uintptr_t byteAmount)
+{
+#if defined(MAP_ANON) || defined(MAP_ANONYMOUS)
+	if (portLibrary->portGlobals->vmemEnableMadvise) {
+		uintptr_t start = (uintptr_t)address;
+		uintptr_t end = (uintptr_t)address + byteAmount;
+
+		/* Align start and end to be page-size aligned */
+		start = start + ((start % PPG_vmem_pageSize[0]) ? (PPG_vmem_pageSize[0] - (start % PPG_vmem_pageSize[0])) : 0);
+		end = end - (end % PPG_vmem_pageSize[0]);
+		if (start < end) {
+			if (0 != madvise((void *)start, end - start, MADV_NOHUGEPAGE)) {
+				return OMRPORT_ERROR_VMEM_OPFAILED;
+			}
+		}
+	}
+	return 0;
+#else /* defined(MAP_ANON) || defined(MAP_ANONYMOUS) */
+	return OMRPORT_ERROR_VMEM_NOT_SUPPORTED;
+#endif /* defined(MAP_ANON) || defined(MAP_ANONYMOUS) */
+}
+
 uintptr_t
 omrvmem_get_page_size(struct OMRPortLibrary *portLibrary, struct J9PortVmemIdentifier *identifier)
 {
@@ -1565,6 +1604,8 @@ allocAnywhere:
 		Trc_PRT_vmem_omrvmem_reserve_memory_ex_UnableToAllocateWithinSpecifiedRange(byteAmount, startAddress, endAddress);
 
 		memoryPointer = NULL;
+	} else if (OMR_ARE_ANY_BITS_SET(vmemOptions, OMRPORT_VMEM_NO_HUGEPAGE)) {
+		adviseNoHugepage(portLibrary, memoryPointer, byteAmount);
 	} else {
 		adviseHugepage(portLibrary, memoryPointer, byteAmount);
 	}